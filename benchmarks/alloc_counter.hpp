@@ -0,0 +1,98 @@
+#pragma once
+
+/**
+ * @file alloc_counter.hpp
+ * @brief Global operator new/delete replacement that counts heap allocations
+ * @author Jo, SeungHyeon (Jo,SH)
+ *
+ * Replacement allocation functions must be defined exactly once per program,
+ * so include this header from a single translation unit per benchmark binary.
+ */
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+namespace sensorstreamkit::bench {
+
+inline std::atomic<uint64_t> g_allocations{0};
+
+/**
+ * @brief Number of operator new calls since program start
+ */
+inline uint64_t allocation_count() noexcept {
+    return g_allocations.load(std::memory_order_relaxed);
+}
+
+}  // namespace sensorstreamkit::bench
+
+// GCC flags free() on operator new results; both sides are malloc-backed here
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+void* operator new(std::size_t size) {
+    sensorstreamkit::bench::g_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size == 0 ? 1 : size)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size) {
+    return ::operator new(size);
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+// Over-aligned types and std::pmr::new_delete_resource() use these
+void* operator new(std::size_t size, std::align_val_t alignment) {
+    sensorstreamkit::bench::g_allocations.fetch_add(1, std::memory_order_relaxed);
+    const auto align = static_cast<std::size_t>(alignment);
+    // aligned_alloc needs a size that is a multiple of the alignment
+    const std::size_t rounded = (size + align - 1) / align * align;
+    if (void* ptr = std::aligned_alloc(align, rounded == 0 ? align : rounded)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment) {
+    return ::operator new(size, alignment);
+}
+
+void operator delete(void* ptr, std::align_val_t) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::align_val_t) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t, std::align_val_t) noexcept {
+    std::free(ptr);
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
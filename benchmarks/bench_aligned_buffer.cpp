@@ -0,0 +1,102 @@
+/**
+ * @file bench_aligned_buffer.cpp
+ * @brief Vector kernels over float columns at cache-line and shifted offsets
+ * @author Jo, SeungHyeon (Jo,SH)
+ *
+ * Arg 0 is the column length, Arg 1 the byte offset of its first float
+ * from a 64-byte boundary: 0 is an AlignedVector column (ImuSamples,
+ * PointCloud), 4 a float-aligned column that splits every fourth 16-byte
+ * load across cache lines, and 16 where a payload starts in a frame
+ * after the message header. BM_Scale is an auto-vectorized a * x + b;
+ * BM_Quantize runs quantization::encode (SSE2 / NEON). BM_ReceiveCopy is
+ * what ZmqSubscriber::receive_raw() adds to move a frame into aligned
+ * storage.
+ */
+
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <cstring>
+
+#include "sensorstreamkit/core/aligned_allocator.hpp"
+#include "sensorstreamkit/core/point_cloud.hpp"
+
+using namespace sensorstreamkit::core;
+
+namespace {
+
+/**
+ * @brief count floats starting offset bytes past a cache line
+ */
+class ShiftedColumn {
+public:
+    ShiftedColumn(size_t count, size_t offset)
+        : storage_(count * sizeof(float) + offset)
+        , data_(reinterpret_cast<float*>(storage_.data() + offset))
+        , count_(count) {
+        for (size_t i = 0; i < count_; ++i) {
+            data_[i] = 20.0f * std::sin(static_cast<float>(i) * 0.01f);
+        }
+    }
+
+    [[nodiscard]] const float* data() const noexcept { return data_; }
+    [[nodiscard]] size_t size() const noexcept { return count_; }
+
+private:
+    AlignedBuffer storage_;
+    float* data_;
+    size_t count_;
+};
+
+void scale(float* __restrict out, const float* __restrict in, size_t count, float a, float b) noexcept {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = a * in[i] + b;
+    }
+}
+
+void column_args(benchmark::internal::Benchmark* bench) {
+    for (int64_t count : {4096, 1 << 20}) {
+        for (int64_t offset : {0, 4, 16}) {
+            bench->Args({count, offset});
+        }
+    }
+}
+
+}  // namespace
+
+static void BM_Scale(benchmark::State& state) {
+    const ShiftedColumn column(static_cast<size_t>(state.range(0)), static_cast<size_t>(state.range(1)));
+    AlignedVector<float> out(column.size());
+
+    for (auto _ : state) {
+        scale(out.data(), column.data(), column.size(), 1.5f, -0.25f);
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(column.size() * sizeof(float)));
+}
+BENCHMARK(BM_Scale)->Apply(column_args);
+
+static void BM_Quantize(benchmark::State& state) {
+    const ShiftedColumn column(static_cast<size_t>(state.range(0)), static_cast<size_t>(state.range(1)));
+    AlignedBuffer out(column.size() * sizeof(int16_t));
+
+    for (auto _ : state) {
+        quantization::encode(out.data(), column.data(), column.size(), 0.005f);
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(column.size() * sizeof(float)));
+}
+BENCHMARK(BM_Quantize)->Apply(column_args);
+
+static void BM_ReceiveCopy(benchmark::State& state) {
+    const ShiftedColumn column(static_cast<size_t>(state.range(0)), 4);
+    const auto* bytes = reinterpret_cast<const uint8_t*>(column.data());
+    AlignedBuffer frame;
+
+    for (auto _ : state) {
+        frame.assign(bytes, bytes + column.size() * sizeof(float));
+        benchmark::DoNotOptimize(frame.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(column.size() * sizeof(float)));
+}
+BENCHMARK(BM_ReceiveCopy)->Arg(4096)->Arg(1 << 20);
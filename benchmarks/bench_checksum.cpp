@@ -0,0 +1,122 @@
+/**
+ * @file bench_checksum.cpp
+ * @brief Cost of CRC32C framing: raw throughput and plain vs checksummed messages
+ * @author Jo, SeungHyeon (Jo,SH)
+ *
+ * The raw cases report bytes/s for CRC32C alone and for the fused
+ * copy-and-checksum next to a plain memcpy, up to a 10 MB frame. The
+ * message cases show what set_checksum(true) adds to serialize_into() and
+ * deserialize_into() for small metadata payloads.
+ */
+
+#include <benchmark/benchmark.h>
+#include <cstring>
+#include <numeric>
+#include <vector>
+
+#include "sensorstreamkit/core/crc32c.hpp"
+#include "sensorstreamkit/core/message.hpp"
+
+using namespace sensorstreamkit::core;
+
+namespace {
+
+ImuData make_imu() {
+    return ImuData{
+        .sensor_id_ = "vehicle_07/imu_front_left_chassis",
+        .timestamp_ns_ = 1234567890,
+        .accel_x = 0.1f,
+        .accel_y = 0.2f,
+        .accel_z = 9.81f,
+        .gyro_x = 0.01f,
+        .gyro_y = 0.02f,
+        .gyro_z = 0.03f
+    };
+}
+
+std::vector<uint8_t> make_bytes(size_t size) {
+    std::vector<uint8_t> bytes(size);
+    std::iota(bytes.begin(), bytes.end(), uint8_t{0});
+    return bytes;
+}
+
+}  // namespace
+
+// ============================================================================
+// Raw throughput
+// ============================================================================
+
+static void BM_Crc32c(benchmark::State& state) {
+    const auto data = make_bytes(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(crc32c::compute(data));
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+    state.SetLabel(crc32c::hardware_accelerated() ? "hardware" : "software");
+}
+BENCHMARK(BM_Crc32c)->Arg(64)->Arg(4 << 10)->Arg(10 << 20);
+
+static void BM_Memcpy(benchmark::State& state) {
+    const auto source = make_bytes(static_cast<size_t>(state.range(0)));
+    std::vector<uint8_t> target(source.size());
+    for (auto _ : state) {
+        std::memcpy(target.data(), source.data(), source.size());
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Memcpy)->Arg(10 << 20);
+
+static void BM_CopyThenCrc32c(benchmark::State& state) {
+    const auto source = make_bytes(static_cast<size_t>(state.range(0)));
+    std::vector<uint8_t> target(source.size());
+    for (auto _ : state) {
+        std::memcpy(target.data(), source.data(), source.size());
+        benchmark::DoNotOptimize(crc32c::compute(target));
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_CopyThenCrc32c)->Arg(10 << 20);
+
+static void BM_FusedCopyCrc32c(benchmark::State& state) {
+    const auto source = make_bytes(static_cast<size_t>(state.range(0)));
+    std::vector<uint8_t> target(source.size());
+    for (auto _ : state) {
+        uint32_t crc = 0;
+        crc32c::copy(target.data(), source.data(), source.size(), crc);
+        benchmark::DoNotOptimize(crc);
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_FusedCopyCrc32c)->Arg(10 << 20);
+
+// ============================================================================
+// Messages
+// ============================================================================
+
+static void BM_ImuSerialize(benchmark::State& state) {
+    Message<ImuData> msg(make_imu());
+    msg.set_checksum(state.range(0) != 0);
+    std::vector<uint8_t> buffer(msg.serialized_size());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(msg.serialize_into(buffer));
+        benchmark::ClobberMemory();
+    }
+    state.SetLabel(state.range(0) != 0 ? "crc32c" : "plain");
+}
+BENCHMARK(BM_ImuSerialize)->Arg(0)->Arg(1);
+
+static void BM_ImuDeserializeInto(benchmark::State& state) {
+    Message<ImuData> msg(make_imu());
+    msg.set_checksum(state.range(0) != 0);
+    std::vector<uint8_t> buffer;
+    msg.serialize(buffer);
+
+    Message<ImuData> target;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Message<ImuData>::deserialize_into(buffer, target));
+        benchmark::ClobberMemory();
+    }
+    state.SetLabel(state.range(0) != 0 ? "crc32c" : "plain");
+}
+BENCHMARK(BM_ImuDeserializeInto)->Arg(0)->Arg(1);
@@ -0,0 +1,58 @@
+/**
+ * @file bench_clock.cpp
+ * @brief Per-call cost of steady_clock vs the calibrated TSC clock
+ * @author Jo, SeungHyeon (Jo,SH)
+ *
+ * Timestamp::now() is taken for every published message, so its cost is
+ * paid once per message. The Timestamp cases include the clock-source
+ * dispatch on top of the raw read.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "sensorstreamkit/core/message.hpp"
+#include "sensorstreamkit/core/tsc_clock.hpp"
+
+using namespace sensorstreamkit::core;
+
+// ============================================================================
+// Raw clocks
+// ============================================================================
+
+static void BM_SteadyClockNow(benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(detail::steady_clock_ns());
+    }
+}
+BENCHMARK(BM_SteadyClockNow);
+
+static void BM_TscClockNow(benchmark::State& state) {
+    if (!TscClock::calibrate()) {
+        state.SkipWithError("No invariant TSC");
+        return;
+    }
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(TscClock::now_ns());
+    }
+}
+BENCHMARK(BM_TscClockNow);
+
+// ============================================================================
+// Timestamp::now() per clock source
+// ============================================================================
+
+static void BM_TimestampNow(benchmark::State& state) {
+    const auto requested = static_cast<ClockSource>(state.range(0));
+    if (Timestamp::set_clock_source(requested) != requested) {
+        state.SkipWithError("Clock source unavailable");
+        return;
+    }
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Timestamp::now());
+    }
+    state.SetLabel(requested == ClockSource::Tsc ? "tsc" : "steady_clock");
+    Timestamp::set_clock_source(ClockSource::SteadyClock);
+}
+BENCHMARK(BM_TimestampNow)
+    ->Arg(static_cast<int>(ClockSource::SteadyClock))
+    ->Arg(static_cast<int>(ClockSource::Tsc));
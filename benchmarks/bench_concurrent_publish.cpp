@@ -0,0 +1,110 @@
+/**
+ * @file bench_concurrent_publish.cpp
+ * @brief 1 to 32 producer threads publishing through one socket
+ * @author Jo, SeungHyeon (Jo,SH)
+ *
+ * Mutex: every producer locks a shared ZmqPublisher around publish(), so
+ * serialization and sending are serialized too. Concurrent: producers
+ * serialize in parallel and hand frames to ConcurrentPublisher's I/O
+ * thread through its lock-free queue, with each overflow policy.
+ *
+ * The socket is a PUB bound on inproc with no subscriber, so sending costs
+ * only the publisher's own work. Times are wall clock; items_per_second is
+ * the combined rate of all producers. With Drop, dropped/msg is the share
+ * of publishes refused because the queue was full.
+ */
+
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "sensorstreamkit/transport/concurrent_publisher.hpp"
+
+using namespace sensorstreamkit::core;
+using namespace sensorstreamkit::transport;
+
+namespace {
+
+Message<ImuData> make_message() {
+    return Message<ImuData>(ImuData{
+        .sensor_id_ = "imu_front",
+        .timestamp_ns_ = 1'700'000'000'000'000'000ull,
+        .accel_x = 0.1f,
+        .accel_y = 0.2f,
+        .accel_z = 9.81f,
+        .gyro_x = 0.01f,
+        .gyro_y = 0.02f,
+        .gyro_z = 0.03f
+    });
+}
+
+std::string endpoint(const std::string& name, const benchmark::State& state) {
+    return "inproc://bench_concurrent_publish_" + name + "_" + std::to_string(state.threads());
+}
+
+}  // namespace
+
+// ============================================================================
+// Shared ZmqPublisher behind a mutex
+// ============================================================================
+
+static void BM_MutexPublish(benchmark::State& state) {
+    static std::unique_ptr<ZmqPublisher> publisher;
+    static std::mutex mutex;
+    if (state.thread_index() == 0) {
+        publisher = std::make_unique<ZmqPublisher>(PublisherConfig{.endpoint = endpoint("mutex", state)});
+        if (!publisher->bind()) {
+            state.SkipWithError("bind failed");
+        }
+    }
+
+    const Message<ImuData> message = make_message();
+    for (auto _ : state) {
+        std::lock_guard lock(mutex);
+        benchmark::DoNotOptimize(publisher->publish("imu", message));
+    }
+    state.SetItemsProcessed(state.iterations());
+
+    if (state.thread_index() == 0) {
+        publisher.reset();
+    }
+}
+BENCHMARK(BM_MutexPublish)->ThreadRange(1, 32)->UseRealTime();
+
+// ============================================================================
+// ConcurrentPublisher
+// ============================================================================
+
+static void BM_ConcurrentPublish(benchmark::State& state) {
+    static std::unique_ptr<ConcurrentPublisher> publisher;
+    const auto overflow = static_cast<OverflowPolicy>(state.range(0));
+    if (state.thread_index() == 0) {
+        publisher = std::make_unique<ConcurrentPublisher>(ConcurrentPublisherConfig{
+            .publisher = {.endpoint = endpoint(overflow == OverflowPolicy::Block ? "block" : "drop", state)},
+            .overflow = overflow});
+        if (!publisher->bind()) {
+            state.SkipWithError("bind failed");
+        }
+    }
+
+    const Message<ImuData> message = make_message();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(publisher->publish("imu", message));
+    }
+    state.SetItemsProcessed(state.iterations());
+
+    if (state.thread_index() == 0) {
+        publisher->stop();
+        state.counters["dropped/msg"] = benchmark::Counter(
+            static_cast<double>(publisher->messages_dropped()) /
+            static_cast<double>(publisher->messages_sent() + publisher->messages_dropped()));
+        publisher.reset();
+    }
+}
+BENCHMARK(BM_ConcurrentPublish)
+    ->ArgName("drop")
+    ->Arg(static_cast<int>(OverflowPolicy::Block))
+    ->Arg(static_cast<int>(OverflowPolicy::Drop))
+    ->ThreadRange(1, 32)
+    ->UseRealTime();
@@ -0,0 +1,77 @@
+/**
+ * @file bench_dispatch.cpp
+ * @brief Jump-table dispatch on message_type vs trial deserialization
+ * @author Jo, SeungHyeon (Jo,SH)
+ *
+ * Without a type id, a subscriber on a mixed stream has to try each
+ * payload type until one decodes. The trial baseline tries them in
+ * registry order. Decoding is not a reliable type test either: the IMU
+ * frame here also parses as a camera frame.
+ */
+
+#include <benchmark/benchmark.h>
+#include <vector>
+
+#include "sensorstreamkit/core/message.hpp"
+#include "sensorstreamkit/core/message_registry.hpp"
+
+using namespace sensorstreamkit::core;
+
+namespace {
+
+std::vector<std::vector<uint8_t>> make_mixed_frames() {
+    std::vector<std::vector<uint8_t>> frames(3);
+    Message<CameraFrameData>(CameraFrameData{.sensor_id_ = "camera_front", .frame_id = 1, .width = 1920,
+                                             .height = 1080, .encoding = "RGB8"}).serialize(frames[0]);
+    Message<LidarScanData>(LidarScanData{.sensor_id_ = "lidar_roof", .num_points = 100000}).serialize(frames[1]);
+    Message<ImuData>(ImuData{.sensor_id_ = "imu_main", .accel_z = 9.81f}).serialize(frames[2]);
+    return frames;
+}
+
+// Untyped frames, so the typed decoders cannot reject by header alone
+std::vector<std::vector<uint8_t>> strip_types(std::vector<std::vector<uint8_t>> frames) {
+    for (auto& frame : frames) {
+        frame[12] = 0;
+        frame[13] = 0;
+    }
+    return frames;
+}
+
+}  // namespace
+
+static void BM_DispatchByType(benchmark::State& state) {
+    const auto frames = make_mixed_frames();
+    uint64_t handled = 0;
+    auto on_camera = [&](const Message<CameraFrameData>& msg) { handled += msg.payload().width; };
+    auto on_lidar = [&](const Message<LidarScanData>& msg) { handled += msg.payload().num_points; };
+    auto on_imu = [&](const Message<ImuData>& msg) { handled += msg.header().sequence_number; };
+
+    for (auto _ : state) {
+        for (const auto& frame : frames) {
+            benchmark::DoNotOptimize(dispatch(frame, on_camera, on_lidar, on_imu));
+        }
+    }
+    benchmark::DoNotOptimize(handled);
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(frames.size()));
+}
+BENCHMARK(BM_DispatchByType);
+
+static void BM_TrialDeserialize(benchmark::State& state) {
+    const auto frames = strip_types(make_mixed_frames());
+    uint64_t handled = 0;
+
+    for (auto _ : state) {
+        for (const auto& frame : frames) {
+            if (auto camera = Message<CameraFrameData>::deserialize(frame)) {
+                handled += camera->payload().width;
+            } else if (auto lidar = Message<LidarScanData>::deserialize(frame)) {
+                handled += lidar->payload().num_points;
+            } else if (auto imu = Message<ImuData>::deserialize(frame)) {
+                handled += imu->header().sequence_number;
+            }
+        }
+    }
+    benchmark::DoNotOptimize(handled);
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(frames.size()));
+}
+BENCHMARK(BM_TrialDeserialize);
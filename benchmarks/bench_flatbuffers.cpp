@@ -0,0 +1,182 @@
+/**
+ * @file bench_flatbuffers.cpp
+ * @brief FlatBuffers codec vs the memcpy codec (encode, decode, in-place read)
+ * @author Jo, SeungHyeon (Jo,SH)
+ *
+ * Pairs each FlatBuffers path with its memcpy-codec counterpart:
+ *   encode:  FlatBufferCodec::encode (reused builder) vs Message::serialize_into
+ *   decode:  FlatBufferCodec::decode vs Message::deserialize (both owning)
+ *   read:    FlatBufferView::from / from_trusted vs MessageView::from
+ * and the same encode/decode made through Message<ImuData, FlatBufferCodec>,
+ * which copies out of a per-thread builder.
+ */
+
+#include <benchmark/benchmark.h>
+#include <vector>
+
+#include "alloc_counter.hpp"
+#include "sensorstreamkit/core/flatbuffers_codec.hpp"
+#include "sensorstreamkit/core/message.hpp"
+#include "sensorstreamkit/core/message_view.hpp"
+
+using namespace sensorstreamkit::core;
+using sensorstreamkit::bench::allocation_count;
+
+namespace {
+
+Message<ImuData> make_imu_message() {
+    return Message<ImuData>(ImuData{
+        .sensor_id_ = "vehicle_07/imu_front_left_chassis",
+        .timestamp_ns_ = 1234567890,
+        .accel_x = 0.1f,
+        .accel_y = 0.2f,
+        .accel_z = 9.81f,
+        .gyro_x = 0.01f,
+        .gyro_y = 0.02f,
+        .gyro_z = 0.03f
+    });
+}
+
+std::vector<uint8_t> memcpy_encoded(const Message<ImuData>& message) {
+    std::vector<uint8_t> buffer;
+    message.serialize(buffer);
+    return buffer;
+}
+
+std::vector<uint8_t> flatbuffer_encoded(const Message<ImuData>& message) {
+    flatbuffers::FlatBufferBuilder builder;
+    auto encoded = FlatBufferCodec::encode(message, builder);
+    return {encoded.begin(), encoded.end()};
+}
+
+void report(benchmark::State& state, uint64_t allocs_before, size_t wire_bytes) {
+    state.counters["allocs/msg"] = benchmark::Counter(
+        static_cast<double>(allocation_count() - allocs_before),
+        benchmark::Counter::kAvgIterations);
+    state.counters["wire_bytes"] = static_cast<double>(wire_bytes);
+}
+
+}  // namespace
+
+// ============================================================================
+// Encode
+// ============================================================================
+
+static void BM_EncodeMemcpy(benchmark::State& state) {
+    const auto message = make_imu_message();
+    std::vector<uint8_t> buffer(message.serialized_size());
+    const uint64_t before = allocation_count();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(message.serialize_into(buffer));
+        benchmark::ClobberMemory();
+    }
+    report(state, before, buffer.size());
+}
+BENCHMARK(BM_EncodeMemcpy);
+
+static void BM_EncodeFlatBuffers(benchmark::State& state) {
+    const auto message = make_imu_message();
+    flatbuffers::FlatBufferBuilder builder;
+    size_t wire_bytes = FlatBufferCodec::encode(message, builder).size();
+    const uint64_t before = allocation_count();
+    for (auto _ : state) {
+        auto encoded = FlatBufferCodec::encode(message, builder);
+        benchmark::DoNotOptimize(encoded.data());
+        benchmark::ClobberMemory();
+    }
+    report(state, before, wire_bytes);
+}
+BENCHMARK(BM_EncodeFlatBuffers);
+
+// ============================================================================
+// Decode (owning)
+// ============================================================================
+
+static void BM_DecodeMemcpy(benchmark::State& state) {
+    const auto buffer = memcpy_encoded(make_imu_message());
+    const uint64_t before = allocation_count();
+    for (auto _ : state) {
+        auto msg = Message<ImuData>::deserialize(buffer);
+        benchmark::DoNotOptimize(msg->payload().accel_z);
+    }
+    report(state, before, buffer.size());
+}
+BENCHMARK(BM_DecodeMemcpy);
+
+static void BM_DecodeFlatBuffers(benchmark::State& state) {
+    const auto buffer = flatbuffer_encoded(make_imu_message());
+    const uint64_t before = allocation_count();
+    for (auto _ : state) {
+        auto msg = FlatBufferCodec::decode<ImuData>(buffer);
+        benchmark::DoNotOptimize(msg->payload().accel_z);
+    }
+    report(state, before, buffer.size());
+}
+BENCHMARK(BM_DecodeFlatBuffers);
+
+// ============================================================================
+// In-place read
+// ============================================================================
+
+static void BM_ReadMessageView(benchmark::State& state) {
+    const auto buffer = memcpy_encoded(make_imu_message());
+    const uint64_t before = allocation_count();
+    for (auto _ : state) {
+        auto view = MessageView<ImuData>::from(buffer);
+        benchmark::DoNotOptimize(view->payload().accel_z());
+        benchmark::DoNotOptimize(view->payload().sensor_id().size());
+    }
+    report(state, before, buffer.size());
+}
+BENCHMARK(BM_ReadMessageView);
+
+static void BM_ReadFlatBufferVerified(benchmark::State& state) {
+    const auto buffer = flatbuffer_encoded(make_imu_message());
+    const uint64_t before = allocation_count();
+    for (auto _ : state) {
+        auto view = FlatBufferView<ImuData>::from(buffer);
+        benchmark::DoNotOptimize(view->payload().accel_z());
+        benchmark::DoNotOptimize(view->sensor_id().size());
+    }
+    report(state, before, buffer.size());
+}
+BENCHMARK(BM_ReadFlatBufferVerified);
+
+static void BM_ReadFlatBufferTrusted(benchmark::State& state) {
+    const auto buffer = flatbuffer_encoded(make_imu_message());
+    const uint64_t before = allocation_count();
+    for (auto _ : state) {
+        auto view = FlatBufferView<ImuData>::from_trusted(buffer);
+        benchmark::DoNotOptimize(view->payload().accel_z());
+        benchmark::DoNotOptimize(view->sensor_id().size());
+    }
+    report(state, before, buffer.size());
+}
+BENCHMARK(BM_ReadFlatBufferTrusted);
+
+// ============================================================================
+// Through Message<T, FlatBufferCodec>
+// ============================================================================
+
+static void BM_EncodeCodecParameter(benchmark::State& state) {
+    const Message<ImuData, FlatBufferCodec> message(make_imu_message().payload());
+    std::vector<uint8_t> buffer(message.serialized_size());
+    const uint64_t before = allocation_count();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(message.serialize_into(buffer));
+        benchmark::ClobberMemory();
+    }
+    report(state, before, buffer.size());
+}
+BENCHMARK(BM_EncodeCodecParameter);
+
+static void BM_DecodeCodecParameter(benchmark::State& state) {
+    const auto buffer = flatbuffer_encoded(make_imu_message());
+    const uint64_t before = allocation_count();
+    for (auto _ : state) {
+        auto msg = Message<ImuData, FlatBufferCodec>::deserialize(buffer);
+        benchmark::DoNotOptimize(msg->payload().accel_z);
+    }
+    report(state, before, buffer.size());
+}
+BENCHMARK(BM_DecodeCodecParameter);
@@ -0,0 +1,165 @@
+/**
+ * @file bench_half_float.cpp
+ * @brief Half float columns: bulk vs per-value conversion, and IMU batch size
+ * @author Jo, SeungHyeon (Jo,SH)
+ *
+ * The conversion benchmarks run over 64k IMU-like floats; bytes_per_second
+ * counts the float32 side, to compare with a plain float memcpy.
+ * BM_ImuBatchSerialize reports frame bytes per sample for a 100-sample
+ * batch with Arg 0 (float32) and 1 (half precision). BM_ImuMessageSerialize
+ * does the same for single ImuData messages, Arg 0 with NativeCodec and 1
+ * with HalfImuCodec.
+ */
+
+#include <benchmark/benchmark.h>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include "sensorstreamkit/core/half_float.hpp"
+#include "sensorstreamkit/core/half_imu_codec.hpp"
+#include "sensorstreamkit/core/message.hpp"
+
+using namespace sensorstreamkit::core;
+
+namespace {
+
+constexpr size_t kValues = 64 * 1024;
+
+std::vector<float> make_values() {
+    std::mt19937 rng(3);
+    std::normal_distribution<float> reading(0.0f, 4.0f);
+    std::vector<float> values(kValues);
+    for (float& value : values) value = reading(rng);
+    return values;
+}
+
+}  // namespace
+
+static void BM_FloatCopy(benchmark::State& state) {
+    const auto values = make_values();
+    std::vector<float> copy(kValues);
+
+    for (auto _ : state) {
+        std::memcpy(copy.data(), values.data(), kValues * sizeof(float));
+        benchmark::DoNotOptimize(copy.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * kValues * sizeof(float));
+}
+BENCHMARK(BM_FloatCopy);
+
+static void BM_HalfEncodeScalar(benchmark::State& state) {
+    const auto values = make_values();
+    std::vector<uint16_t> encoded(kValues);
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < kValues; ++i) encoded[i] = half_float::from_float(values[i]);
+        benchmark::DoNotOptimize(encoded.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * kValues * sizeof(float));
+}
+BENCHMARK(BM_HalfEncodeScalar);
+
+static void BM_HalfEncodeBulk(benchmark::State& state) {
+    const auto values = make_values();
+    std::vector<uint8_t> encoded(kValues * sizeof(uint16_t));
+
+    for (auto _ : state) {
+        half_float::encode(encoded.data(), values.data(), kValues);
+        benchmark::DoNotOptimize(encoded.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * kValues * sizeof(float));
+}
+BENCHMARK(BM_HalfEncodeBulk);
+
+static void BM_HalfDecodeScalar(benchmark::State& state) {
+    const auto values = make_values();
+    std::vector<uint16_t> encoded(kValues);
+    for (size_t i = 0; i < kValues; ++i) encoded[i] = half_float::from_float(values[i]);
+    std::vector<float> decoded(kValues);
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < kValues; ++i) decoded[i] = half_float::to_float(encoded[i]);
+        benchmark::DoNotOptimize(decoded.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * kValues * sizeof(float));
+}
+BENCHMARK(BM_HalfDecodeScalar);
+
+static void BM_HalfDecodeBulk(benchmark::State& state) {
+    const auto values = make_values();
+    std::vector<uint8_t> encoded(kValues * sizeof(uint16_t));
+    half_float::encode(encoded.data(), values.data(), kValues);
+    std::vector<float> decoded(kValues);
+
+    for (auto _ : state) {
+        half_float::decode(decoded.data(), encoded.data(), kValues);
+        benchmark::DoNotOptimize(decoded.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * kValues * sizeof(float));
+}
+BENCHMARK(BM_HalfDecodeBulk);
+
+static void BM_ImuBatchSerialize(benchmark::State& state) {
+    const auto values = make_values();
+    ImuBatch batch{.sensor_id_ = "imu_main"};
+    for (size_t i = 0; i < 100; ++i) {
+        batch.samples.push_back(ImuSample{
+            .timestamp_ns = 1'000'000'000ull + i * 1'000'000ull,
+            .accel_x = values[6 * i],
+            .accel_y = values[6 * i + 1],
+            .accel_z = 9.81f + values[6 * i + 2],
+            .gyro_x = values[6 * i + 3],
+            .gyro_y = values[6 * i + 4],
+            .gyro_z = values[6 * i + 5]
+        });
+    }
+    batch.samples.set_half_precision(state.range(0) != 0);
+    const Message<ImuBatch> message(batch);
+    std::vector<uint8_t> buffer(message.serialized_size());
+
+    for (auto _ : state) {
+        message.serialize_into(buffer);
+        benchmark::DoNotOptimize(buffer.data());
+    }
+    state.SetItemsProcessed(state.iterations() * batch.samples.size());
+    state.counters["bytes_per_sample"] = static_cast<double>(buffer.size()) / batch.samples.size();
+}
+BENCHMARK(BM_ImuBatchSerialize)->Arg(0)->Arg(1);
+
+template <typename Codec>
+static void imu_message_serialize(benchmark::State& state) {
+    const auto values = make_values();
+    const Message<ImuData, Codec> message(ImuData{
+        .sensor_id_ = "imu_main",
+        .timestamp_ns_ = 1'000'000'000ull,
+        .accel_x = values[0],
+        .accel_y = values[1],
+        .accel_z = 9.81f + values[2],
+        .gyro_x = values[3],
+        .gyro_y = values[4],
+        .gyro_z = values[5]
+    });
+    std::vector<uint8_t> buffer(message.serialized_size());
+
+    for (auto _ : state) {
+        message.serialize_into(buffer);
+        benchmark::DoNotOptimize(buffer.data());
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.counters["bytes_per_message"] = static_cast<double>(buffer.size());
+}
+
+static void BM_ImuMessageSerialize(benchmark::State& state) {
+    if (state.range(0) == 0) {
+        imu_message_serialize<NativeCodec>(state);
+    } else {
+        imu_message_serialize<HalfImuCodec>(state);
+    }
+}
+BENCHMARK(BM_ImuMessageSerialize)->Arg(0)->Arg(1);
@@ -0,0 +1,95 @@
+/**
+ * @file bench_header_extensions.cpp
+ * @brief IMU frames without header extensions vs with a trace id and deadline
+ * @author Jo, SeungHyeon (Jo,SH)
+ *
+ * The plain case is the baseline every stream pays: it must stay the
+ * fixed 16-byte header path. The extended case adds a 16-byte trace id
+ * and a u64 deadline (32 bytes of entries). Decode reuses one Message, as
+ * ZmqSubscriber::receive_into() does, so the entries' buffer is allocated
+ * once and then only refilled.
+ */
+
+#include <benchmark/benchmark.h>
+#include <array>
+#include <vector>
+
+#include "alloc_counter.hpp"
+#include "sensorstreamkit/core/message.hpp"
+
+using namespace sensorstreamkit::core;
+using sensorstreamkit::bench::allocation_count;
+
+namespace {
+
+Message<ImuData> make_message(bool extended) {
+    Message<ImuData> message(ImuData{
+        .sensor_id_ = "vehicle_07/imu_front_left",
+        .timestamp_ns_ = 1'700'000'000'000'000'000ull,
+        .accel_x = 0.1f,
+        .accel_y = 0.2f,
+        .accel_z = 9.81f,
+        .gyro_x = 0.01f,
+        .gyro_y = 0.02f,
+        .gyro_z = 0.03f
+    });
+    if (extended) {
+        const std::array<uint8_t, 16> trace_id{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16};
+        message.extensions().add(HeaderExtensions::kTraceId, trace_id);
+        message.extensions().add(HeaderExtensions::kDeadlineNs, uint64_t{1'700'000'000'005'000'000ull});
+    }
+    return message;
+}
+
+void report(benchmark::State& state, uint64_t allocs_before, size_t wire_bytes) {
+    state.counters["allocs/msg"] = benchmark::Counter(
+        static_cast<double>(allocation_count() - allocs_before),
+        benchmark::Counter::kAvgIterations);
+    state.counters["wire_bytes"] = static_cast<double>(wire_bytes);
+}
+
+}  // namespace
+
+// ============================================================================
+// Encode
+// ============================================================================
+
+static void BM_Encode(benchmark::State& state) {
+    const auto message = make_message(state.range(0) != 0);
+    std::vector<uint8_t> buffer(message.serialized_size());
+    const uint64_t before = allocation_count();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(message.serialize_into(buffer));
+        benchmark::ClobberMemory();
+    }
+    report(state, before, buffer.size());
+}
+BENCHMARK(BM_Encode)->ArgName("extended")->Arg(0)->Arg(1);
+
+// ============================================================================
+// Decode (reused target)
+// ============================================================================
+
+static void BM_Decode(benchmark::State& state) {
+    std::vector<uint8_t> buffer;
+    make_message(state.range(0) != 0).serialize(buffer);
+    Message<ImuData> target;
+    Message<ImuData>::deserialize_into(buffer, target);
+    const uint64_t before = allocation_count();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Message<ImuData>::deserialize_into(buffer, target));
+        benchmark::DoNotOptimize(target.payload().accel_z);
+    }
+    report(state, before, buffer.size());
+}
+BENCHMARK(BM_Decode)->ArgName("extended")->Arg(0)->Arg(1);
+
+static void BM_FindDeadline(benchmark::State& state) {
+    std::vector<uint8_t> buffer;
+    make_message(true).serialize(buffer);
+    const auto decoded = Message<ImuData>::deserialize(buffer);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(decoded->extensions().get<uint64_t>(HeaderExtensions::kDeadlineNs));
+    }
+}
+BENCHMARK(BM_FindDeadline);
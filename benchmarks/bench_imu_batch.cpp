@@ -0,0 +1,114 @@
+/**
+ * @file bench_imu_batch.cpp
+ * @brief One second of 1 kHz IMU data: single ImuData messages vs ImuBatch
+ * @author Jo, SeungHyeon (Jo,SH)
+ *
+ * Each iteration publishes 1000 samples over loopback TCP and receives
+ * them on the other side. The single case sends one Message<ImuData> per
+ * sample, the batched cases one Message<ImuBatch> per Arg samples.
+ * items_per_second counts samples, messages_per_second ZeroMQ messages.
+ * CPU time / 1000 is the per-sample cost of publishing and receiving in
+ * this thread; ZeroMQ's I/O thread is not included.
+ */
+
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#include "sensorstreamkit/core/message.hpp"
+#include "sensorstreamkit/transport/zmq_publisher.hpp"
+#include "sensorstreamkit/transport/zmq_subscriber.hpp"
+
+using namespace sensorstreamkit::core;
+using namespace sensorstreamkit::transport;
+
+namespace {
+
+constexpr int kSamplesPerIteration = 1000;
+
+ImuData make_sample(int i) {
+    return ImuData{
+        .sensor_id_ = "vehicle_07/imu_front_left_chassis",
+        .timestamp_ns_ = 1'000'000'000ull + static_cast<uint64_t>(i) * 1'000'000ull,
+        .accel_x = 0.1f,
+        .accel_y = 0.2f,
+        .accel_z = 9.81f,
+        .gyro_x = 0.01f,
+        .gyro_y = 0.02f,
+        .gyro_z = 0.03f
+    };
+}
+
+/**
+ * @brief Connected publisher/subscriber pair on a port of its own
+ */
+struct Link {
+    explicit Link(int port)
+        : publisher(PublisherConfig{.endpoint = "tcp://127.0.0.1:" + std::to_string(port),
+                                    .high_water_mark = 10 * kSamplesPerIteration})
+        , subscriber(SubscriberConfig{.endpoint = "tcp://127.0.0.1:" + std::to_string(port),
+                                      .high_water_mark = 10 * kSamplesPerIteration}) {
+        if (!publisher.bind() || !subscriber.connect() || !subscriber.subscribe("imu")) {
+            throw std::runtime_error("link setup failed");
+        }
+        // Let the subscription reach the publisher
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    }
+
+    ZmqPublisher publisher;
+    ZmqSubscriber subscriber;
+};
+
+}  // namespace
+
+static void BM_ImuSingleMessages(benchmark::State& state) {
+    Link link(17100);
+    Message<ImuData> received;
+
+    for (auto _ : state) {
+        for (int i = 0; i < kSamplesPerIteration; ++i) {
+            link.publisher.publish("imu", Message<ImuData>(make_sample(i)));
+        }
+        for (int i = 0; i < kSamplesPerIteration; ++i) {
+            if (!link.subscriber.receive_into(received)) {
+                state.SkipWithError("message lost");
+                return;
+            }
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * kSamplesPerIteration);
+    state.counters["messages_per_second"] = benchmark::Counter(
+        static_cast<double>(state.iterations() * kSamplesPerIteration), benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_ImuSingleMessages)->Unit(benchmark::kMicrosecond);
+
+static void BM_ImuBatches(benchmark::State& state) {
+    const auto batch_size = static_cast<int>(state.range(0));
+    Link link(17101 + batch_size);
+    Message<ImuBatch> received;
+    ImuBatch batch{.sensor_id_ = "vehicle_07/imu_front_left_chassis"};
+    batch.samples.reserve(static_cast<size_t>(batch_size));
+
+    const int batches = kSamplesPerIteration / batch_size;
+    for (auto _ : state) {
+        for (int b = 0; b < batches; ++b) {
+            batch.samples.clear();
+            for (int i = 0; i < batch_size; ++i) {
+                batch.push_back(make_sample(b * batch_size + i));
+            }
+            link.publisher.publish("imu", Message<ImuBatch>(batch));
+        }
+        for (int b = 0; b < batches; ++b) {
+            if (!link.subscriber.receive_into(received)) {
+                state.SkipWithError("message lost");
+                return;
+            }
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * kSamplesPerIteration);
+    state.counters["messages_per_second"] = benchmark::Counter(
+        static_cast<double>(state.iterations() * batches), benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_ImuBatches)->Arg(10)->Arg(100)->Arg(1000)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,128 @@
+/**
+ * @file bench_inline_string.cpp
+ * @brief ImuData (std::string id) vs the same payload with an InlineString id
+ * @author Jo, SeungHyeon (Jo,SH)
+ *
+ * The id is 25 characters, past libstdc++'s 15-character small string
+ * buffer, so every std::string copy allocates. CompactImuData is trivially
+ * copyable and Message<T> copies it to and from the wire as one 64-byte
+ * block. Deserialize builds a fresh Message each time, like
+ * ZmqSubscriber::receive(); Copy hands 1024 payloads to a
+ * preallocated queue, as a producer thread would.
+ */
+
+#include <benchmark/benchmark.h>
+#include <vector>
+
+#include "sensorstreamkit/core/message.hpp"
+
+using namespace sensorstreamkit::core;
+
+namespace {
+
+constexpr char kSensorId[] = "vehicle_07/imu_front_left";
+constexpr size_t kQueueSize = 1024;
+
+struct CompactImuData {
+    InlineString<31> sensor_id_;
+    uint64_t timestamp_ns_{0};
+    float accel_x{0.0f};
+    float accel_y{0.0f};
+    float accel_z{0.0f};
+    float gyro_x{0.0f};
+    float gyro_y{0.0f};
+    float gyro_z{0.0f};
+
+    static constexpr auto fields() noexcept {
+        return std::tuple{field<&CompactImuData::sensor_id_>, field<&CompactImuData::timestamp_ns_>,
+                          field<&CompactImuData::accel_x>, field<&CompactImuData::accel_y>,
+                          field<&CompactImuData::accel_z>, field<&CompactImuData::gyro_x>,
+                          field<&CompactImuData::gyro_y>, field<&CompactImuData::gyro_z>};
+    }
+
+    [[nodiscard]] uint64_t timestamp_ns() const noexcept { return timestamp_ns_; }
+    [[nodiscard]] std::string_view sensor_id() const noexcept { return sensor_id_; }
+
+    [[nodiscard]] size_t serialized_size() const noexcept { return serialization::serialized_size(*this); }
+    void serialize(std::vector<uint8_t>& buffer) const {
+        const size_t offset = buffer.size();
+        buffer.resize(offset + serialized_size());
+        serialize_into(MutablePayload(buffer).subspan(offset));
+    }
+    size_t serialize_into(MutablePayload out) const noexcept { return serialization::serialize_into(*this, out); }
+    static std::optional<CompactImuData> deserialize(ConstPayload data) {
+        return serialization::deserialize<CompactImuData>(data);
+    }
+    static bool deserialize_into(ConstPayload data, CompactImuData& out) {
+        return serialization::deserialize_into(data, out);
+    }
+};
+
+template <typename T>
+T make_payload() {
+    T payload;
+    payload.sensor_id_ = kSensorId;
+    payload.timestamp_ns_ = 1'700'000'000'000'000'000ull;
+    payload.accel_x = 0.1f;
+    payload.accel_y = 0.2f;
+    payload.accel_z = 9.81f;
+    payload.gyro_x = 0.01f;
+    payload.gyro_y = 0.02f;
+    payload.gyro_z = 0.03f;
+    return payload;
+}
+
+template <typename T>
+void serialize(benchmark::State& state) {
+    const Message<T> message(make_payload<T>());
+    std::vector<uint8_t> buffer(message.serialized_size());
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(message.serialize_into(buffer));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.counters["frame_bytes"] = static_cast<double>(buffer.size());
+}
+
+template <typename T>
+void deserialize(benchmark::State& state) {
+    std::vector<uint8_t> buffer;
+    Message<T>(make_payload<T>()).serialize(buffer);
+
+    for (auto _ : state) {
+        auto message = Message<T>::deserialize(buffer);
+        benchmark::DoNotOptimize(message);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+template <typename T>
+void copy_to_queue(benchmark::State& state) {
+    const T payload = make_payload<T>();
+    std::vector<T> queue(kQueueSize);
+
+    for (auto _ : state) {
+        for (T& slot : queue) slot = payload;
+        benchmark::DoNotOptimize(queue.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * kQueueSize);
+}
+
+}  // namespace
+
+static void BM_SerializeStringId(benchmark::State& state) { serialize<ImuData>(state); }
+static void BM_SerializeInlineId(benchmark::State& state) { serialize<CompactImuData>(state); }
+BENCHMARK(BM_SerializeStringId);
+BENCHMARK(BM_SerializeInlineId);
+
+static void BM_DeserializeStringId(benchmark::State& state) { deserialize<ImuData>(state); }
+static void BM_DeserializeInlineId(benchmark::State& state) { deserialize<CompactImuData>(state); }
+BENCHMARK(BM_DeserializeStringId);
+BENCHMARK(BM_DeserializeInlineId);
+
+static void BM_CopyStringId(benchmark::State& state) { copy_to_queue<ImuData>(state); }
+static void BM_CopyInlineId(benchmark::State& state) { copy_to_queue<CompactImuData>(state); }
+BENCHMARK(BM_CopyStringId);
+BENCHMARK(BM_CopyInlineId);
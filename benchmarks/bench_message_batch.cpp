@@ -0,0 +1,84 @@
+/**
+ * @file bench_message_batch.cpp
+ * @brief Decoding a batch of messages on the heap vs into a MessageBatch arena
+ * @author Jo, SeungHyeon (Jo,SH)
+ *
+ * Each iteration decodes 64 ImuData frames, as a receive loop draining a
+ * busy socket would. The ids are 25 characters, past libstdc++'s
+ * 15-character small string buffer. Heap builds a fresh Message per frame
+ * and frees it with the batch, as a vector of ZmqSubscriber::receive()
+ * results would; Arena appends to a MessageBatch and clears it, so the
+ * ids are bump-allocated and released all at once. allocs/msg counts
+ * operator new calls per decoded message.
+ */
+
+#include <benchmark/benchmark.h>
+#include <string>
+#include <vector>
+
+#include "alloc_counter.hpp"
+#include "sensorstreamkit/core/message_batch.hpp"
+
+using namespace sensorstreamkit::core;
+using sensorstreamkit::bench::allocation_count;
+
+namespace {
+
+constexpr size_t kBatchSize = 64;
+
+std::vector<std::vector<uint8_t>> make_frames() {
+    std::vector<std::vector<uint8_t>> frames(kBatchSize);
+    for (size_t i = 0; i < frames.size(); ++i) {
+        ImuData data;
+        data.sensor_id_ = "vehicle_07/imu_" + std::to_string(100000000 + i);
+        data.timestamp_ns_ = 1'700'000'000'000'000'000ull + i;
+        data.accel_z = 9.81f;
+        Message<ImuData>(data).serialize(frames[i]);
+    }
+    return frames;
+}
+
+void report_allocations(benchmark::State& state, uint64_t before) {
+    state.counters["allocs/msg"] = benchmark::Counter(
+        static_cast<double>(allocation_count() - before) / kBatchSize,
+        benchmark::Counter::kAvgIterations);
+}
+
+}  // namespace
+
+static void BM_BatchDecodeHeap(benchmark::State& state) {
+    const auto frames = make_frames();
+    std::vector<Message<ImuData>> batch;
+    batch.reserve(kBatchSize);
+
+    const uint64_t before = allocation_count();
+    for (auto _ : state) {
+        batch.clear();
+        for (const auto& frame : frames) {
+            batch.push_back(*Message<ImuData>::deserialize(frame));
+        }
+        benchmark::DoNotOptimize(batch.data());
+        benchmark::ClobberMemory();
+    }
+    report_allocations(state, before);
+    state.SetItemsProcessed(state.iterations() * kBatchSize);
+}
+BENCHMARK(BM_BatchDecodeHeap);
+
+static void BM_BatchDecodeArena(benchmark::State& state) {
+    const auto frames = make_frames();
+    MessageBatch<ImuData> batch;
+
+    const uint64_t before = allocation_count();
+    for (auto _ : state) {
+        batch.clear();
+        for (const auto& frame : frames) {
+            batch.append(frame);
+        }
+        benchmark::DoNotOptimize(&batch[0]);
+        benchmark::ClobberMemory();
+    }
+    report_allocations(state, before);
+    state.SetItemsProcessed(state.iterations() * kBatchSize);
+}
+BENCHMARK(BM_BatchDecodeArena);
@@ -0,0 +1,138 @@
+/**
+ * @file bench_message_view.cpp
+ * @brief Owning Message<T>::deserialize vs in-place deserialize_into vs
+ *        zero-copy MessageView<T>::from
+ * @author Jo, SeungHyeon (Jo,SH)
+ *
+ * Reports "allocs/msg" alongside time so the zero-allocation claims of the
+ * view and in-place paths are verified, not assumed. Sensor ids are longer than the
+ * libstdc++/libc++ SSO capacity to reflect real fleet naming.
+ */
+
+#include <benchmark/benchmark.h>
+#include <vector>
+
+#include "alloc_counter.hpp"
+#include "sensorstreamkit/core/message.hpp"
+#include "sensorstreamkit/core/message_view.hpp"
+
+using namespace sensorstreamkit::core;
+using sensorstreamkit::bench::allocation_count;
+
+namespace {
+
+std::vector<uint8_t> make_imu_buffer() {
+    ImuData imu{
+        .sensor_id_ = "vehicle_07/imu_front_left_chassis",
+        .timestamp_ns_ = 1234567890,
+        .accel_x = 0.1f,
+        .accel_y = 0.2f,
+        .accel_z = 9.81f,
+        .gyro_x = 0.01f,
+        .gyro_y = 0.02f,
+        .gyro_z = 0.03f
+    };
+    std::vector<uint8_t> buffer;
+    Message<ImuData>(imu).serialize(buffer);
+    return buffer;
+}
+
+std::vector<uint8_t> make_camera_buffer() {
+    CameraFrameData frame{
+        .sensor_id_ = "vehicle_07/camera_front_wide_angle",
+        .timestamp_ns_ = 1234567890,
+        .frame_id = 42,
+        .width = 1920,
+        .height = 1080,
+        .encoding = "BAYER_RGGB8"
+    };
+    std::vector<uint8_t> buffer;
+    Message<CameraFrameData>(frame).serialize(buffer);
+    return buffer;
+}
+
+void report_allocations(benchmark::State& state, uint64_t before) {
+    state.counters["allocs/msg"] = benchmark::Counter(
+        static_cast<double>(allocation_count() - before),
+        benchmark::Counter::kAvgIterations);
+}
+
+}  // namespace
+
+// ============================================================================
+// ImuData
+// ============================================================================
+
+static void BM_ImuDeserialize(benchmark::State& state) {
+    const auto buffer = make_imu_buffer();
+    const uint64_t before = allocation_count();
+    for (auto _ : state) {
+        auto msg = Message<ImuData>::deserialize(buffer);
+        benchmark::DoNotOptimize(msg->payload().accel_z);
+    }
+    report_allocations(state, before);
+}
+BENCHMARK(BM_ImuDeserialize);
+
+static void BM_ImuDeserializeInto(benchmark::State& state) {
+    const auto buffer = make_imu_buffer();
+    Message<ImuData> msg;
+    const uint64_t before = allocation_count();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Message<ImuData>::deserialize_into(buffer, msg));
+        benchmark::DoNotOptimize(msg.payload().accel_z);
+    }
+    report_allocations(state, before);
+}
+BENCHMARK(BM_ImuDeserializeInto);
+
+static void BM_ImuMessageView(benchmark::State& state) {
+    const auto buffer = make_imu_buffer();
+    const uint64_t before = allocation_count();
+    for (auto _ : state) {
+        auto view = MessageView<ImuData>::from(buffer);
+        benchmark::DoNotOptimize(view->payload().accel_z());
+        benchmark::DoNotOptimize(view->payload().sensor_id().size());
+    }
+    report_allocations(state, before);
+}
+BENCHMARK(BM_ImuMessageView);
+
+// ============================================================================
+// CameraFrameData
+// ============================================================================
+
+static void BM_CameraDeserialize(benchmark::State& state) {
+    const auto buffer = make_camera_buffer();
+    const uint64_t before = allocation_count();
+    for (auto _ : state) {
+        auto msg = Message<CameraFrameData>::deserialize(buffer);
+        benchmark::DoNotOptimize(msg->payload().width);
+    }
+    report_allocations(state, before);
+}
+BENCHMARK(BM_CameraDeserialize);
+
+static void BM_CameraDeserializeInto(benchmark::State& state) {
+    const auto buffer = make_camera_buffer();
+    Message<CameraFrameData> msg;
+    const uint64_t before = allocation_count();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Message<CameraFrameData>::deserialize_into(buffer, msg));
+        benchmark::DoNotOptimize(msg.payload().width);
+    }
+    report_allocations(state, before);
+}
+BENCHMARK(BM_CameraDeserializeInto);
+
+static void BM_CameraMessageView(benchmark::State& state) {
+    const auto buffer = make_camera_buffer();
+    const uint64_t before = allocation_count();
+    for (auto _ : state) {
+        auto view = MessageView<CameraFrameData>::from(buffer);
+        benchmark::DoNotOptimize(view->payload().width());
+        benchmark::DoNotOptimize(view->payload().encoding().size());
+    }
+    report_allocations(state, before);
+}
+BENCHMARK(BM_CameraMessageView);
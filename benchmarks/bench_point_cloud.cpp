@@ -0,0 +1,113 @@
+/**
+ * @file bench_point_cloud.cpp
+ * @brief Encoding and decoding a 128-beam lidar scan: float32 vs int16 SoA columns
+ * @author Jo, SeungHyeon (Jo,SH)
+ *
+ * The scan has 128 rings x 2048 columns = 262144 points. The AoS case
+ * copies the same points as a packed array of float x/y/z/intensity/time
+ * plus uint16 ring, the layout many drivers hand out, as a size and
+ * bandwidth reference. wire_bytes_per_point shows what each layout costs
+ * on the wire. The single-column case decodes only z from a received
+ * frame, as a ground filter would.
+ */
+
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+#include "sensorstreamkit/core/message.hpp"
+#include "sensorstreamkit/core/message_view.hpp"
+#include "sensorstreamkit/core/point_cloud.hpp"
+
+using namespace sensorstreamkit::core;
+
+namespace {
+
+constexpr uint16_t kRings = 128;
+constexpr uint32_t kColumns = 2048;
+constexpr size_t kPoints = size_t{kRings} * kColumns;
+constexpr float kResolution = 0.005f;
+
+struct AosPoint {
+    float x, y, z, intensity;
+    uint16_t ring;
+    float time_offset;
+};
+
+LidarScanData make_scan(float resolution) {
+    LidarScanData scan{.sensor_id_ = "lidar_roof", .num_points = kPoints, .scan_duration_ms = 100.0f};
+    scan.points.reserve(kPoints);
+    for (uint32_t column = 0; column < kColumns; ++column) {
+        const float azimuth = static_cast<float>(column) * (6.2831853f / kColumns);
+        for (uint16_t ring = 0; ring < kRings; ++ring) {
+            const float range = 5.0f + static_cast<float>((column * 31 + ring * 17) % 1000) * 0.1f;
+            const float elevation = -0.4f + static_cast<float>(ring) * (0.8f / kRings);
+            scan.points.push_back(LidarPoint{
+                .x = range * std::cos(elevation) * std::cos(azimuth),
+                .y = range * std::cos(elevation) * std::sin(azimuth),
+                .z = range * std::sin(elevation),
+                .intensity = static_cast<uint16_t>(column + ring),
+                .ring = ring,
+                .time_offset_ns = column * 48828
+            });
+        }
+    }
+    scan.points.set_resolution(resolution);
+    return scan;
+}
+
+std::vector<uint8_t> serialize_scan(const LidarScanData& scan) {
+    std::vector<uint8_t> buffer;
+    Message<LidarScanData>(scan).serialize(buffer);
+    return buffer;
+}
+
+}  // namespace
+
+static void BM_AosCopy(benchmark::State& state) {
+    const std::vector<AosPoint> points(kPoints, AosPoint{1.0f, 2.0f, 3.0f, 4.0f, 5, 6.0f});
+    std::vector<uint8_t> wire(kPoints * sizeof(AosPoint));
+    for (auto _ : state) {
+        std::memcpy(wire.data(), points.data(), wire.size());
+        benchmark::DoNotOptimize(wire.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(kPoints));
+    state.counters["wire_bytes_per_point"] = static_cast<double>(sizeof(AosPoint));
+}
+BENCHMARK(BM_AosCopy)->Unit(benchmark::kMicrosecond);
+
+// Arg: 0 = float32 coordinates, 1 = int16 quantized
+static void BM_SerializeScan(benchmark::State& state) {
+    const Message<LidarScanData> message(make_scan(state.range(0) ? kResolution : 0.0f));
+    std::vector<uint8_t> buffer(message.serialized_size());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(message.serialize_into(buffer));
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(kPoints));
+    state.counters["wire_bytes_per_point"] = static_cast<double>(buffer.size()) / kPoints;
+}
+BENCHMARK(BM_SerializeScan)->Arg(0)->Arg(1)->Unit(benchmark::kMicrosecond);
+
+static void BM_DeserializeScan(benchmark::State& state) {
+    const auto buffer = serialize_scan(make_scan(state.range(0) ? kResolution : 0.0f));
+    Message<LidarScanData> target;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Message<LidarScanData>::deserialize_into(buffer, target));
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(kPoints));
+    state.counters["wire_bytes_per_point"] = static_cast<double>(buffer.size()) / kPoints;
+}
+BENCHMARK(BM_DeserializeScan)->Arg(0)->Arg(1)->Unit(benchmark::kMicrosecond);
+
+static void BM_ViewDecodeZ(benchmark::State& state) {
+    const auto buffer = serialize_scan(make_scan(kResolution));
+    std::vector<float> z(kPoints);
+    for (auto _ : state) {
+        auto view = MessageView<LidarScanData>::from(buffer);
+        view->payload().points().decode(PointCloud::Axis::Z, z);
+        benchmark::DoNotOptimize(z.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(kPoints));
+}
+BENCHMARK(BM_ViewDecodeZ)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,127 @@
+/**
+ * @file bench_publish.cpp
+ * @brief Publish throughput of small IMU frames through ZmqPublisher, one by one and in batches
+ * @author Jo, SeungHyeon (Jo,SH)
+ *
+ * Frames go to a PUB socket bound on inproc with no subscriber, so the
+ * socket is always writable and ZeroMQ drops each message after queueing
+ * it: what is left is the publisher's own per-message overhead (writability
+ * check, topic part, send calls, counter).
+ */
+
+#include <benchmark/benchmark.h>
+#include <string>
+#include <vector>
+
+#include "sensorstreamkit/transport/zmq_publisher.hpp"
+
+using namespace sensorstreamkit::core;
+using namespace sensorstreamkit::transport;
+
+namespace {
+
+ImuData make_imu() {
+    return ImuData{
+        .sensor_id_ = "imu_front",
+        .timestamp_ns_ = 1'700'000'000'000'000'000ull,
+        .accel_x = 0.1f,
+        .accel_y = 0.2f,
+        .accel_z = 9.81f,
+        .gyro_x = 0.01f,
+        .gyro_y = 0.02f,
+        .gyro_z = 0.03f
+    };
+}
+
+PublisherConfig config(const std::string& name) {
+    return PublisherConfig{.endpoint = "inproc://bench_publish_" + name};
+}
+
+}  // namespace
+
+// ============================================================================
+// Single messages
+// ============================================================================
+
+static void BM_PublishRaw(benchmark::State& state) {
+    ZmqPublisher publisher(config("raw"));
+    if (!publisher.bind()) {
+        state.SkipWithError("bind failed");
+        return;
+    }
+    std::vector<uint8_t> frame;
+    Message<ImuData>(make_imu()).serialize(frame);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(publisher.publish_raw("imu", frame));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_PublishRaw);
+
+static void BM_PublishMessage(benchmark::State& state) {
+    ZmqPublisher publisher(config("message"));
+    if (!publisher.bind()) {
+        state.SkipWithError("bind failed");
+        return;
+    }
+    const Message<ImuData> message(make_imu());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(publisher.publish("imu", message));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_PublishMessage);
+
+// ============================================================================
+// Batches
+// ============================================================================
+
+static void BM_PublishRawLoop(benchmark::State& state) {
+    const auto count = static_cast<size_t>(state.range(0));
+    ZmqPublisher publisher(config("raw_loop"));
+    if (!publisher.bind()) {
+        state.SkipWithError("bind failed");
+        return;
+    }
+    std::vector<uint8_t> frame;
+    Message<ImuData>(make_imu()).serialize(frame);
+    for (auto _ : state) {
+        for (size_t i = 0; i < count; ++i) {
+            benchmark::DoNotOptimize(publisher.publish_raw("imu", frame));
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+}
+BENCHMARK(BM_PublishRawLoop)->Arg(16)->Arg(64);
+
+static void BM_PublishRawBatch(benchmark::State& state) {
+    const auto count = static_cast<size_t>(state.range(0));
+    ZmqPublisher publisher(config("raw_batch"));
+    if (!publisher.bind()) {
+        state.SkipWithError("bind failed");
+        return;
+    }
+    std::vector<uint8_t> frame;
+    Message<ImuData>(make_imu()).serialize(frame);
+    const std::vector<OutgoingMessage> batch(count, OutgoingMessage{"imu", frame});
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(publisher.publish_batch(batch));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+}
+BENCHMARK(BM_PublishRawBatch)->Arg(16)->Arg(64);
+
+static void BM_PublishMessageBatch(benchmark::State& state) {
+    const auto count = static_cast<size_t>(state.range(0));
+    ZmqPublisher publisher(config("message_batch"));
+    if (!publisher.bind()) {
+        state.SkipWithError("bind failed");
+        return;
+    }
+    const std::vector<Message<ImuData>> messages(count, Message<ImuData>(make_imu()));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(publisher.publish_batch("imu", messages));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+}
+BENCHMARK(BM_PublishMessageBatch)->Arg(16)->Arg(64);
@@ -0,0 +1,111 @@
+/**
+ * @file bench_send_buffer_pool.cpp
+ * @brief Outgoing frames in fresh libzmq buffers vs SendBufferPool blocks
+ * @author Jo, SeungHyeon (Jo,SH)
+ *
+ * Buffer: get a frame of the given size, write every byte, release it,
+ * as one steady-state publish does. Publish: ZmqPublisher::publish() of a
+ * LidarScanData to a PUB socket with no subscriber, so ZeroMQ drops and
+ * releases each frame right away, with pooling on and off.
+ *
+ * allocs/msg counts operator new only. libzmq allocates fresh frames with
+ * malloc, so that cost shows in the time; pool_allocs/msg is the number
+ * of blocks the pool had to take from the heap, which is 0 once warm.
+ */
+
+#include <benchmark/benchmark.h>
+#include <cstring>
+#include <string>
+
+#include "alloc_counter.hpp"
+#include "sensorstreamkit/transport/send_buffer_pool.hpp"
+#include "sensorstreamkit/transport/zmq_publisher.hpp"
+
+using namespace sensorstreamkit::core;
+using namespace sensorstreamkit::transport;
+using sensorstreamkit::bench::allocation_count;
+
+namespace {
+
+void report(benchmark::State& state, uint64_t allocs_before, uint64_t pool_before, uint64_t pool_after,
+            size_t frame_bytes) {
+    state.counters["allocs/msg"] = benchmark::Counter(
+        static_cast<double>(allocation_count() - allocs_before), benchmark::Counter::kAvgIterations);
+    state.counters["pool_allocs/msg"] = benchmark::Counter(
+        static_cast<double>(pool_after - pool_before), benchmark::Counter::kAvgIterations);
+    state.counters["frame_bytes"] = static_cast<double>(frame_bytes);
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * frame_bytes));
+}
+
+LidarScanData make_scan(size_t points) {
+    LidarScanData scan{.sensor_id_ = "lidar_top", .timestamp_ns_ = 1'700'000'000'000'000'000ull,
+                       .num_points = static_cast<uint32_t>(points), .scan_duration_ms = 100.0f};
+    scan.points.resize(points);
+    return scan;
+}
+
+}  // namespace
+
+// ============================================================================
+// Buffer acquire, fill, release
+// ============================================================================
+
+static void BM_BufferFresh(benchmark::State& state) {
+    const auto size = static_cast<size_t>(state.range(0));
+    const uint64_t before = allocation_count();
+    for (auto _ : state) {
+        zmq::message_t msg(size);
+        std::memset(msg.data(), 0x5A, size);
+        benchmark::DoNotOptimize(msg.data());
+    }
+    report(state, before, 0, 0, size);
+}
+BENCHMARK(BM_BufferFresh)->Arg(4 << 10)->Arg(64 << 10)->Arg(1 << 20);
+
+static void BM_BufferPooled(benchmark::State& state) {
+    const auto size = static_cast<size_t>(state.range(0));
+    SendBufferPool pool;
+    {
+        zmq::message_t warm;
+        pool.rebuild(warm, size);
+    }
+    const uint64_t before = allocation_count();
+    const uint64_t pool_before = pool.blocks_allocated();
+    for (auto _ : state) {
+        zmq::message_t msg;
+        pool.rebuild(msg, size);
+        std::memset(msg.data(), 0x5A, size);
+        benchmark::DoNotOptimize(msg.data());
+    }
+    report(state, before, pool_before, pool.blocks_allocated(), size);
+}
+BENCHMARK(BM_BufferPooled)->Arg(4 << 10)->Arg(64 << 10)->Arg(1 << 20);
+
+// ============================================================================
+// Publish
+// ============================================================================
+
+static void BM_PublishLidar(benchmark::State& state) {
+    const bool pooled = state.range(0) != 0;
+    const auto points = static_cast<size_t>(state.range(1));
+    ZmqPublisher publisher(PublisherConfig{
+        .endpoint = "inproc://bench_send_buffer_pool_" + std::to_string(state.range(0)) + "_" +
+                    std::to_string(points),
+        .pool_send_buffers = pooled});
+    if (!publisher.bind()) {
+        state.SkipWithError("bind failed");
+        return;
+    }
+
+    const Message<LidarScanData> message(make_scan(points));
+    publisher.publish("lidar", message);
+    const uint64_t before = allocation_count();
+    const uint64_t pool_before = publisher.send_buffers().blocks_allocated();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(publisher.publish("lidar", message));
+    }
+    report(state, before, pool_before, publisher.send_buffers().blocks_allocated(), message.serialized_size());
+}
+BENCHMARK(BM_PublishLidar)
+    ->ArgNames({"pooled", "points"})
+    ->ArgsProduct({{0, 1}, {256, 4096, 65536}});
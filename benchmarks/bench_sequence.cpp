@@ -0,0 +1,75 @@
+/**
+ * @file bench_sequence.cpp
+ * @brief One shared sequence counter vs per-stream counters under contention
+ * @author Jo, SeungHyeon (Jo,SH)
+ *
+ * The shared case reproduces the previous Message<T>::next_sequence(): one
+ * static counter per payload type, so N camera threads all increment the
+ * same cache line. In the per-stream case each thread publishes its own
+ * sensor and only touches its own counter.
+ */
+
+#include <benchmark/benchmark.h>
+#include <string>
+
+#include "sensorstreamkit/core/message.hpp"
+
+using namespace sensorstreamkit::core;
+
+namespace {
+
+std::string sensor_for_thread(int thread_index) {
+    return "vehicle_07/camera_" + std::to_string(thread_index);
+}
+
+}  // namespace
+
+// ============================================================================
+// Counter only
+// ============================================================================
+
+static void BM_SharedCounter(benchmark::State& state) {
+    static SequenceCounter counter;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(counter.next());
+    }
+}
+BENCHMARK(BM_SharedCounter)->ThreadRange(1, 8)->UseRealTime();
+
+static void BM_PerStreamCounter(benchmark::State& state) {
+    static SequenceStreams streams;
+    const std::string sensor = sensor_for_thread(state.thread_index());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(streams.next(sensor));
+    }
+}
+BENCHMARK(BM_PerStreamCounter)->ThreadRange(1, 8)->UseRealTime();
+
+static void BM_PerStreamCounterCached(benchmark::State& state) {
+    static SequenceStreams streams;
+    SequenceCounter& counter = streams.stream(sensor_for_thread(state.thread_index()));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(counter.next());
+    }
+}
+BENCHMARK(BM_PerStreamCounterCached)->ThreadRange(1, 8)->UseRealTime();
+
+// ============================================================================
+// Message construction (timestamp + sequence)
+// ============================================================================
+
+static void BM_CameraMessageConstruct(benchmark::State& state) {
+    const CameraFrameData frame{
+        .sensor_id_ = std::pmr::string(sensor_for_thread(state.thread_index())),
+        .timestamp_ns_ = 1234567890,
+        .frame_id = 42,
+        .width = 1920,
+        .height = 1080,
+        .encoding = "BAYER_RGGB8"
+    };
+    for (auto _ : state) {
+        Message<CameraFrameData> msg(frame);
+        benchmark::DoNotOptimize(msg.header().sequence_number);
+    }
+}
+BENCHMARK(BM_CameraMessageConstruct)->ThreadRange(1, 8)->UseRealTime();
@@ -0,0 +1,251 @@
+/**
+ * @file bench_serialization.cpp
+ * @brief Descriptor-generated serializers vs the previous hand-written ones,
+ *        and inline vs interned (StringRegistry) strings
+ * @author Jo, SeungHyeon (Jo,SH)
+ *
+ * The hand-written baseline reproduces the per-field memcpy chains that
+ * message.cpp used before payloads declared fields(). It is kept out of
+ * line so it is called the same way as the generated member functions in
+ * the library, rather than being inlined into the benchmark loop.
+ */
+
+#include <benchmark/benchmark.h>
+#include <cstring>
+#include <optional>
+#include <vector>
+
+#include "sensorstreamkit/core/message.hpp"
+
+using namespace sensorstreamkit::core;
+
+namespace {
+
+ImuData make_imu() {
+    return ImuData{
+        .sensor_id_ = "vehicle_07/imu_front_left_chassis",
+        .timestamp_ns_ = 1234567890,
+        .accel_x = 0.1f,
+        .accel_y = 0.2f,
+        .accel_z = 9.81f,
+        .gyro_x = 0.01f,
+        .gyro_y = 0.02f,
+        .gyro_z = 0.03f
+    };
+}
+
+CameraFrameData make_camera() {
+    return CameraFrameData{
+        .sensor_id_ = "vehicle_07/camera_front_wide_angle",
+        .timestamp_ns_ = 1234567890,
+        .frame_id = 42,
+        .width = 1920,
+        .height = 1080,
+        .encoding = "BAYER_RGGB8"
+    };
+}
+
+// ============================================================================
+// Hand-written baseline
+// ============================================================================
+
+namespace handwritten {
+
+template <typename U>
+uint8_t* write_field(uint8_t* dst, const U& value) noexcept {
+    std::memcpy(dst, &value, sizeof(U));
+    return dst + sizeof(U);
+}
+
+uint8_t* write_string(uint8_t* dst, std::string_view str) noexcept {
+    dst = write_field(dst, static_cast<uint32_t>(str.size()));
+    std::memcpy(dst, str.data(), str.size());
+    return dst + str.size();
+}
+
+[[gnu::noinline]] size_t serialize_into(const ImuData& imu, MutablePayload out) noexcept {
+    const size_t required_size = sizeof(uint32_t) + imu.sensor_id_.size() + sizeof(uint64_t) + 6 * sizeof(float);
+    if (out.size() < required_size) return 0;
+
+    uint8_t* dst = out.data();
+    dst = write_string(dst, imu.sensor_id_);
+    dst = write_field(dst, imu.timestamp_ns_);
+    dst = write_field(dst, imu.accel_x);
+    dst = write_field(dst, imu.accel_y);
+    dst = write_field(dst, imu.accel_z);
+    dst = write_field(dst, imu.gyro_x);
+    dst = write_field(dst, imu.gyro_y);
+    write_field(dst, imu.gyro_z);
+    return required_size;
+}
+
+[[gnu::noinline]] std::optional<ImuData> deserialize(ConstPayload data) {
+    if (data.size() < sizeof(uint32_t)) return std::nullopt;
+
+    ImuData result;
+    size_t offset = 0;
+
+    uint32_t id_len;
+    std::memcpy(&id_len, data.data() + offset, sizeof(id_len));
+    offset += sizeof(id_len);
+    if (data.size() < offset + id_len) return std::nullopt;
+    result.sensor_id_.assign(reinterpret_cast<const char*>(data.data() + offset), id_len);
+    offset += id_len;
+
+    if (data.size() < offset + sizeof(uint64_t) + 6 * sizeof(float)) return std::nullopt;
+    std::memcpy(&result.timestamp_ns_, data.data() + offset, sizeof(result.timestamp_ns_));
+    offset += sizeof(result.timestamp_ns_);
+    std::memcpy(&result.accel_x, data.data() + offset, sizeof(result.accel_x));
+    offset += sizeof(result.accel_x);
+    std::memcpy(&result.accel_y, data.data() + offset, sizeof(result.accel_y));
+    offset += sizeof(result.accel_y);
+    std::memcpy(&result.accel_z, data.data() + offset, sizeof(result.accel_z));
+    offset += sizeof(result.accel_z);
+    std::memcpy(&result.gyro_x, data.data() + offset, sizeof(result.gyro_x));
+    offset += sizeof(result.gyro_x);
+    std::memcpy(&result.gyro_y, data.data() + offset, sizeof(result.gyro_y));
+    offset += sizeof(result.gyro_y);
+    std::memcpy(&result.gyro_z, data.data() + offset, sizeof(result.gyro_z));
+    return result;
+}
+
+[[gnu::noinline]] size_t serialize_into(const CameraFrameData& frame, MutablePayload out) noexcept {
+    const size_t required_size = sizeof(uint32_t) + frame.sensor_id_.size() + sizeof(uint64_t) +
+                                 3 * sizeof(uint32_t) + sizeof(uint32_t) + frame.encoding.size();
+    if (out.size() < required_size) return 0;
+
+    uint8_t* dst = out.data();
+    dst = write_string(dst, frame.sensor_id_);
+    dst = write_field(dst, frame.timestamp_ns_);
+    dst = write_field(dst, frame.frame_id);
+    dst = write_field(dst, frame.width);
+    dst = write_field(dst, frame.height);
+    write_string(dst, frame.encoding);
+    return required_size;
+}
+
+}  // namespace handwritten
+
+}  // namespace
+
+// ============================================================================
+// ImuData
+// ============================================================================
+
+static void BM_ImuSerializeHandwritten(benchmark::State& state) {
+    const auto imu = make_imu();
+    std::vector<uint8_t> buffer(imu.serialized_size());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(handwritten::serialize_into(imu, buffer));
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_ImuSerializeHandwritten);
+
+static void BM_ImuSerializeGenerated(benchmark::State& state) {
+    const auto imu = make_imu();
+    std::vector<uint8_t> buffer(imu.serialized_size());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(imu.serialize_into(buffer));
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_ImuSerializeGenerated);
+
+static void BM_ImuDeserializeHandwritten(benchmark::State& state) {
+    std::vector<uint8_t> buffer;
+    make_imu().serialize(buffer);
+    for (auto _ : state) {
+        auto imu = handwritten::deserialize(buffer);
+        benchmark::DoNotOptimize(imu->gyro_z);
+    }
+}
+BENCHMARK(BM_ImuDeserializeHandwritten);
+
+static void BM_ImuDeserializeGenerated(benchmark::State& state) {
+    std::vector<uint8_t> buffer;
+    make_imu().serialize(buffer);
+    for (auto _ : state) {
+        auto imu = ImuData::deserialize(buffer);
+        benchmark::DoNotOptimize(imu->gyro_z);
+    }
+}
+BENCHMARK(BM_ImuDeserializeGenerated);
+
+// ============================================================================
+// CameraFrameData
+// ============================================================================
+
+static void BM_CameraSerializeHandwritten(benchmark::State& state) {
+    const auto frame = make_camera();
+    std::vector<uint8_t> buffer(frame.serialized_size());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(handwritten::serialize_into(frame, buffer));
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_CameraSerializeHandwritten);
+
+static void BM_CameraSerializeGenerated(benchmark::State& state) {
+    const auto frame = make_camera();
+    std::vector<uint8_t> buffer(frame.serialized_size());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(frame.serialize_into(buffer));
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_CameraSerializeGenerated);
+
+// ============================================================================
+// Interned strings (StringRegistry)
+// ============================================================================
+
+static void BM_ImuMessageSerializeInline(benchmark::State& state) {
+    const Message<ImuData> msg(make_imu());
+    std::vector<uint8_t> buffer(msg.serialized_size());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(msg.serialize_into(buffer));
+        benchmark::ClobberMemory();
+    }
+    state.counters["wire_bytes"] = static_cast<double>(buffer.size());
+}
+BENCHMARK(BM_ImuMessageSerializeInline);
+
+static void BM_ImuMessageSerializeInterned(benchmark::State& state) {
+    const Message<ImuData> msg(make_imu());
+    StringRegistry strings;
+    strings.intern(msg.payload().sensor_id_);
+    std::vector<uint8_t> buffer(msg.serialized_size(strings));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(msg.serialize_into(buffer, strings));
+        benchmark::ClobberMemory();
+    }
+    state.counters["wire_bytes"] = static_cast<double>(buffer.size());
+}
+BENCHMARK(BM_ImuMessageSerializeInterned);
+
+static void BM_ImuMessageDeserializeIntoInline(benchmark::State& state) {
+    std::vector<uint8_t> buffer;
+    Message<ImuData>(make_imu()).serialize(buffer);
+    Message<ImuData> msg;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Message<ImuData>::deserialize_into(buffer, msg));
+        benchmark::DoNotOptimize(msg.payload().gyro_z);
+    }
+}
+BENCHMARK(BM_ImuMessageDeserializeIntoInline);
+
+static void BM_ImuMessageDeserializeIntoInterned(benchmark::State& state) {
+    const Message<ImuData> original(make_imu());
+    StringRegistry strings;
+    strings.intern(original.payload().sensor_id_);
+    std::vector<uint8_t> buffer(original.serialized_size(strings));
+    original.serialize_into(buffer, strings);
+
+    Message<ImuData> msg;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Message<ImuData>::deserialize_into(buffer, msg, strings));
+        benchmark::DoNotOptimize(msg.payload().gyro_z);
+    }
+}
+BENCHMARK(BM_ImuMessageDeserializeIntoInterned);
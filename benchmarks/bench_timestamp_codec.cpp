@@ -0,0 +1,85 @@
+/**
+ * @file bench_timestamp_codec.cpp
+ * @brief Timestamp columns: raw uint64 copy vs timestamp_codec
+ * @author Jo, SeungHyeon (Jo,SH)
+ *
+ * Arg is the jitter in ns around a 1 kHz grid: 0 (perfectly regular),
+ * 50 (1-byte residuals), 8000 (2-byte) and 500000 (4-byte).
+ * bytes_per_timestamp is the encoded size; bytes_per_second on the decode
+ * benchmarks counts decoded uint64 output, to compare with the raw copy.
+ */
+
+#include <benchmark/benchmark.h>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include "sensorstreamkit/core/timestamp_codec.hpp"
+
+using namespace sensorstreamkit::core;
+
+namespace {
+
+constexpr size_t kTimestamps = 100'000;
+
+std::vector<uint64_t> make_timestamps(int64_t jitter_ns) {
+    std::mt19937_64 rng(7);
+    std::uniform_int_distribution<int64_t> jitter(-jitter_ns, jitter_ns);
+    std::vector<uint64_t> timestamps(kTimestamps);
+    for (size_t i = 0; i < kTimestamps; ++i) {
+        timestamps[i] = 1'700'000'000'000'000'000ull + i * 1'000'000ull + static_cast<uint64_t>(jitter(rng));
+    }
+    return timestamps;
+}
+
+}  // namespace
+
+static void BM_TimestampsRawCopy(benchmark::State& state) {
+    const auto timestamps = make_timestamps(0);
+    std::vector<uint64_t> copy(kTimestamps);
+
+    for (auto _ : state) {
+        std::memcpy(copy.data(), timestamps.data(), kTimestamps * sizeof(uint64_t));
+        benchmark::DoNotOptimize(copy.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * kTimestamps * sizeof(uint64_t));
+    state.counters["bytes_per_timestamp"] = sizeof(uint64_t);
+}
+BENCHMARK(BM_TimestampsRawCopy);
+
+static void BM_TimestampsEncode(benchmark::State& state) {
+    const auto timestamps = make_timestamps(state.range(0));
+    std::vector<uint8_t> buffer(timestamp_codec::Plan::kHeaderBytes + kTimestamps * sizeof(uint64_t));
+    size_t size = 0;
+
+    for (auto _ : state) {
+        const auto plan = timestamp_codec::plan(timestamps);
+        size = static_cast<size_t>(timestamp_codec::encode(buffer.data(), plan, timestamps) - buffer.data());
+        benchmark::DoNotOptimize(buffer.data());
+    }
+    state.SetItemsProcessed(state.iterations() * kTimestamps);
+    state.counters["bytes_per_timestamp"] = static_cast<double>(size) / kTimestamps;
+}
+BENCHMARK(BM_TimestampsEncode)->Arg(0)->Arg(50)->Arg(8'000)->Arg(500'000);
+
+static void BM_TimestampsDecode(benchmark::State& state) {
+    const auto timestamps = make_timestamps(state.range(0));
+    const auto plan = timestamp_codec::plan(timestamps);
+    std::vector<uint8_t> buffer(timestamp_codec::encoded_size(plan, kTimestamps));
+    timestamp_codec::encode(buffer.data(), plan, timestamps);
+    std::vector<uint64_t> decoded(kTimestamps);
+
+    for (auto _ : state) {
+        size_t offset = 0;
+        if (!timestamp_codec::decode(buffer, offset, decoded)) {
+            state.SkipWithError("decode failed");
+            return;
+        }
+        benchmark::DoNotOptimize(decoded.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * kTimestamps * sizeof(uint64_t));
+    state.counters["bytes_per_timestamp"] = static_cast<double>(buffer.size()) / kTimestamps;
+}
+BENCHMARK(BM_TimestampsDecode)->Arg(0)->Arg(50)->Arg(8'000)->Arg(500'000);
@@ -0,0 +1,94 @@
+/**
+ * @file bench_zmq_context.cpp
+ * @brief Thread count and throughput: a context per socket vs one shared context
+ * @author Jo, SeungHyeon (Jo,SH)
+ *
+ * Each stream is a publisher and a subscriber joined over TCP loopback, so
+ * every message crosses the contexts' I/O threads. An iteration publishes
+ * one small frame on every stream and receives each of them.
+ *
+ * io_threads:0 gives every socket its own context, as before ZmqContext;
+ * otherwise all sockets share one context with that many I/O threads.
+ * threads is the process's thread count while the streams are open
+ * (Linux only, 0 elsewhere): each context adds its I/O threads and a
+ * reaper thread.
+ */
+
+#include <benchmark/benchmark.h>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "sensorstreamkit/transport/zmq_context.hpp"
+#include "sensorstreamkit/transport/zmq_publisher.hpp"
+#include "sensorstreamkit/transport/zmq_subscriber.hpp"
+
+using namespace sensorstreamkit::transport;
+
+namespace {
+
+int process_threads() {
+    std::ifstream status("/proc/self/status");
+    std::string key;
+    while (status >> key) {
+        if (key == "Threads:") {
+            int threads = 0;
+            status >> threads;
+            return threads;
+        }
+    }
+    return 0;
+}
+
+struct Stream {
+    std::unique_ptr<ZmqPublisher> publisher;
+    std::unique_ptr<ZmqSubscriber> subscriber;
+};
+
+}  // namespace
+
+// ============================================================================
+// Streams over TCP loopback
+// ============================================================================
+
+static void BM_Streams(benchmark::State& state) {
+    static int next_port = 17500;
+    const auto streams = static_cast<size_t>(state.range(0));
+    const auto io_threads = static_cast<int>(state.range(1));
+    std::shared_ptr<ZmqContext> context;
+    if (io_threads > 0) {
+        context = std::make_shared<ZmqContext>(ContextConfig{.io_threads = io_threads});
+    }
+
+    std::vector<Stream> open;
+    for (size_t i = 0; i < streams; ++i) {
+        const std::string port = std::to_string(next_port++);
+        Stream stream{
+            std::make_unique<ZmqPublisher>(PublisherConfig{.endpoint = "tcp://127.0.0.1:" + port, .context = context}),
+            std::make_unique<ZmqSubscriber>(SubscriberConfig{.endpoint = "tcp://127.0.0.1:" + port, .context = context})};
+        if (!stream.publisher->bind() || !stream.subscriber->connect() || !stream.subscriber->subscribe("imu")) {
+            state.SkipWithError("socket setup failed");
+            return;
+        }
+        open.push_back(std::move(stream));
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));  // Let the subscriptions arrive
+
+    const std::vector<uint8_t> frame(64, 0x5A);
+    for (auto _ : state) {
+        for (auto& stream : open) {
+            stream.publisher->publish_raw("imu", frame);
+        }
+        for (auto& stream : open) {
+            benchmark::DoNotOptimize(stream.subscriber->receive_raw());
+        }
+    }
+    state.counters["threads"] = process_threads();
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * streams));
+}
+BENCHMARK(BM_Streams)
+    ->ArgNames({"streams", "io_threads"})
+    ->ArgsProduct({{4, 20}, {0, 1, 2, 4}})
+    ->UseRealTime();
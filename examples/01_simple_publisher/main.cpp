@@ -31,7 +31,7 @@ public:
 
     CameraFrameData generate() {
         return CameraFrameData{
-            .sensor_id_ = sensor_id_,
+            .sensor_id_ = std::pmr::string(sensor_id_),
             .timestamp_ns_ = Timestamp::now().nanoseconds(),
             .frame_id = frame_counter_++,
             .width = 1920,
@@ -0,0 +1,70 @@
+#pragma once
+
+/**
+ * @file aligned_allocator.hpp
+ * @brief Allocator for containers whose data must start on a cache line
+ * @author Jo, SeungHyeon (Jo,SH)
+ * @date 2025
+ *
+ * Columns of samples (see ImuSamples, PointCloud) are processed with
+ * vector loads. Starting them on a 64-byte boundary lets those loads be
+ * aligned and keeps a column from sharing its first cache line with other
+ * data. AlignedBuffer does the same for serialized frames.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <vector>
+
+namespace sensorstreamkit::core {
+
+inline constexpr size_t kCacheLineSize = 64;
+
+template <typename T, size_t Alignment = kCacheLineSize>
+struct AlignedAllocator {
+    static_assert(Alignment >= alignof(T) && (Alignment & (Alignment - 1)) == 0,
+                  "alignment must be a power of two no smaller than alignof(T)");
+
+    using value_type = T;
+
+    // Needed because Alignment is a non-type parameter
+    template <typename U>
+    struct rebind {
+        using other = AlignedAllocator<U, Alignment>;
+    };
+
+    AlignedAllocator() noexcept = default;
+
+    template <typename U>
+    AlignedAllocator(const AlignedAllocator<U, Alignment>&) noexcept {}
+
+    [[nodiscard]] T* allocate(size_t count) {
+        if (count > static_cast<size_t>(-1) / sizeof(T)) {
+            throw std::bad_array_new_length();
+        }
+        return static_cast<T*>(::operator new(count * sizeof(T), std::align_val_t{Alignment}));
+    }
+
+    void deallocate(T* ptr, size_t) noexcept {
+        ::operator delete(ptr, std::align_val_t{Alignment});
+    }
+
+    template <typename U>
+    bool operator==(const AlignedAllocator<U, Alignment>&) const noexcept { return true; }
+};
+
+/**
+ * @brief std::vector whose data() is cache-line aligned
+ */
+template <typename T>
+using AlignedVector = std::vector<T, AlignedAllocator<T>>;
+
+/**
+ * @brief Byte buffer for frames, e.g. Message<T>::serialize() or ZmqSubscriber::receive_raw()
+ *
+ * The header starts on a cache line, so the payload starts 16 bytes in.
+ */
+using AlignedBuffer = AlignedVector<uint8_t>;
+
+}  // namespace sensorstreamkit::core
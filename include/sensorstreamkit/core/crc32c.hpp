@@ -0,0 +1,47 @@
+#pragma once
+
+/**
+ * @file crc32c.hpp
+ * @brief CRC32C (Castagnoli) checksums for message integrity
+ * @author Jo, SeungHyeon (Jo,SH)
+ * @date 2025
+ *
+ * Uses the SSE4.2 crc32 instruction when the CPU has it (selected once at
+ * startup) and ARMv8 CRC32 when built for it. Otherwise it falls back to
+ * a slicing-by-8 table. All paths produce the same values, e.g.
+ * compute("123456789") == 0xE3069283.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace sensorstreamkit::core::crc32c {
+
+/**
+ * @brief Continue a checksum over size more bytes
+ *
+ * crc is a finished checksum (0 to start), so
+ * extend(extend(0, a), b) == compute(a + b).
+ */
+[[nodiscard]] uint32_t extend(uint32_t crc, const uint8_t* data, size_t size) noexcept;
+
+[[nodiscard]] inline uint32_t compute(std::span<const uint8_t> data) noexcept {
+    return extend(0, data.data(), data.size());
+}
+
+/**
+ * @brief memcpy that extends crc over the copied bytes in the same pass
+ *
+ * Copies in blocks that stay in L1, so large field codecs can checksum
+ * without reading their source a second time.
+ * @return dst + size
+ */
+uint8_t* copy(uint8_t* dst, const uint8_t* src, size_t size, uint32_t& crc) noexcept;
+
+/**
+ * @brief True if extend() uses a CRC instruction rather than the table
+ */
+[[nodiscard]] bool hardware_accelerated() noexcept;
+
+}  // namespace sensorstreamkit::core::crc32c
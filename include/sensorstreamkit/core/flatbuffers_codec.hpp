@@ -0,0 +1,309 @@
+#pragma once
+
+/**
+ * @file flatbuffers_codec.hpp
+ * @brief FlatBuffers wire format for Message<T> with in-place reads
+ * @author Jo, SeungHyeon (Jo,SH)
+ * @date 2025
+ *
+ * Alternative to the memcpy codec in message.hpp, using the schema in
+ * proto/sensor_data.fbs. The encoded buffer carries the MessageHeader as
+ * an inline struct and the payload as a union member, so a receiver can
+ * read every field straight out of the received bytes.
+ */
+
+#include <flatbuffers/flatbuffers.h>
+#include <cstring>
+#include <optional>
+#include <span>
+#include <string_view>
+
+#include "sensorstreamkit/core/message.hpp"
+#include "sensorstreamkit/core/point_cloud.hpp"
+#include "sensorstreamkit/generated/sensor_data_generated.h"
+
+namespace sensorstreamkit::core {
+
+namespace detail {
+
+/**
+ * @brief View a (possibly absent) FlatBuffers string without copying
+ */
+[[nodiscard]] inline std::string_view to_string_view(const flatbuffers::String* str) noexcept {
+    return str ? std::string_view(str->c_str(), str->size()) : std::string_view{};
+}
+
+/**
+ * @brief View a (possibly absent) FlatBuffers byte vector without copying
+ */
+[[nodiscard]] inline std::span<const uint8_t> to_span(const flatbuffers::Vector<uint8_t>* vec) noexcept {
+    return vec ? std::span<const uint8_t>(vec->data(), vec->size()) : std::span<const uint8_t>{};
+}
+
+// MessageHeader flags this encoding implements: none. Checksums,
+// attachments and extensions are sections of the native frame only.
+inline constexpr uint16_t kFlatBufferFlags = 0;
+
+}  // namespace detail
+
+
+// ============================================================================
+// Payload Mapping
+// ============================================================================
+
+/**
+ * @brief Maps a payload struct to its table in proto/sensor_data.fbs
+ *
+ * assign() overwrites an existing payload and reuses its string and
+ * column capacity (and allocator), like NativeCodec's deserialize_into();
+ * to_owned() builds a new one.
+ */
+template <SensorDataType T>
+struct FlatBufferTraits;
+
+template <>
+struct FlatBufferTraits<CameraFrameData> {
+    using Table = fbs::CameraFrameData;
+    static constexpr fbs::SensorPayload payload_type = fbs::SensorPayload::CameraFrameData;
+
+    static flatbuffers::Offset<Table> build(flatbuffers::FlatBufferBuilder& builder, const CameraFrameData& data);
+    [[nodiscard]] static CameraFrameData to_owned(const Table& table);
+    static void assign(const Table& table, CameraFrameData& out);
+};
+
+template <>
+struct FlatBufferTraits<LidarScanData> {
+    using Table = fbs::LidarScanData;
+    static constexpr fbs::SensorPayload payload_type = fbs::SensorPayload::LidarScanData;
+
+    static flatbuffers::Offset<Table> build(flatbuffers::FlatBufferBuilder& builder, const LidarScanData& data);
+    [[nodiscard]] static LidarScanData to_owned(const Table& table);
+    static void assign(const Table& table, LidarScanData& out);
+
+    /**
+     * @brief The point cloud, read in place; nullopt if its bytes are malformed
+     */
+    [[nodiscard]] static std::optional<PointCloudView> points(const Table& table) noexcept;
+
+    // The Verifier only bounds-checks the cloud's bytes, not their layout
+    [[nodiscard]] static bool verify(const Table& table) noexcept { return points(table).has_value(); }
+};
+
+template <>
+struct FlatBufferTraits<ImuData> {
+    using Table = fbs::ImuData;
+    static constexpr fbs::SensorPayload payload_type = fbs::SensorPayload::ImuData;
+
+    static flatbuffers::Offset<Table> build(flatbuffers::FlatBufferBuilder& builder, const ImuData& data);
+    [[nodiscard]] static ImuData to_owned(const Table& table);
+    static void assign(const Table& table, ImuData& out);
+};
+
+/**
+ * @brief Concept for payload types that have a FlatBuffers table
+ */
+template <typename T>
+concept FlatBufferPayload = SensorDataType<T> && requires {
+    typename FlatBufferTraits<T>::Table;
+    { FlatBufferTraits<T>::payload_type } -> std::convertible_to<fbs::SensorPayload>;
+};
+
+
+// ============================================================================
+// In-Place View
+// ============================================================================
+
+/**
+ * @brief Non-owning view over a FlatBuffers-encoded Message<T>
+ *
+ * payload() returns the generated table, whose accessors read directly
+ * from the underlying buffer. The view is only valid while that buffer
+ * is alive.
+ */
+template <FlatBufferPayload T>
+class FlatBufferView {
+public:
+    using Table = typename FlatBufferTraits<T>::Table;
+
+    /**
+     * @brief Verify the buffer (offsets, bounds, alignment) and check the payload type
+     *
+     * Also rejects headers with flags set, since no flagged section is
+     * encoded, and payload bytes the schema does not describe (a lidar
+     * cloud) if they are malformed.
+     */
+    [[nodiscard]] static std::optional<FlatBufferView> from(ConstPayload data) noexcept {
+        flatbuffers::Verifier verifier(data.data(), data.size());
+        if (!fbs::VerifySensorMessageBuffer(verifier)) return std::nullopt;
+        return from_root(data);
+    }
+
+    /**
+     * @brief Skip the Verifier pass; only for buffers from a trusted publisher
+     *
+     * Checks the file identifier, header flags and payload type, but a
+     * malformed buffer results in out-of-bounds reads.
+     */
+    [[nodiscard]] static std::optional<FlatBufferView> from_trusted(ConstPayload data) noexcept {
+        if (data.size() < sizeof(flatbuffers::uoffset_t) + flatbuffers::kFileIdentifierLength) return std::nullopt;
+        if (!fbs::SensorMessageBufferHasIdentifier(data.data())) return std::nullopt;
+        return from_root(data);
+    }
+
+    [[nodiscard]] MessageHeader header() const noexcept {
+        const auto* h = root_->header();
+        return MessageHeader{h->timestamp_ns(), h->sequence_number(), h->message_type(), h->flags()};
+    }
+
+    [[nodiscard]] const Table& payload() const noexcept { return *payload_; }
+
+    [[nodiscard]] std::string_view sensor_id() const noexcept { return detail::to_string_view(payload_->sensor_id()); }
+    [[nodiscard]] uint64_t timestamp_ns() const noexcept { return payload_->timestamp_ns(); }
+
+    /**
+     * @brief Raw bytes this view points into
+     */
+    [[nodiscard]] ConstPayload bytes() const noexcept { return bytes_; }
+
+    /**
+     * @brief Materialize an owning Message<T> (allocates)
+     */
+    [[nodiscard]] Message<T> to_message() const {
+        return Message<T>(header(), FlatBufferTraits<T>::to_owned(*payload_));
+    }
+
+private:
+    FlatBufferView(const fbs::SensorMessage* root, const Table* payload, ConstPayload bytes) noexcept
+        : root_(root), payload_(payload), bytes_(bytes) {}
+
+    [[nodiscard]] static std::optional<FlatBufferView> from_root(ConstPayload data) noexcept {
+        const auto* root = fbs::GetSensorMessage(data.data());
+        if (root->header() == nullptr) return std::nullopt;
+        // A flagged section would be missing from the buffer, not just unread
+        if (root->header()->flags() & ~detail::kFlatBufferFlags) return std::nullopt;
+
+        // nullptr unless the union holds T's table
+        const auto* payload = root->payload_as<Table>();
+        if (payload == nullptr) return std::nullopt;
+        if constexpr (requires { FlatBufferTraits<T>::verify(*payload); }) {
+            if (!FlatBufferTraits<T>::verify(*payload)) return std::nullopt;
+        }
+
+        return FlatBufferView(root, payload, data);
+    }
+
+    const fbs::SensorMessage* root_;
+    const Table* payload_;
+    ConstPayload bytes_;
+};
+
+
+// ============================================================================
+// Codec
+// ============================================================================
+
+/**
+ * @brief Encode/decode Message<T> with the FlatBuffers schema
+ *
+ * Also a MessageCodec, so a stream can be typed Message<T, FlatBufferCodec>
+ * and go through the same publish()/receive() calls as native messages.
+ * encoded_size() builds the buffer in a per-thread builder and keeps it,
+ * keyed on the header and the payload's address. An encode() that follows
+ * for the same header and payload object copies that build out instead of
+ * building again, so Message::serialize() builds once. The kept build is
+ * used at most once; the payload must not change between the two calls.
+ *
+ * Header flags are not encoded: the schema has no checksum, attachment or
+ * extension sections, so e.g. set_checksum(true) has no effect here.
+ */
+struct FlatBufferCodec {
+    /**
+     * @brief Encode message into builder (cleared first, so it can be reused)
+     * @return The finished buffer, owned by builder until its next use
+     */
+    template <FlatBufferPayload T, typename Codec>
+    static ConstPayload encode(const Message<T, Codec>& message, flatbuffers::FlatBufferBuilder& builder) {
+        return build(builder, message.header(), message.payload());
+    }
+
+    /**
+     * @brief Verify and copy into an owning Message<T>
+     */
+    template <FlatBufferPayload T>
+    [[nodiscard]] static std::optional<Message<T>> decode(ConstPayload data) {
+        auto view = FlatBufferView<T>::from(data);
+        if (!view) return std::nullopt;
+        return view->to_message();
+    }
+
+    // MessageCodec interface. Not noexcept: build() grows the builder, by
+    // megabytes for a camera frame with pixels, and may throw std::bad_alloc
+
+    template <FlatBufferPayload T>
+    [[nodiscard]] static size_t encoded_size(const MessageHeader& header, const T& payload) {
+        ScratchBuild& scratch = scratch_build();
+        scratch.payload = nullptr;  // Nothing to reuse if build() throws
+        const size_t size = build(scratch.builder, header, payload).size();
+        scratch.header = header;
+        scratch.payload = &payload;
+        return size;
+    }
+
+    template <FlatBufferPayload T>
+    static size_t encode(const MessageHeader& header, const T& payload, MutablePayload out) {
+        ScratchBuild& scratch = scratch_build();
+        const bool reuse = scratch.payload == &payload && scratch.header == header;
+        scratch.payload = nullptr;
+        const ConstPayload bytes = reuse ? ConstPayload{scratch.builder.GetBufferPointer(), scratch.builder.GetSize()}
+                                         : build(scratch.builder, header, payload);
+        if (out.size() < bytes.size()) return 0;
+        std::memcpy(out.data(), bytes.data(), bytes.size());
+        return bytes.size();
+    }
+
+    template <FlatBufferPayload T>
+    static bool decode(ConstPayload data, MessageHeader& header, T& payload) {
+        auto view = FlatBufferView<T>::from(data);
+        if (!view) return false;
+        header = view->header();
+        FlatBufferTraits<T>::assign(view->payload(), payload);
+        return true;
+    }
+
+private:
+    template <FlatBufferPayload T>
+    static ConstPayload build(flatbuffers::FlatBufferBuilder& builder, const MessageHeader& h, const T& data) {
+        builder.Clear();
+
+        // Flags for sections the buffer does not carry would make readers expect them
+        const auto flags = static_cast<uint16_t>(h.flags & detail::kFlatBufferFlags);
+        const fbs::MessageHeader header(h.timestamp_ns, h.sequence_number, h.message_type, flags);
+
+        auto payload = FlatBufferTraits<T>::build(builder, data);
+        auto root = fbs::CreateSensorMessage(builder, &header, FlatBufferTraits<T>::payload_type, payload.Union());
+        fbs::FinishSensorMessageBuffer(builder, root);
+
+        return {builder.GetBufferPointer(), builder.GetSize()};
+    }
+
+    // Per-thread builder, and what its last encoded_size() built (payload nullptr: nothing)
+    struct ScratchBuild {
+        flatbuffers::FlatBufferBuilder builder;
+        MessageHeader header{};
+        const void* payload{nullptr};
+    };
+
+    static ScratchBuild& scratch_build() noexcept {
+        thread_local ScratchBuild scratch;
+        return scratch;
+    }
+};
+
+// Verify concepts are satisfied
+static_assert(FlatBufferPayload<CameraFrameData>);
+static_assert(FlatBufferPayload<LidarScanData>);
+static_assert(FlatBufferPayload<ImuData>);
+static_assert(MessageCodec<FlatBufferCodec, ImuData>);
+static_assert(!InterningCodec<FlatBufferCodec, ImuData>);
+
+}  // namespace sensorstreamkit::core
@@ -0,0 +1,46 @@
+#pragma once
+
+/**
+ * @file half_float.hpp
+ * @brief IEEE 754 binary16 conversion, one value or whole columns
+ * @author Jo, SeungHyeon (Jo,SH)
+ * @date 2025
+ *
+ * Half floats keep 11 significant bits (about 3 decimal digits) up to
+ * ±65504, enough for accelerometer and gyroscope readings once sensor
+ * noise is accounted for, at half the bytes of float32.
+ *
+ * Bulk conversion uses F16C on x86-64 CPUs that have it (checked at run
+ * time) and NEON on AArch64, with a scalar fallback. All paths round to
+ * nearest, ties to even, and give bit-identical results, including for
+ * infinities, NaNs and subnormals.
+ */
+
+#include <cstddef>
+#include <cstdint>
+
+namespace sensorstreamkit::core::half_float {
+
+/**
+ * @brief Round value to the nearest half float (bits)
+ *
+ * Values beyond ±65504 become infinity; NaNs stay NaN (quieted).
+ */
+[[nodiscard]] uint16_t from_float(float value) noexcept;
+
+/**
+ * @brief Exact float value of half float bits
+ */
+[[nodiscard]] float to_float(uint16_t bits) noexcept;
+
+/**
+ * @brief Write count floats as little-endian half floats; dst need not be aligned
+ */
+void encode(uint8_t* dst, const float* src, size_t count) noexcept;
+
+/**
+ * @brief Expand count half floats at src (unaligned) to float
+ */
+void decode(float* dst, const uint8_t* src, size_t count) noexcept;
+
+}  // namespace sensorstreamkit::core::half_float
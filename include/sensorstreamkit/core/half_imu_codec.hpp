@@ -0,0 +1,49 @@
+#pragma once
+
+/**
+ * @file half_imu_codec.hpp
+ * @brief Message codec for single IMU readings with half precision values
+ * @author Jo, SeungHyeon (Jo,SH)
+ * @date 2025
+ *
+ * The per-topic counterpart of ImuSamples::set_half_precision() for
+ * topics that carry one ImuData per message:
+ *
+ *   header | u8 id size | id | u64 timestamp_ns | accel_x .. gyro_z as half floats
+ *
+ * 37 bytes plus the id, against 52 plus the id for NativeCodec. Unlike a
+ * half precision batch, the frame does not say it is half precision:
+ * publisher and subscribers of a topic both name the codec, e.g.
+ * Message<ImuData, HalfImuCodec> and receive<ImuData, HalfImuCodec>().
+ */
+
+#include <cstddef>
+#include <cstdint>
+
+#include "sensorstreamkit/core/message.hpp"
+
+namespace sensorstreamkit::core {
+
+/**
+ * @brief ImuData with accel and gyro as IEEE half floats (see file comment)
+ *
+ * Values read back are rounded to 11 significant bits. Header flags are
+ * not encoded: there is no checksum or extension section, and decode()
+ * rejects frames with flags set.
+ */
+struct HalfImuCodec {
+    static constexpr size_t kReadingBytes = 6 * sizeof(uint16_t);
+
+    [[nodiscard]] static size_t encoded_size(const MessageHeader& header, const ImuData& payload) noexcept;
+
+    /**
+     * @return Bytes written, or 0 if out is too small or the id is over 255 bytes
+     */
+    static size_t encode(const MessageHeader& header, const ImuData& payload, MutablePayload out) noexcept;
+
+    static bool decode(ConstPayload data, MessageHeader& header, ImuData& payload);
+};
+
+static_assert(MessageCodec<HalfImuCodec, ImuData>);
+
+}  // namespace sensorstreamkit::core
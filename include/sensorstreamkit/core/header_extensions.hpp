@@ -0,0 +1,145 @@
+#pragma once
+
+/**
+ * @file header_extensions.hpp
+ * @brief Optional type-length-value entries carried after the message header
+ * @author Jo, SeungHyeon (Jo,SH)
+ * @date 2025
+ *
+ * Metadata such as trace ids, publisher ids or deadlines rides in an
+ * extension block between the 16-byte header and the payload:
+ *
+ *   header (kFlagExtensions) | u16 block size | entries... | payload | ...
+ *   entry: u16 type | u16 length | length bytes
+ *
+ * The block is only present when the header's kFlagExtensions is set, so a
+ * message without extensions is encoded and decoded exactly as before. A
+ * reader that does not care about extensions skips the block with its size,
+ * and one looking for a single type steps over the others by their length
+ * without knowing what they mean.
+ */
+
+#include <concepts>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+#include "sensorstreamkit/core/serialization.hpp"
+
+namespace sensorstreamkit::core {
+
+class HeaderExtensions;
+
+/**
+ * @brief Non-owning, validated view over extension entries
+ */
+class HeaderExtensionsView {
+public:
+    // Bytes of the type and length in front of each value
+    static constexpr size_t kEntryHeaderSize = 2 * sizeof(uint16_t);
+
+    HeaderExtensionsView() = default;
+
+    /**
+     * @brief View over entries if every entry lies within them
+     */
+    [[nodiscard]] static std::optional<HeaderExtensionsView> from(ConstPayload entries) noexcept;
+
+    /**
+     * @brief Value of the first entry of type, skipping others by their length
+     */
+    [[nodiscard]] std::optional<ConstPayload> find(uint16_t type) const noexcept;
+
+    /**
+     * @brief Value of the first entry of type as a V, if its length is sizeof(V)
+     */
+    template <typename V>
+        requires std::is_trivially_copyable_v<V>
+    [[nodiscard]] std::optional<V> get(uint16_t type) const noexcept {
+        auto value = find(type);
+        if (!value || value->size() != sizeof(V)) return std::nullopt;
+        V out;
+        std::memcpy(&out, value->data(), sizeof(V));
+        return out;
+    }
+
+    [[nodiscard]] ConstPayload bytes() const noexcept { return entries_; }
+    [[nodiscard]] bool empty() const noexcept { return entries_.empty(); }
+
+private:
+    friend class HeaderExtensions;
+
+    explicit HeaderExtensionsView(ConstPayload entries) noexcept : entries_(entries) {}
+
+    ConstPayload entries_;
+};
+
+/**
+ * @brief Owning list of extension entries, held by Message next to its header
+ *
+ * Empty unless entries are added, in which case it allocates once for
+ * their bytes; decoding into the same message reuses that capacity.
+ */
+class HeaderExtensions {
+public:
+    // Well-known types; values are free-form bytes chosen by the sender
+    static constexpr uint16_t kTraceId = 1;      // e.g. 16-byte trace id
+    static constexpr uint16_t kPublisherId = 2;  // e.g. uint64_t
+    static constexpr uint16_t kDeadlineNs = 3;   // uint64_t, same epoch as Timestamp
+    // Types from here up are free for applications
+    static constexpr uint16_t kFirstUserType = 0x8000;
+
+    // The block size is a u16 on the wire
+    static constexpr size_t kMaxBytes = UINT16_MAX;
+
+    /**
+     * @brief Append an entry; find() returns the first entry of a type
+     * @return false (unchanged) if the entries would exceed kMaxBytes
+     */
+    bool add(uint16_t type, ConstPayload value);
+
+    template <typename V>
+        requires std::is_trivially_copyable_v<V> && (!std::convertible_to<const V&, ConstPayload>)
+    bool add(uint16_t type, const V& value) {
+        return add(type, ConstPayload(reinterpret_cast<const uint8_t*>(&value), sizeof(V)));
+    }
+
+    /**
+     * @brief Replace all entries with a copy of encoded ones
+     * @return false (left empty) if entries are malformed or exceed kMaxBytes
+     */
+    bool assign(ConstPayload entries);
+
+    void clear() noexcept { bytes_.clear(); }
+
+    [[nodiscard]] std::optional<ConstPayload> find(uint16_t type) const noexcept { return view().find(type); }
+
+    template <typename V>
+        requires std::is_trivially_copyable_v<V>
+    [[nodiscard]] std::optional<V> get(uint16_t type) const noexcept {
+        return view().get<V>(type);
+    }
+
+    [[nodiscard]] HeaderExtensionsView view() const noexcept;
+
+    /**
+     * @brief Encoded entries, without the block size in front
+     */
+    [[nodiscard]] ConstPayload bytes() const noexcept { return bytes_; }
+    [[nodiscard]] size_t size() const noexcept { return bytes_.size(); }
+    [[nodiscard]] bool empty() const noexcept { return bytes_.empty(); }
+
+    /**
+     * @brief Bytes of the block on the wire: the size in front and the entries (0 if empty)
+     */
+    [[nodiscard]] size_t block_size() const noexcept { return empty() ? 0 : sizeof(uint16_t) + size(); }
+
+    bool operator==(const HeaderExtensions&) const = default;
+
+private:
+    std::vector<uint8_t> bytes_;
+};
+
+}  // namespace sensorstreamkit::core
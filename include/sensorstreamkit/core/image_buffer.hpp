@@ -0,0 +1,66 @@
+#pragma once
+
+/**
+ * @file image_buffer.hpp
+ * @brief Reference-counted, immutable byte buffer for large payload data (pixels)
+ * @author Jo, SeungHyeon (Jo,SH)
+ * @date 2025
+ *
+ * Copying an ImageBuffer copies the handle, not the bytes. The publisher
+ * passes the bytes to ZeroMQ as their own message part and keeps a handle
+ * alive until ZeroMQ releases the part, so a frame reaches the socket
+ * without a memcpy. On the receiving side the handle owns the received
+ * part instead.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace sensorstreamkit::core {
+
+class ImageBuffer {
+public:
+    ImageBuffer() = default;
+
+    /**
+     * @brief Take ownership of bytes (moved, not copied)
+     */
+    explicit ImageBuffer(std::vector<uint8_t> bytes) {
+        auto storage = std::make_shared<const std::vector<uint8_t>>(std::move(bytes));
+        bytes_ = std::span<const uint8_t>(*storage);
+        owner_ = std::move(storage);
+    }
+
+    /**
+     * @brief Refer to memory owned by someone else (e.g. a driver's DMA buffer)
+     * @param owner Kept alive while any handle refers to bytes
+     */
+    ImageBuffer(std::shared_ptr<const void> owner, std::span<const uint8_t> bytes) noexcept
+        : owner_(std::move(owner)), bytes_(bytes) {}
+
+    /**
+     * @brief New buffer holding a copy of bytes
+     */
+    [[nodiscard]] static ImageBuffer copy_of(std::span<const uint8_t> bytes) {
+        return ImageBuffer(std::vector<uint8_t>(bytes.begin(), bytes.end()));
+    }
+
+    [[nodiscard]] const uint8_t* data() const noexcept { return bytes_.data(); }
+    [[nodiscard]] size_t size() const noexcept { return bytes_.size(); }
+    [[nodiscard]] bool empty() const noexcept { return bytes_.empty(); }
+    [[nodiscard]] std::span<const uint8_t> bytes() const noexcept { return bytes_; }
+
+    /**
+     * @brief Number of handles sharing the bytes (0 for an empty buffer)
+     */
+    [[nodiscard]] long use_count() const noexcept { return owner_.use_count(); }
+
+private:
+    std::shared_ptr<const void> owner_;
+    std::span<const uint8_t> bytes_;
+};
+
+}  // namespace sensorstreamkit::core
@@ -0,0 +1,162 @@
+#pragma once
+
+/**
+ * @file imu_samples.hpp
+ * @brief Columnar storage for a run of IMU samples from one sensor
+ * @author Jo, SeungHyeon (Jo,SH)
+ * @date 2025
+ *
+ * Each quantity is its own cache-line aligned column, so filters and
+ * integrators over e.g. gyro_z run as aligned vector loops. On the wire
+ * the columns follow each other:
+ *
+ *   u32 count | timestamps | u8 half | accel_x | accel_y | accel_z | gyro_x | gyro_y | gyro_z
+ *
+ * Timestamps go through timestamp_codec, which for a steady sensor costs
+ * 0 to 2 bytes per sample instead of 8. The rest are float32, 24 bytes
+ * per sample, or with half precision set, IEEE half floats at 12 bytes.
+ * An empty batch is just the count.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+
+#include "sensorstreamkit/core/aligned_allocator.hpp"
+#include "sensorstreamkit/core/serialization.hpp"
+#include "sensorstreamkit/core/timestamp_codec.hpp"
+
+namespace sensorstreamkit::core {
+
+/**
+ * @brief One IMU sample, for filling or reading ImuSamples sample by sample
+ */
+struct ImuSample {
+    uint64_t timestamp_ns{0};
+    float accel_x{0.0f};
+    float accel_y{0.0f};
+    float accel_z{0.0f};
+    float gyro_x{0.0f};
+    float gyro_y{0.0f};
+    float gyro_z{0.0f};
+
+    bool operator==(const ImuSample&) const = default;
+};
+
+/**
+ * @brief IMU samples stored as one column per quantity
+ *
+ * All columns always have size() elements.
+ */
+class ImuSamples {
+public:
+    ImuSamples() = default;
+    explicit ImuSamples(size_t size) { resize(size); }
+
+    [[nodiscard]] size_t size() const noexcept { return timestamp_ns_.size(); }
+    [[nodiscard]] bool empty() const noexcept { return timestamp_ns_.empty(); }
+
+    void resize(size_t size);
+    void reserve(size_t size);
+    void clear() noexcept;
+
+    void push_back(const ImuSample& sample);
+    [[nodiscard]] ImuSample sample(size_t index) const noexcept;
+
+    [[nodiscard]] std::span<uint64_t> timestamp_ns() noexcept { return timestamp_ns_; }
+    [[nodiscard]] std::span<float> accel_x() noexcept { return accel_x_; }
+    [[nodiscard]] std::span<float> accel_y() noexcept { return accel_y_; }
+    [[nodiscard]] std::span<float> accel_z() noexcept { return accel_z_; }
+    [[nodiscard]] std::span<float> gyro_x() noexcept { return gyro_x_; }
+    [[nodiscard]] std::span<float> gyro_y() noexcept { return gyro_y_; }
+    [[nodiscard]] std::span<float> gyro_z() noexcept { return gyro_z_; }
+
+    [[nodiscard]] std::span<const uint64_t> timestamp_ns() const noexcept { return timestamp_ns_; }
+    [[nodiscard]] std::span<const float> accel_x() const noexcept { return accel_x_; }
+    [[nodiscard]] std::span<const float> accel_y() const noexcept { return accel_y_; }
+    [[nodiscard]] std::span<const float> accel_z() const noexcept { return accel_z_; }
+    [[nodiscard]] std::span<const float> gyro_x() const noexcept { return gyro_x_; }
+    [[nodiscard]] std::span<const float> gyro_y() const noexcept { return gyro_y_; }
+    [[nodiscard]] std::span<const float> gyro_z() const noexcept { return gyro_z_; }
+
+    /**
+     * @brief Send accel and gyro as half floats (see half_float.hpp)
+     *
+     * Only the wire format changes; values read back are rounded to 11
+     * significant bits. Readers need no setting, the mode travels with
+     * each batch.
+     */
+    void set_half_precision(bool enabled) noexcept { half_precision_ = enabled; }
+    [[nodiscard]] bool half_precision() const noexcept { return half_precision_; }
+
+    bool operator==(const ImuSamples&) const = default;
+
+    // Per sample, without the timestamp
+    static constexpr size_t kFloatBytes = 6 * sizeof(float);
+    static constexpr size_t kHalfBytes = 6 * sizeof(uint16_t);
+
+private:
+    AlignedVector<uint64_t> timestamp_ns_;
+    AlignedVector<float> accel_x_;
+    AlignedVector<float> accel_y_;
+    AlignedVector<float> accel_z_;
+    AlignedVector<float> gyro_x_;
+    AlignedVector<float> gyro_y_;
+    AlignedVector<float> gyro_z_;
+    bool half_precision_{false};
+};
+
+/**
+ * @brief Non-owning view over serialized ImuSamples
+ *
+ * from() checks the timestamp section and the column bytes but decodes
+ * only the first timestamp; decode_into() fills the columns.
+ */
+class ImuSamplesView {
+public:
+    /**
+     * @brief Validate samples at data[offset] and advance offset past them
+     */
+    [[nodiscard]] static std::optional<ImuSamplesView> from(ConstPayload data, size_t& offset) noexcept;
+
+    [[nodiscard]] size_t size() const noexcept { return size_; }
+    [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+    [[nodiscard]] bool half_precision() const noexcept { return half_precision_; }
+
+    /**
+     * @brief Timestamp of the first sample, or 0 if there are none
+     */
+    [[nodiscard]] uint64_t front_timestamp_ns() const noexcept { return front_timestamp_ns_; }
+
+    /**
+     * @brief Decode all columns into out, reusing its capacity
+     */
+    void decode_into(ImuSamples& out) const;
+
+    [[nodiscard]] ImuSamples to_owned() const;
+
+private:
+    ConstPayload timestamps_;
+    const uint8_t* columns_{nullptr};
+    size_t size_{0};
+    uint64_t front_timestamp_ns_{0};
+    bool half_precision_{false};
+};
+
+/**
+ * @brief Wire encoding of an ImuSamples field (see file comment)
+ */
+template <>
+struct FieldCodec<ImuSamples> {
+    using Plan = timestamp_codec::Plan;
+
+    [[nodiscard]] static Plan plan(const ImuSamples& samples) noexcept;
+    [[nodiscard]] static size_t size(const ImuSamples& samples) noexcept;
+    [[nodiscard]] static size_t size(const ImuSamples& samples, const Plan& plan) noexcept;
+    static uint8_t* write(uint8_t* dst, const ImuSamples& samples) noexcept;
+    static uint8_t* write(uint8_t* dst, const ImuSamples& samples, const Plan& plan) noexcept;
+    static bool read(ConstPayload data, size_t& offset, ImuSamples& samples);
+};
+
+}  // namespace sensorstreamkit::core
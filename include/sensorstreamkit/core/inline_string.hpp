@@ -0,0 +1,87 @@
+#pragma once
+
+/**
+ * @file inline_string.hpp
+ * @brief Fixed-capacity string stored inside its owner
+ * @author Jo, SeungHyeon (Jo,SH)
+ * @date 2025
+ *
+ * InlineString<N> holds up to N characters with no heap storage and is
+ * trivially copyable, so a payload whose sensor id is an InlineString
+ * instead of a std::string can be trivially copyable as a whole, and
+ * Message<T> copies it to and from the wire as one block (see
+ * BlockCopyable in serialization.hpp). On the wire it is its object
+ * representation, always sizeof bytes:
+ *
+ *   u8 size | N chars, zero after the first size
+ *
+ * Pick N so that the id plus the other fields leave no padding, e.g.
+ * InlineString<31> (32 bytes) ahead of a uint64 timestamp.
+ */
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace sensorstreamkit::core {
+
+template <size_t N>
+    requires (N > 0 && N <= UINT8_MAX)
+class InlineString {
+public:
+    constexpr InlineString() noexcept = default;
+
+    /**
+     * @brief From a string literal; literals longer than N do not compile
+     */
+    template <size_t M>
+        requires (M - 1 <= N)
+    constexpr InlineString(const char (&literal)[M]) noexcept {
+        assign(std::string_view(literal, M - 1));
+    }
+
+    /**
+     * @brief Keep the first N characters of value; use assign() to detect overlong values
+     */
+    constexpr explicit InlineString(std::string_view value) noexcept {
+        assign(value.substr(0, N));
+    }
+
+    /**
+     * @brief Replace the contents with value
+     * @return false (contents unchanged) if value is longer than N
+     */
+    constexpr bool assign(std::string_view value) noexcept {
+        if (value.size() > N) return false;
+        std::copy(value.begin(), value.end(), chars_.begin());
+        std::fill(chars_.begin() + static_cast<std::ptrdiff_t>(value.size()), chars_.end(), '\0');
+        size_ = static_cast<uint8_t>(value.size());
+        return true;
+    }
+
+    // Clamped, so bytes from a corrupt frame cannot point past the buffer
+    [[nodiscard]] constexpr size_t size() const noexcept { return std::min<size_t>(size_, N); }
+    [[nodiscard]] constexpr bool empty() const noexcept { return size() == 0; }
+    [[nodiscard]] static constexpr size_t capacity() noexcept { return N; }
+    [[nodiscard]] constexpr const char* data() const noexcept { return chars_.data(); }
+
+    [[nodiscard]] constexpr std::string_view view() const noexcept { return {chars_.data(), size()}; }
+    constexpr operator std::string_view() const noexcept { return view(); }
+
+    friend constexpr bool operator==(const InlineString& a, const InlineString& b) noexcept {
+        return a.view() == b.view();
+    }
+    friend constexpr bool operator==(const InlineString& a, std::string_view b) noexcept { return a.view() == b; }
+    template <size_t M>
+    friend constexpr bool operator==(const InlineString& a, const char (&b)[M]) noexcept {
+        return a.view() == std::string_view(b, M - 1);
+    }
+
+private:
+    uint8_t size_{0};
+    std::array<char, N> chars_{};
+};
+
+}  // namespace sensorstreamkit::core
@@ -9,21 +9,25 @@
 
 #include <concepts>
 #include <cstdint>
+#include <cstring>
 #include <memory>
+#include <memory_resource>
 #include <optional>
 #include <span>
 #include <string>
 #include <string_view>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
-namespace sensorstreamkit::core {
-
-// ============================================================================
-// Type definitions for Payloads
-// ============================================================================
-
-using ConstPayload = std::span<const uint8_t>;
+#include "sensorstreamkit/core/header_extensions.hpp"
+#include "sensorstreamkit/core/image_buffer.hpp"
+#include "sensorstreamkit/core/imu_samples.hpp"
+#include "sensorstreamkit/core/inline_string.hpp"
+#include "sensorstreamkit/core/point_cloud.hpp"
+#include "sensorstreamkit/core/serialization.hpp"
 
+namespace sensorstreamkit::core {
 
 // ===========================================================================
 // Concepts for Type Safety
@@ -33,9 +37,12 @@ using ConstPayload = std::span<const uint8_t>;
  * @brief Concept for types that can be serialized to binary format
  */
 template <typename T>
-concept Serializable = requires(const T& t, std::vector<uint8_t>& buffer) {
+concept Serializable = requires(const T& t, T& dst, std::vector<uint8_t>& buffer, MutablePayload out) {
     { t.serialize(buffer) } -> std::same_as<void>;
+    { t.serialized_size() } -> std::same_as<size_t>;
+    { t.serialize_into(out) } -> std::same_as<size_t>;
     { T::deserialize(ConstPayload{}) } -> std::same_as<std::optional<T>>;
+    { T::deserialize_into(ConstPayload{}, dst) } -> std::same_as<bool>;
 };
 
 /**
@@ -53,11 +60,63 @@ concept SensorDataType = requires(const T& t) {
 template <typename T>
 concept PayloadType = SensorDataType<T>;
 
+/**
+ * @brief Payloads with a stable wire id, stamped into MessageHeader::message_type
+ *
+ * Ids are part of the wire format: never renumber or reuse one. 0 means
+ * "untyped" and is what payloads without kMessageType are sent as.
+ */
+template <typename T>
+concept TypedPayload = SensorDataType<T> && requires {
+    { T::kMessageType } -> std::convertible_to<uint16_t>;
+} && (T::kMessageType != 0);
+
+/**
+ * @brief Payloads that carry a large byte buffer next to their fields
+ *
+ * The buffer is not part of the payload's own serialization. Message<T>
+ * writes it as an attachment section after the payload, or leaves it out
+ * of the frame so a transport can send it without copying.
+ */
+template <typename T>
+concept AttachmentPayload = requires(T& t, const T& ct) {
+    { t.attachment() } -> std::same_as<ImageBuffer&>;
+    { ct.attachment() } -> std::same_as<const ImageBuffer&>;
+};
+
+/**
+ * @brief Payloads whose last field is a PointCloud named points
+ *
+ * An empty cloud takes no bytes (see point_cloud.hpp); NativeCodec flags
+ * frames that carry one with MessageHeader::kFlagPointCloud.
+ */
+template <typename T>
+concept PointCloudPayload = requires(const T& t) {
+    { t.points } -> std::same_as<const PointCloud&>;
+};
+
+template <typename T>
+inline constexpr uint16_t message_type_v = [] {
+    if constexpr (TypedPayload<T>) {
+        return static_cast<uint16_t>(T::kMessageType);
+    } else {
+        return uint16_t{0};
+    }
+}();
+
 
 // ============================================================================
 // Timestamp Utilities
 // ============================================================================
 
+/**
+ * @brief Clock behind Timestamp::now()
+ */
+enum class ClockSource : uint8_t {
+    SteadyClock,  // std::chrono::steady_clock (default)
+    Tsc           // Calibrated invariant TSC, see TscClock; same epoch as SteadyClock
+};
+
 /**
  * @brief High-precision timestamp using std::chrono
  */
@@ -73,6 +132,16 @@ public:
     [[nodiscard]] double seconds() const noexcept;
     [[nodiscard]] static Timestamp now() noexcept;
 
+    /**
+     * @brief Select the clock used by now() for all threads
+     *
+     * Switching to Tsc calibrates it first if needed, which blocks for
+     * TscClock::kCalibrationWindow.
+     * @return The source now in effect; SteadyClock if the TSC is unusable
+     */
+    static ClockSource set_clock_source(ClockSource source) noexcept;
+    [[nodiscard]] static ClockSource clock_source() noexcept;
+
     auto operator<=>(const Timestamp&) const = default;
 
 private:
@@ -86,22 +155,83 @@ private:
 
 /**
  * @brief Common header for all sensor messages
+ *
+ * flags describes optional parts of the frame. Readers reject frames with
+ * flags they do not know, so new parts can be added without older readers
+ * misparsing them. Metadata that older readers may ignore goes in
+ * Message::extensions() instead (see HeaderExtensions); the header itself
+ * stays a trivially copyable 16 bytes.
  */
 struct MessageHeader {
+    // A CRC32C over the rest of the frame follows everything else
+    static constexpr uint16_t kFlagCrc32c = 0x0001;
+    // An attachment section (e.g. camera pixels) follows the payload
+    static constexpr uint16_t kFlagAttachment = 0x0002;
+    // The attachment's bytes travel separately; only its size is in the frame
+    static constexpr uint16_t kFlagAttachmentDetached = 0x0004;
+    static constexpr uint16_t kAttachmentFlags = kFlagAttachment | kFlagAttachmentDetached;
+    // An extension block (u16 size, then TLV entries) follows the header
+    static constexpr uint16_t kFlagExtensions = 0x0008;
+    // The payload ends with a point cloud (see PointCloudPayload)
+    static constexpr uint16_t kFlagPointCloud = 0x0010;
+    // Set by the codec from the message's contents, not by the caller
+    static constexpr uint16_t kFrameFlags = kAttachmentFlags | kFlagExtensions | kFlagPointCloud;
+    static constexpr uint16_t kKnownFlags = kFlagCrc32c | kFrameFlags;
+
+    static constexpr size_t kChecksumSize = sizeof(uint32_t);
+    static constexpr size_t kAttachmentSizeBytes = sizeof(uint32_t);
+    static constexpr size_t kExtensionSizeBytes = sizeof(uint16_t);
+
     uint64_t timestamp_ns{0};
     uint32_t sequence_number{0};
     uint16_t message_type{0};
-    uint16_t reserved{0};   // For future use
+    uint16_t flags{0};
 
-    static constexpr size_t serialized_size = sizeof(timestamp_ns) +
-                                              sizeof(sequence_number) +
-                                              sizeof(message_type) +
-                                              sizeof(reserved);
+    static constexpr auto fields() noexcept {
+        return std::tuple{field<&MessageHeader::timestamp_ns>, field<&MessageHeader::sequence_number>,
+                          field<&MessageHeader::message_type>, field<&MessageHeader::flags>};
+    }
+
+    [[nodiscard]] static constexpr size_t serialized_size() noexcept {
+        return sizeof(timestamp_ns) + sizeof(sequence_number) +
+               sizeof(message_type) + sizeof(flags);
+    }
+
+    [[nodiscard]] bool has_checksum() const noexcept { return (flags & kFlagCrc32c) != 0; }
+
+    bool operator==(const MessageHeader&) const = default;
+
+    /**
+     * @brief True if a frame stamped with type can be decoded as a T
+     *
+     * Untyped (0) frames are accepted for any T.
+     */
+    template <typename T>
+    [[nodiscard]] static constexpr bool type_matches(uint16_t type) noexcept {
+        return type == 0 || type == message_type_v<T>;
+    }
+    [[nodiscard]] bool has_unknown_flags() const noexcept { return (flags & ~kKnownFlags) != 0; }
+
+    /**
+     * @brief Bytes after the payload (the CRC32C, if flagged)
+     */
+    [[nodiscard]] size_t trailer_size() const noexcept { return has_checksum() ? kChecksumSize : 0; }
 
     void serialize(std::vector<uint8_t>& buffer) const;
+
+    /**
+     * @brief Write into a caller-owned buffer
+     * @return Bytes written, or 0 if out is smaller than serialized_size()
+     */
+    size_t serialize_into(MutablePayload out) const noexcept;
+
     static std::optional<MessageHeader> deserialize(ConstPayload data);
+    static bool deserialize_into(ConstPayload data, MessageHeader& out) noexcept;
 };
 
+// Copied with every message and view; anything that allocates belongs on Message
+static_assert(std::is_trivially_copyable_v<MessageHeader>);
+
 
 // ============================================================================
 // Sequence Generator
@@ -126,6 +256,392 @@ private:
     std::unique_ptr<Impl> pImpl_;
 };
 
+/**
+ * @brief Independent sequence counters keyed by stream name (e.g. sensor id)
+ *
+ * Each stream counts 0, 1, 2, ... on its own, so a subscriber can detect
+ * loss per stream. Every counter has its own cache line, and each thread
+ * keeps a small cache of the streams it used last, so a thread that
+ * publishes its own sensors takes no lock and touches no shared line.
+ */
+class SequenceStreams {
+public:
+    SequenceStreams();
+    ~SequenceStreams() noexcept;
+    SequenceStreams(const SequenceStreams&) = delete;
+    SequenceStreams& operator=(const SequenceStreams&) = delete;
+    SequenceStreams(SequenceStreams&&) noexcept;
+    SequenceStreams& operator=(SequenceStreams&&) noexcept;
+
+    /**
+     * @brief Counter for key, created on first use
+     * @return Reference that stays valid for the lifetime of this object
+     */
+    SequenceCounter& stream(std::string_view key);
+
+    uint32_t next(std::string_view key) {
+        return stream(key).next();
+    }
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> pImpl_;
+};
+
+
+// ============================================================================
+// Wire Codecs
+// ============================================================================
+
+/**
+ * @brief Policy that turns a header and payload into frame bytes and back
+ *
+ * The second parameter of Message<T, Codec>. A codec is a type with static
+ * functions, so the choice is made at compile time per stream and the
+ * calls inline into serialize_into()/deserialize_into():
+ *
+ *   encoded_size(header, payload) -> size_t    Exact bytes encode() writes
+ *   encode(header, payload, out)  -> size_t    Bytes written, 0 if out is too small
+ *   decode(data, header, payload) -> bool      Overwrite header and payload
+ */
+template <typename C, typename T>
+concept MessageCodec = requires(const MessageHeader& header, const T& payload, MutablePayload out,
+                                ConstPayload data, MessageHeader& header_out, T& payload_out) {
+    { C::encoded_size(header, payload) } -> std::same_as<size_t>;
+    { C::encode(header, payload, out) } -> std::same_as<size_t>;
+    { C::decode(data, header_out, payload_out) } -> std::same_as<bool>;
+};
+
+/**
+ * @brief Codec that can also send registry ids, leave attachments out of the frame
+ *        and carry header extensions
+ *
+ * Enables the StringRegistry and *_detached overloads of Message, the
+ * matching paths in ZmqPublisher/ZmqSubscriber, and Message::extensions()
+ * on the wire.
+ */
+template <typename C, typename T>
+concept InterningCodec = MessageCodec<C, T> &&
+    requires(const MessageHeader& header, const T& payload, MutablePayload out, ConstPayload data,
+             MessageHeader& header_out, T& payload_out, const StringRegistry* strings, const ImageBuffer* detached,
+             const HeaderExtensions* extensions, HeaderExtensions* extensions_out) {
+    { C::encoded_size(header, payload, strings, true, extensions) } -> std::same_as<size_t>;
+    { C::encode(header, payload, out, strings, true, extensions) } -> std::same_as<size_t>;
+    { C::decode(data, header_out, payload_out, strings, detached, extensions_out) } -> std::same_as<bool>;
+};
+
+/**
+ * @brief The memcpy wire format: the default codec of Message<T>
+ *
+ * Frame layout:
+ *   header | [extension block] | payload | [attachment bytes] [u32 attachment size] | [u32 CRC32C]
+ * The extension block (see HeaderExtensions) is present if extensions are
+ * given and not empty. The attachment section is present if kFlagAttachment is set;
+ * its bytes are omitted with kFlagAttachmentDetached. The size sits at the
+ * end so readers find the payload's extent without parsing it.
+ */
+struct NativeCodec {
+    template <SensorDataType T>
+    [[nodiscard]] static size_t encoded_size(const MessageHeader& header, const T& payload,
+                                             const StringRegistry* strings = nullptr, bool detached = false,
+                                             const HeaderExtensions* extensions = nullptr) noexcept {
+        return frame_size(header, payload, plan_payload(payload, strings).size, detached, extensions);
+    }
+
+    template <SensorDataType T>
+    static size_t encode(const MessageHeader& message_header, const T& payload, MutablePayload out,
+                         const StringRegistry* strings = nullptr, bool detached = false,
+                         const HeaderExtensions* extensions = nullptr) noexcept {
+        // Sized once; the payload is written with the same plan
+        const PayloadPlan<T> plan = plan_payload(payload, strings);
+        const size_t total = frame_size(message_header, payload, plan.size, detached, extensions);
+        if (out.size() < total) return 0;
+
+        const ImageBuffer* extra = attachment(payload);
+        if (extensions != nullptr && extensions->empty()) extensions = nullptr;
+        const bool cloud = has_cloud(payload);
+        if (extra == nullptr && message_header.flags == 0 && extensions == nullptr && !cloud) {
+            // Common case: header and payload only
+            const size_t header_size = message_header.serialize_into(out);
+            write_payload(payload, out.data() + header_size, plan, strings, nullptr);
+            return total;
+        }
+
+        // Frame flags describe this frame, not the message
+        MessageHeader header{message_header.timestamp_ns, message_header.sequence_number,
+                             message_header.message_type,
+                             static_cast<uint16_t>(message_header.flags & ~MessageHeader::kFrameFlags)};
+        if (extra != nullptr) {
+            if (extra->size() > UINT32_MAX) return 0;
+            header.flags |= MessageHeader::kFlagAttachment;
+            if (detached) header.flags |= MessageHeader::kFlagAttachmentDetached;
+        }
+        if (extensions != nullptr) header.flags |= MessageHeader::kFlagExtensions;
+        if (cloud) header.flags |= MessageHeader::kFlagPointCloud;
+
+        size_t prefix_size = header.serialize_into(out);
+        if (extensions != nullptr) {
+            const auto block_size = static_cast<uint16_t>(extensions->size());
+            std::memcpy(out.data() + prefix_size, &block_size, sizeof(block_size));
+            std::memcpy(out.data() + prefix_size + sizeof(block_size), extensions->bytes().data(), block_size);
+            prefix_size += extensions->block_size();
+        }
+        const bool checksum = header.has_checksum();
+        uint32_t crc = checksum ? crc32c::extend(0, out.data(), prefix_size) : 0;
+        uint32_t* crc_ptr = checksum ? &crc : nullptr;
+
+        uint8_t* dst = write_payload(payload, out.data() + prefix_size, plan, strings, crc_ptr);
+
+        if (extra != nullptr) {
+            if (!detached) {
+                if (checksum) {
+                    dst = crc32c::copy(dst, extra->data(), extra->size(), crc);
+                } else {
+                    std::memcpy(dst, extra->data(), extra->size());
+                    dst += extra->size();
+                }
+            }
+            const auto size = static_cast<uint32_t>(extra->size());
+            std::memcpy(dst, &size, sizeof(size));
+            if (checksum) crc = crc32c::extend(crc, dst, sizeof(size));
+            dst += sizeof(size);
+        }
+
+        if (checksum) std::memcpy(dst, &crc, sizeof(crc));
+        return total;
+    }
+
+    /**
+     * @param detached Attachment bytes that arrived separately, if any
+     * @param extensions Receives the extension entries; without it they are only validated
+     */
+    template <SensorDataType T>
+    static bool decode(ConstPayload data, MessageHeader& header, T& out, const StringRegistry* strings = nullptr,
+                       const ImageBuffer* detached = nullptr, HeaderExtensions* extensions = nullptr) {
+        if (data.size() < MessageHeader::serialized_size()) {
+            return false; }
+
+        if (!MessageHeader::deserialize_into(data.subspan(0, MessageHeader::serialized_size()), header)) {
+            return false; }
+
+        // Written by a newer version with parts we cannot skip
+        if (header.has_unknown_flags()) {
+            return false; }
+
+        if (!MessageHeader::type_matches<T>(header.message_type)) {
+            return false; }
+
+        ConstPayload payload = data.subspan(MessageHeader::serialized_size());
+        const uint16_t flags = header.flags;
+        header.flags &= ~MessageHeader::kFrameFlags;
+        if (flags == 0) {
+            if (extensions != nullptr) extensions->clear();
+            if constexpr (AttachmentPayload<T>) out.attachment() = ImageBuffer{};
+            if constexpr (BlockCopyable<T>) {
+                if (serialization::is_block_layout(out)) return read_block(payload, out, nullptr);
+            }
+            // A cloud is read whenever bytes follow the metadata, but only a flagged frame may carry one
+            if constexpr (DescribedFields<T>) {
+                if (strings != nullptr) {
+                    return serialization::deserialize_into(payload, out, strings) && !has_cloud(out);
+                }
+            }
+            return T::deserialize_into(payload, out) && !has_cloud(out);
+        }
+
+        // Extension block in front: [u16 size] [entries]
+        if (flags & MessageHeader::kFlagExtensions) {
+            if (payload.size() < MessageHeader::kExtensionSizeBytes) return false;
+            uint16_t size;
+            std::memcpy(&size, payload.data(), sizeof(size));
+            if (payload.size() - sizeof(size) < size) return false;
+            const ConstPayload entries = payload.subspan(sizeof(size), size);
+            if (extensions != nullptr ? !extensions->assign(entries) : !HeaderExtensionsView::from(entries)) {
+                return false;
+            }
+            payload = payload.subspan(sizeof(size) + size);
+        } else if (extensions != nullptr) {
+            extensions->clear();
+        }
+        const size_t prefix_size = data.size() - payload.size();
+
+        uint32_t expected = 0;
+        if (header.has_checksum()) {
+            if (payload.size() < MessageHeader::kChecksumSize) return false;
+            std::memcpy(&expected, payload.data() + payload.size() - sizeof(expected), sizeof(expected));
+            payload = payload.first(payload.size() - sizeof(expected));
+        }
+
+        // Attachment section at the end: [bytes] [u32 size]
+        ConstPayload section;
+        ConstPayload inline_bytes;
+        if (flags & MessageHeader::kFlagAttachment) {
+            if (payload.size() < MessageHeader::kAttachmentSizeBytes) return false;
+            uint32_t size;
+            std::memcpy(&size, payload.data() + payload.size() - sizeof(size), sizeof(size));
+            size_t section_size = sizeof(size);
+
+            if (flags & MessageHeader::kFlagAttachmentDetached) {
+                if (detached != nullptr && detached->size() != size) return false;
+            } else {
+                if (payload.size() - sizeof(size) < size) return false;
+                inline_bytes = payload.subspan(payload.size() - sizeof(size) - size, size);
+                section_size += size;
+            }
+            section = payload.last(section_size);
+            payload = payload.first(payload.size() - section_size);
+        }
+
+        if (header.has_checksum()) {
+            uint32_t crc = crc32c::extend(0, data.data(), prefix_size);
+            if constexpr (DescribedFields<T>) {
+                bool ok;
+                if constexpr (BlockCopyable<T>) {
+                    ok = serialization::is_block_layout(out)
+                             ? read_block(payload, out, &crc)
+                             : serialization::deserialize_into(payload, out, strings, crc);
+                } else {
+                    // Each field is checksummed as it is read
+                    ok = serialization::deserialize_into(payload, out, strings, crc);
+                }
+                if (!ok) return false;
+            } else {
+                crc = crc32c::extend(crc, payload.data(), payload.size());
+                if (!T::deserialize_into(payload, out)) return false;
+            }
+            if (crc32c::extend(crc, section.data(), section.size()) != expected) return false;
+        } else {
+            bool ok;
+            if constexpr (BlockCopyable<T>) {
+                ok = serialization::is_block_layout(out) ? read_block(payload, out, nullptr)
+                                                         : T::deserialize_into(payload, out);
+            } else if constexpr (DescribedFields<T>) {
+                ok = strings != nullptr ? serialization::deserialize_into(payload, out, strings)
+                                        : T::deserialize_into(payload, out);
+            } else {
+                ok = T::deserialize_into(payload, out);
+            }
+            if (!ok) return false;
+        }
+        // As above: a cloud only with the flag, and the flag only with a cloud
+        if (has_cloud(out) != ((flags & MessageHeader::kFlagPointCloud) != 0)) return false;
+
+        if constexpr (AttachmentPayload<T>) {
+            if (!inline_bytes.empty()) {
+                out.attachment() = ImageBuffer::copy_of(inline_bytes);
+            } else if ((flags & MessageHeader::kFlagAttachmentDetached) && detached != nullptr) {
+                out.attachment() = *detached;
+            } else {
+                out.attachment() = ImageBuffer{};
+            }
+        }
+        return true;
+    }
+
+private:
+    template <SensorDataType T>
+    [[nodiscard]] static const ImageBuffer* attachment(const T& payload) noexcept {
+        if constexpr (AttachmentPayload<T>) {
+            if (!payload.attachment().empty()) return &payload.attachment();
+        }
+        return nullptr;
+    }
+
+    template <SensorDataType T>
+    [[nodiscard]] static bool has_cloud(const T& payload) noexcept {
+        if constexpr (PointCloudPayload<T>) {
+            return !payload.points.empty();
+        } else {
+            return false;
+        }
+    }
+
+    // Payload wire size; described payloads also carry the field plans
+    // write_payload() writes with, so encode() sizes the payload only once
+    template <typename T>
+    struct PayloadPlan {
+        size_t size{0};
+    };
+
+    template <DescribedFields T>
+    struct PayloadPlan<T> : serialization::WritePlan<T> {};
+
+    template <SensorDataType T>
+    [[nodiscard]] static PayloadPlan<T> plan_payload(const T& payload, const StringRegistry* strings) noexcept {
+        if constexpr (BlockCopyable<T>) {
+            PayloadPlan<T> plan;
+            plan.size = sizeof(T);
+            return plan;
+        } else if constexpr (DescribedFields<T>) {
+            return {serialization::plan(payload, strings)};
+        } else {
+            return {payload.serialized_size()};
+        }
+    }
+
+    template <SensorDataType T>
+    [[nodiscard]] static size_t frame_size(const MessageHeader& header, const T& payload, size_t payload_size,
+                                           bool detached, const HeaderExtensions* extensions) noexcept {
+        size_t size = MessageHeader::serialized_size() + (extensions ? extensions->block_size() : 0) +
+                      payload_size + header.trailer_size();
+        if (const ImageBuffer* extra = attachment(payload)) {
+            size += MessageHeader::kAttachmentSizeBytes + (detached ? 0 : extra->size());
+        }
+        return size;
+    }
+
+    /**
+     * @brief Write payload (plan.size bytes) at dst, extending *crc over it if given
+     * @return One past the payload
+     */
+    template <SensorDataType T>
+    static uint8_t* write_payload(const T& payload, uint8_t* dst, const PayloadPlan<T>& plan,
+                                  const StringRegistry* strings, uint32_t* crc) noexcept {
+        if constexpr (BlockCopyable<T>) {
+            if (serialization::is_block_layout(payload)) {
+                const auto* bytes = reinterpret_cast<const uint8_t*>(std::addressof(payload));
+                if (crc != nullptr) return crc32c::copy(dst, bytes, sizeof(T), *crc);
+                std::memcpy(dst, bytes, sizeof(T));
+                return dst + sizeof(T);
+            }
+        }
+        if constexpr (DescribedFields<T>) {
+            // Already bounds checked; each field is checksummed as it is written
+            if (crc != nullptr) return serialization::write_unchecked(payload, dst, plan, strings, *crc);
+            return serialization::write_unchecked(payload, dst, plan, strings);
+        } else {
+            payload.serialize_into({dst, plan.size});
+            if (crc != nullptr) *crc = crc32c::extend(*crc, dst, plan.size);
+            return dst + plan.size;
+        }
+    }
+
+    /**
+     * @brief Copy a BlockCopyable payload out of data as one block
+     *
+     * Like the field-by-field path, trailing bytes are only an error when
+     * checksumming, where the checksum must cover exactly the payload.
+     */
+    template <BlockCopyable T>
+    static bool read_block(ConstPayload data, T& out, uint32_t* crc) noexcept {
+        if (crc != nullptr ? data.size() != sizeof(T) : data.size() < sizeof(T)) return false;
+        std::memcpy(std::addressof(out), data.data(), sizeof(T));
+        if (crc != nullptr) *crc = crc32c::extend(*crc, data.data(), sizeof(T));
+        return true;
+    }
+};
+
+namespace detail {
+
+// One stream per sensor id, separately for each payload type (whatever the codec)
+template <typename T>
+uint32_t next_sequence(std::string_view sensor_id) {
+    static SequenceStreams streams;
+    return streams.next(sensor_id);
+}
+
+}  // namespace detail
+
 
 // ============================================================================
 // Generic Message Wrapper with C++20 Concepts
@@ -133,95 +649,322 @@ private:
 
 /**
  * @brief Type-safe message wrapper using C++20 concepts
+ * @tparam Codec Wire format (see MessageCodec); NativeCodec unless a
+ *               stream picks another, e.g. FlatBufferCodec
  */
-template <SensorDataType T>
+template <SensorDataType T, typename Codec = NativeCodec>
+    requires MessageCodec<Codec, T>
 class Message {
 public:
+    using payload_type = T;
+    using codec_type = Codec;
+
+    // False for codecs that allocate while encoding, e.g. FlatBufferCodec's builder
+    static constexpr bool kNothrowEncode =
+        noexcept(Codec::encoded_size(std::declval<const MessageHeader&>(), std::declval<const T&>())) &&
+        noexcept(Codec::encode(std::declval<const MessageHeader&>(), std::declval<const T&>(),
+                               std::declval<MutablePayload>()));
+
     Message() = default;
 
+    /**
+     * @brief Wrap a payload; the sequence number counts per payload type and sensor id
+     */
     explicit Message(T payload)
-        : header_{Timestamp::now().nanoseconds(), next_sequence(), 0, 0}
+        : header_{Timestamp::now().nanoseconds(), 0, message_type_v<T>, 0}
+        , payload_(std::move(payload)) {
+        header_.sequence_number = detail::next_sequence<T>(payload_.sensor_id());
+    }
+
+    /**
+     * @brief Wrap a payload, numbering it from a caller-owned stream (e.g. per topic)
+     */
+    Message(T payload, SequenceCounter& sequence)
+        : header_{Timestamp::now().nanoseconds(), sequence.next(), message_type_v<T>, 0}
+        , payload_(std::move(payload)) {}
+
+    /**
+     * @brief Empty message whose payload strings allocate from resource
+     *
+     * For decoding into arena memory (see deserialize_into()). Moving the
+     * message keeps resource; copying it allocates from the default
+     * resource, so a copy outlives the arena.
+     */
+    explicit Message(std::pmr::memory_resource* resource) {
+        if constexpr (DescribedFields<T>) serialization::bind_resource(payload_, resource);
+    }
+
+    /**
+     * @brief Wrap a payload with an existing header (e.g. decoded by another codec)
+     */
+    Message(const MessageHeader& header, T payload)
+        : header_(header)
         , payload_(std::move(payload)) {}
 
     [[nodiscard]] const MessageHeader& header() const noexcept { return header_; }
     [[nodiscard]] const T& payload() const noexcept { return payload_; }
     [[nodiscard]] T& payload() noexcept { return payload_; }
 
-    void serialize(std::vector<uint8_t>& buffer) const {
-        header_.serialize(buffer);
-        payload_.serialize(buffer);
+    /**
+     * @brief Append a CRC32C over header and payload when serialized
+     *
+     * The checksum is computed while the payload is written, and readers
+     * verify it in deserialize() and MessageView::from(). NativeCodec only;
+     * other codecs carry the flag but do not checksum.
+     */
+    void set_checksum(bool enabled) noexcept {
+        if (enabled) {
+            header_.flags |= MessageHeader::kFlagCrc32c;
+        } else {
+            header_.flags &= static_cast<uint16_t>(~MessageHeader::kFlagCrc32c);
+        }
+    }
+
+    /**
+     * @brief Entries sent after the header, e.g. a trace id or deadline
+     *
+     * A message without entries is framed exactly as before. NativeCodec
+     * only (see InterningCodec); other codecs drop them.
+     */
+    [[nodiscard]] HeaderExtensions& extensions() noexcept { return extensions_; }
+    [[nodiscard]] const HeaderExtensions& extensions() const noexcept { return extensions_; }
+
+    /**
+     * @brief Exact number of bytes serialize() appends
+     */
+    [[nodiscard]] size_t serialized_size() const noexcept(kNothrowEncode) {
+        if constexpr (InterningCodec<Codec, T>) {
+            return Codec::encoded_size(header_, payload_, nullptr, false, &extensions_);
+        } else {
+            return Codec::encoded_size(header_, payload_);
+        }
+    }
+
+    /**
+     * @brief Append header and payload to buffer (std::vector<uint8_t> or AlignedBuffer)
+     */
+    template <typename Allocator>
+    void serialize(std::vector<uint8_t, Allocator>& buffer) const {
+        // Grow once for header + payload instead of once per part
+        const size_t offset = buffer.size();
+        buffer.resize(offset + serialized_size());
+        serialize_into(MutablePayload(buffer).subspan(offset));
+    }
+
+    /**
+     * @brief Write header and payload into a caller-owned buffer
+     * @return Bytes written, or 0 if out is smaller than serialized_size()
+     */
+    size_t serialize_into(MutablePayload out) const noexcept(kNothrowEncode) {
+        if constexpr (InterningCodec<Codec, T>) {
+            return Codec::encode(header_, payload_, out, nullptr, false, &extensions_);
+        } else {
+            return Codec::encode(header_, payload_, out);
+        }
+    }
+
+    /**
+     * @brief Wire size when strings found in the registry are sent as ids
+     *
+     * Payloads without fields() are not interned and fall back to serialized_size().
+     */
+    [[nodiscard]] size_t serialized_size(const StringRegistry& strings) const noexcept
+        requires InterningCodec<Codec, T> {
+        return Codec::encoded_size(header_, payload_, &strings, false, &extensions_);
+    }
+
+    /**
+     * @brief Write header and payload, sending strings found in the registry as ids
+     * @return Bytes written, or 0 if out is smaller than serialized_size(strings)
+     */
+    size_t serialize_into(MutablePayload out, const StringRegistry& strings) const noexcept
+        requires InterningCodec<Codec, T> {
+        return Codec::encode(header_, payload_, out, &strings, false, &extensions_);
     }
 
-    static std::optional<Message<T>> deserialize(ConstPayload data) {
-        if (data.size() < MessageHeader::serialized_size) {
-            return std::nullopt; }
+    /**
+     * @brief Size of the frame without the attachment's bytes (see serialize_detached_into())
+     */
+    [[nodiscard]] size_t serialized_size_detached(const StringRegistry* strings = nullptr) const noexcept
+        requires AttachmentPayload<T> && InterningCodec<Codec, T> {
+        return Codec::encoded_size(header_, payload_, strings, true, &extensions_);
+    }
+
+    /**
+     * @brief Write the frame but leave the attachment's bytes out
+     *
+     * The caller sends payload().attachment() separately, e.g. as the next
+     * ZeroMQ message part, and the receiver hands it back to
+     * deserialize_detached_into(). A checksum does not cover detached bytes.
+     * @return Bytes written, or 0 if out is smaller than serialized_size_detached(strings)
+     */
+    size_t serialize_detached_into(MutablePayload out, const StringRegistry* strings = nullptr) const noexcept
+        requires AttachmentPayload<T> && InterningCodec<Codec, T> {
+        return Codec::encode(header_, payload_, out, strings, true, &extensions_);
+    }
 
-        auto header = MessageHeader::deserialize(data.subspan(0, MessageHeader::serialized_size));
-        if (!header) return std::nullopt;
+    static std::optional<Message> deserialize(ConstPayload data) {
+        Message msg;
+        if (!deserialize_into(data, msg)) return std::nullopt;
+        return msg;
+    }
 
-        auto payload = T::deserialize(data.subspan(MessageHeader::serialized_size));
-        if (!payload) return std::nullopt;
+    /**
+     * @brief Overwrite out in place, reusing its string capacity
+     *
+     * Once out's strings have grown to the largest ids seen, repeated calls
+     * do not allocate. On failure out is left partially updated.
+     * @return false if data is truncated, fails its checksum or has unknown flags
+     */
+    static bool deserialize_into(ConstPayload data, Message& out) {
+        if constexpr (InterningCodec<Codec, T>) {
+            return Codec::decode(data, out.header_, out.payload_, nullptr, nullptr, &out.extensions_);
+        } else {
+            return Codec::decode(data, out.header_, out.payload_);
+        }
+    }
 
-        Message<T> msg;
-        msg.header_ = *header;
-        msg.payload_ = std::move(*payload);
+    /**
+     * @brief deserialize() with the payload's strings allocated from resource
+     */
+    static std::optional<Message> deserialize(ConstPayload data, std::pmr::memory_resource* resource,
+                                              const StringRegistry* strings = nullptr) {
+        std::optional<Message> msg(std::in_place, resource);
+        bool ok;
+        if constexpr (InterningCodec<Codec, T>) {
+            ok = Codec::decode(data, msg->header_, msg->payload_, strings, nullptr, &msg->extensions_);
+        } else {
+            ok = strings == nullptr && Codec::decode(data, msg->header_, msg->payload_);
+        }
+        if (!ok) return std::nullopt;
         return msg;
     }
 
-private:
-    MessageHeader header_;
-    T payload_;
+    /**
+     * @brief deserialize() for data whose strings may be interned ids
+     */
+    static std::optional<Message> deserialize(ConstPayload data, const StringRegistry& strings)
+        requires InterningCodec<Codec, T> {
+        Message msg;
+        if (!deserialize_into(data, msg, strings)) return std::nullopt;
+        return msg;
+    }
 
-    // Generate next sequence number atomically
-    static uint32_t next_sequence() {
-        static SequenceCounter counter;
-        return counter.next();
+    /**
+     * @brief deserialize_into() that resolves interned ids against strings
+     * @return false if data is truncated or holds an id unknown to strings
+     */
+    static bool deserialize_into(ConstPayload data, Message& out, const StringRegistry& strings)
+        requires InterningCodec<Codec, T> {
+        return Codec::decode(data, out.header_, out.payload_, &strings, nullptr, &out.extensions_);
     }
+
+    /**
+     * @brief deserialize_into() for a frame whose attachment arrived separately
+     *
+     * The other overloads decode such a frame with an empty attachment.
+     * @return false as for deserialize_into(), or if attachment's size does
+     *         not match the size recorded in the frame
+     */
+    static bool deserialize_detached_into(ConstPayload data, ImageBuffer attachment, Message& out,
+                                          const StringRegistry* strings = nullptr)
+        requires AttachmentPayload<T> && InterningCodec<Codec, T> {
+        return Codec::decode(data, out.header_, out.payload_, strings, &attachment, &out.extensions_);
+    }
+
+private:
+    MessageHeader header_{.message_type = message_type_v<T>};
+    HeaderExtensions extensions_;
+    T payload_;
 };
 
+/**
+ * @brief Any Message<T, Codec> specialization
+ */
+template <typename M>
+concept AnyMessage = requires {
+    typename M::payload_type;
+    typename M::codec_type;
+} && std::same_as<M, Message<typename M::payload_type, typename M::codec_type>>;
+
 // ============================================================================
 // Sensor Data Structures
 // ============================================================================
 
 /**
- * @brief Camera frame metadata (not actual pixels)
+ * @brief Camera frame metadata, optionally with its pixels
+ *
+ * The pixels are shared, not copied, when the payload is copied, and are
+ * sent as a Message attachment rather than through fields().
  */
 struct CameraFrameData {
-    std::string sensor_id_;
+    std::pmr::string sensor_id_;
     uint64_t timestamp_ns_{0};
     uint32_t frame_id{0};
     uint32_t width{0};
     uint32_t height{0};
-    std::string encoding;  // e.g., "RGB8", "MONO8", "BAYER_RGGB8"
+    std::pmr::string encoding;  // e.g., "RGB8", "MONO8", "BAYER_RGGB8"
+    ImageBuffer pixels{};  // Empty if metadata only
+
+    static constexpr uint16_t kMessageType = 1;
+
+    // Wire layout, in order
+    static constexpr auto fields() noexcept {
+        return std::tuple{field<&CameraFrameData::sensor_id_>, field<&CameraFrameData::timestamp_ns_>,
+                          field<&CameraFrameData::frame_id>, field<&CameraFrameData::width>,
+                          field<&CameraFrameData::height>, field<&CameraFrameData::encoding>};
+    }
 
     [[nodiscard]] uint64_t timestamp_ns() const noexcept { return timestamp_ns_; }
     [[nodiscard]] std::string_view sensor_id() const noexcept { return sensor_id_; }
+    [[nodiscard]] ImageBuffer& attachment() noexcept { return pixels; }
+    [[nodiscard]] const ImageBuffer& attachment() const noexcept { return pixels; }
 
+    [[nodiscard]] size_t serialized_size() const noexcept;
     void serialize(std::vector<uint8_t>& buffer) const;
+    size_t serialize_into(MutablePayload out) const noexcept;
     static std::optional<CameraFrameData> deserialize(ConstPayload data);
+    static bool deserialize_into(ConstPayload data, CameraFrameData& out);
 };
 
 /**
- * @brief Lidar point cloud metadata (not actual points)
+ * @brief Lidar scan metadata, optionally with its point cloud
  */
 struct LidarScanData {
-    std::string sensor_id_;
+    std::pmr::string sensor_id_;
     uint64_t timestamp_ns_{0};
     uint32_t num_points{0};
     float scan_duration_ms{0.0f};
+    PointCloud points{};  // Empty if metadata only (no bytes on the wire); see PointCloud::set_resolution()
+
+    static constexpr uint16_t kMessageType = 2;
+
+    // Wire layout, in order
+    static constexpr auto fields() noexcept {
+        return std::tuple{field<&LidarScanData::sensor_id_>, field<&LidarScanData::timestamp_ns_>,
+                          field<&LidarScanData::num_points>, field<&LidarScanData::scan_duration_ms>,
+                          field<&LidarScanData::points>};
+    }
 
     [[nodiscard]] uint64_t timestamp_ns() const noexcept { return timestamp_ns_; }
     [[nodiscard]] std::string_view sensor_id() const noexcept { return sensor_id_; }
 
+    [[nodiscard]] size_t serialized_size() const noexcept;
     void serialize(std::vector<uint8_t>& buffer) const;
+    size_t serialize_into(MutablePayload out) const noexcept;
     static std::optional<LidarScanData> deserialize(ConstPayload data);
+    static bool deserialize_into(ConstPayload data, LidarScanData& out);
 };
 
+static_assert(std::is_same_v<FieldLayout<LidarScanData>::field_t<FieldLayout<LidarScanData>::count - 1>::value_type,
+                             PointCloud>,
+              "An empty cloud writes nothing, so it must be the last field");
+
 /**
  * @brief IMU (Inertial Measurement Unit) data
  */
 struct ImuData {
-    std::string sensor_id_;
+    std::pmr::string sensor_id_;
     uint64_t timestamp_ns_{0};
 
     // Linear acceleration (m/s²)
@@ -233,11 +976,65 @@ struct ImuData {
     float gyro_y{0.0f};
     float gyro_z{0.0f};
 
+    static constexpr uint16_t kMessageType = 3;
+
+    // Wire layout, in order
+    static constexpr auto fields() noexcept {
+        return std::tuple{field<&ImuData::sensor_id_>, field<&ImuData::timestamp_ns_>,
+                          field<&ImuData::accel_x>, field<&ImuData::accel_y>, field<&ImuData::accel_z>,
+                          field<&ImuData::gyro_x>, field<&ImuData::gyro_y>, field<&ImuData::gyro_z>};
+    }
+
     [[nodiscard]] uint64_t timestamp_ns() const noexcept { return timestamp_ns_; }
     [[nodiscard]] std::string_view sensor_id() const noexcept { return sensor_id_; }
 
+    [[nodiscard]] size_t serialized_size() const noexcept;
     void serialize(std::vector<uint8_t>& buffer) const;
+    size_t serialize_into(MutablePayload out) const noexcept;
     static std::optional<ImuData> deserialize(ConstPayload data);
+    static bool deserialize_into(ConstPayload data, ImuData& out);
+};
+
+/**
+ * @brief Many IMU samples from one sensor in a single message
+ *
+ * At 1 kHz, batching spares a multipart send, a header and a sensor id
+ * per sample. Samples are stored as columns (see ImuSamples).
+ */
+struct ImuBatch {
+    std::pmr::string sensor_id_;
+    ImuSamples samples{};
+
+    static constexpr uint16_t kMessageType = 4;
+
+    // Wire layout, in order
+    static constexpr auto fields() noexcept {
+        return std::tuple{field<&ImuBatch::sensor_id_>, field<&ImuBatch::samples>};
+    }
+
+    /**
+     * @brief Timestamp of the first sample, or 0 if the batch is empty
+     */
+    [[nodiscard]] uint64_t timestamp_ns() const noexcept {
+        return samples.empty() ? 0 : samples.timestamp_ns().front();
+    }
+    [[nodiscard]] std::string_view sensor_id() const noexcept { return sensor_id_; }
+
+    /**
+     * @brief Append imu's readings; its sensor id is not checked against sensor_id_
+     */
+    void push_back(const ImuData& imu);
+
+    /**
+     * @brief Sample index as a standalone ImuData carrying this batch's sensor id
+     */
+    [[nodiscard]] ImuData sample(size_t index) const;
+
+    [[nodiscard]] size_t serialized_size() const noexcept;
+    void serialize(std::vector<uint8_t>& buffer) const;
+    size_t serialize_into(MutablePayload out) const noexcept;
+    static std::optional<ImuBatch> deserialize(ConstPayload data);
+    static bool deserialize_into(ConstPayload data, ImuBatch& out);
 };
 
 // Verify concepts are satisfied
@@ -245,5 +1042,13 @@ static_assert(Serializable<MessageHeader>);
 static_assert(SensorDataType<CameraFrameData>);
 static_assert(SensorDataType<LidarScanData>);
 static_assert(SensorDataType<ImuData>);
+static_assert(SensorDataType<ImuBatch>);
+static_assert(TypedPayload<CameraFrameData>);
+static_assert(TypedPayload<LidarScanData>);
+static_assert(TypedPayload<ImuData>);
+static_assert(TypedPayload<ImuBatch>);
+static_assert(AttachmentPayload<CameraFrameData>);
+static_assert(InterningCodec<NativeCodec, CameraFrameData>);
+static_assert(InterningCodec<NativeCodec, ImuBatch>);
 
 }  // namespace sensorstreamkit::core
\ No newline at end of file
@@ -0,0 +1,127 @@
+#pragma once
+
+/**
+ * @file message_batch.hpp
+ * @brief Messages decoded into one arena that is released in a single step
+ * @author Jo, SeungHyeon (Jo,SH)
+ * @date 2025
+ *
+ * A receive loop that decodes many small messages per iteration spends a
+ * noticeable share of its time in malloc/free for sensor ids and other
+ * payload strings. MessageBatch<T> decodes them into a
+ * std::pmr::monotonic_buffer_resource over a buffer it owns: allocation is
+ * a pointer bump, nothing is freed per message, and clear() hands the
+ * whole buffer back at once. Once the buffer and the message vector have
+ * grown to fit a typical batch, a loop of
+ *
+ *   subscriber.receive_batch(batch, 64);
+ *   for (const auto& msg : batch) { ... }
+ *
+ * does not touch the heap at all.
+ *
+ * clear() keeps the message objects and only empties their strings, so
+ * bulk columns (PointCloud, ImuSamples) keep their capacity as well and
+ * the next batch decodes into them in place.
+ *
+ * Messages in the batch are valid until the next clear() (which
+ * ZmqSubscriber::receive_batch() calls first); copy one to keep it longer.
+ */
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <vector>
+
+#include "sensorstreamkit/core/message.hpp"
+
+namespace sensorstreamkit::core {
+
+template <SensorDataType T>
+class MessageBatch {
+public:
+    static constexpr size_t kDefaultArenaBytes = 64 * 1024;
+
+    /**
+     * @param arena_bytes Initial arena size; a batch that needs more takes
+     *                    extra blocks from the default resource until clear()
+     * @param capacity Messages to reserve room for
+     */
+    explicit MessageBatch(size_t arena_bytes = kDefaultArenaBytes, size_t capacity = 64)
+        : buffer_(std::make_unique_for_overwrite<std::byte[]>(arena_bytes))
+        , arena_(buffer_.get(), arena_bytes) {
+        messages_.reserve(capacity);
+    }
+
+    // The messages point into arena_, which cannot move
+    MessageBatch(const MessageBatch&) = delete;
+    MessageBatch& operator=(const MessageBatch&) = delete;
+
+    /**
+     * @brief Add a message whose strings allocate from the arena
+     *
+     * Reuses a message left by an earlier batch if there is one. Its
+     * fields hold that batch's values until overwritten by a decode.
+     */
+    Message<T>& emplace_back() {
+        if (size_ == messages_.size()) {
+            messages_.emplace_back(static_cast<std::pmr::memory_resource*>(&arena_));
+        }
+        return messages_[size_++];
+    }
+
+    /**
+     * @brief Drop the last message; its arena memory is reclaimed by clear()
+     */
+    void pop_back() noexcept { --size_; }
+
+    /**
+     * @brief Decode a frame into a new message at the end of the batch
+     * @return false (batch unchanged) if data does not decode
+     */
+    bool append(ConstPayload data, const StringRegistry* strings = nullptr) {
+        Message<T>& message = emplace_back();
+        const bool decoded = strings ? Message<T>::deserialize_into(data, message, *strings)
+                                     : Message<T>::deserialize_into(data, message);
+        if (!decoded) pop_back();
+        return decoded;
+    }
+
+    /**
+     * @brief Empty the batch and rewind the arena to its initial buffer
+     *
+     * The message objects stay for reuse; only their arena strings (and
+     * attachments) are dropped, so nothing points into released memory.
+     */
+    void clear() noexcept {
+        for (Message<T>& message : messages_) {
+            if constexpr (DescribedFields<T>) serialization::bind_resource(message.payload(), &arena_);
+            if constexpr (AttachmentPayload<T>) message.payload().attachment() = ImageBuffer{};
+        }
+        size_ = 0;
+        arena_.release();
+    }
+
+    [[nodiscard]] size_t size() const noexcept { return size_; }
+    [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+    [[nodiscard]] const Message<T>& operator[](size_t index) const noexcept { return messages_[index]; }
+    [[nodiscard]] Message<T>& operator[](size_t index) noexcept { return messages_[index]; }
+
+    [[nodiscard]] auto begin() const noexcept { return messages_.begin(); }
+    [[nodiscard]] auto end() const noexcept { return messages_.begin() + static_cast<std::ptrdiff_t>(size_); }
+    [[nodiscard]] auto begin() noexcept { return messages_.begin(); }
+    [[nodiscard]] auto end() noexcept { return messages_.begin() + static_cast<std::ptrdiff_t>(size_); }
+
+    /**
+     * @brief The arena, e.g. for Message<T>::deserialize(data, resource)
+     */
+    [[nodiscard]] std::pmr::memory_resource* resource() noexcept { return &arena_; }
+
+private:
+    std::unique_ptr<std::byte[]> buffer_;
+    std::pmr::monotonic_buffer_resource arena_;
+    // Declared last so messages are destroyed before the arena
+    std::vector<Message<T>> messages_;
+    size_t size_{0};  // Messages in use; the rest are kept from earlier batches
+};
+
+}  // namespace sensorstreamkit::core
@@ -0,0 +1,185 @@
+#pragma once
+
+/**
+ * @file message_registry.hpp
+ * @brief Compile-time registry of message types and dispatch on message_type
+ * @author Jo, SeungHyeon (Jo,SH)
+ * @date 2025
+ *
+ * A subscriber that receives several payload types on one socket reads the
+ * 16-bit message_type from the header and jumps straight to the handler
+ * for that type:
+ *
+ * @code
+ * dispatch(frame,
+ *          [](const Message<ImuData>& imu) { ... },
+ *          [](const MessageView<CameraFrameData>& camera) { ... });
+ * @endcode
+ *
+ * The table from message_type to decode-and-call function is built at
+ * compile time for each set of handler types. Dispatch costs one indexed
+ * call, and only the matching type is decoded.
+ */
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "sensorstreamkit/core/message.hpp"
+#include "sensorstreamkit/core/message_view.hpp"
+
+namespace sensorstreamkit::core {
+
+// ============================================================================
+// Registry
+// ============================================================================
+
+/**
+ * @brief Set of payload types that dispatch() can decode
+ *
+ * Ids must be unique. They index a dense table, so keep them small.
+ */
+template <TypedPayload... Ts>
+struct MessageRegistry {
+    static constexpr uint16_t max_id = std::max({uint16_t{0}, message_type_v<Ts>...});
+    static_assert(max_id <= 1024, "message type ids index a dense table; keep them small");
+
+    static_assert([] {
+        constexpr std::array<uint16_t, sizeof...(Ts)> ids{message_type_v<Ts>...};
+        for (size_t i = 0; i < ids.size(); ++i) {
+            for (size_t j = i + 1; j < ids.size(); ++j) {
+                if (ids[i] == ids[j]) return false;
+            }
+        }
+        return true;
+    }(), "message type ids must be unique");
+
+    template <typename T>
+    static constexpr bool contains = (std::same_as<T, Ts> || ...);
+
+    /**
+     * @brief Call f(std::type_identity<T>{}) for every registered T
+     */
+    template <typename F>
+    static constexpr void for_each(F&& f) {
+        (f(std::type_identity<Ts>{}), ...);
+    }
+};
+
+using BuiltinMessages = MessageRegistry<CameraFrameData, LidarScanData, ImuData, ImuBatch>;
+
+
+// ============================================================================
+// Dispatch
+// ============================================================================
+
+namespace detail {
+
+inline constexpr size_t kNoHandler = static_cast<size_t>(-1);
+
+template <typename T, typename H>
+inline constexpr bool takes_message = std::is_invocable_v<H&, const Message<T>&>;
+
+template <typename T, typename H>
+inline constexpr bool takes_view = [] {
+    if constexpr (ViewablePayload<T>) {
+        return std::is_invocable_v<H&, const MessageView<T>&>;
+    } else {
+        return false;
+    }
+}();
+
+/**
+ * @brief Index of the first handler that accepts a Message<T> or MessageView<T>
+ */
+template <typename T, typename... Handlers>
+inline constexpr size_t handler_index = [] {
+    constexpr std::array<bool, sizeof...(Handlers)> accepts{(takes_message<T, Handlers> || takes_view<T, Handlers>)...};
+    for (size_t i = 0; i < accepts.size(); ++i) {
+        if (accepts[i]) return i;
+    }
+    return kNoHandler;
+}();
+
+template <typename T, typename... Handlers>
+bool decode_and_call(ConstPayload data, const StringRegistry* strings, std::tuple<Handlers&...>& handlers) {
+    constexpr size_t index = handler_index<T, Handlers...>;
+    auto& handler = std::get<index>(handlers);
+    using H = std::tuple_element_t<index, std::tuple<Handlers...>>;
+
+    // Handlers taking Message<T> win, so generic lambdas get the owning message
+    if constexpr (takes_message<T, H>) {
+        auto message = strings != nullptr ? Message<T>::deserialize(data, *strings) : Message<T>::deserialize(data);
+        if (!message) return false;
+        std::invoke(handler, std::as_const(*message));
+    } else {
+        auto view = MessageView<T>::from(data, strings);
+        if (!view) return false;
+        std::invoke(handler, std::as_const(*view));
+    }
+    return true;
+}
+
+template <typename Registry, typename... Handlers>
+using DispatchEntry = bool (*)(ConstPayload, const StringRegistry*, std::tuple<Handlers&...>&);
+
+/**
+ * @brief message_type -> decode_and_call<T>; null where no type or handler exists
+ */
+template <typename Registry, typename... Handlers>
+inline constexpr auto dispatch_table = [] {
+    std::array<DispatchEntry<Registry, Handlers...>, Registry::max_id + 1> table{};
+    Registry::for_each([&]<typename T>(std::type_identity<T>) {
+        if constexpr (handler_index<T, Handlers...> != kNoHandler) {
+            table[message_type_v<T>] = &decode_and_call<T, Handlers...>;
+        }
+    });
+    return table;
+}();
+
+}  // namespace detail
+
+/**
+ * @brief Decode data as the type named in its header and pass it to the matching handler
+ *
+ * Each handler takes a const Message<T>& (decoded, owning) or a const
+ * MessageView<T>& (zero-copy). The first handler that accepts the
+ * frame's type is called.
+ * @param strings Registry for interned strings, or nullptr
+ * @return true if a handler was called; false if data is malformed, untyped,
+ *         of a type outside Registry, or has no handler
+ */
+template <typename Registry = BuiltinMessages, typename... Handlers>
+bool dispatch(ConstPayload data, const StringRegistry* strings, Handlers&&... handlers) {
+    MessageHeader header;
+    if (data.size() < MessageHeader::serialized_size() ||
+        !MessageHeader::deserialize_into(data.first(MessageHeader::serialized_size()), header)) {
+        return false;
+    }
+
+    constexpr auto& table = detail::dispatch_table<Registry, std::remove_reference_t<Handlers>...>;
+    if (header.message_type >= table.size()) return false;
+
+    const auto entry = table[header.message_type];
+    if (entry == nullptr) return false;
+
+    std::tuple<std::remove_reference_t<Handlers>&...> refs{handlers...};
+    return entry(data, strings, refs);
+}
+
+/**
+ * @brief dispatch() for frames without interned strings
+ */
+template <typename Registry = BuiltinMessages, typename... Handlers>
+    requires (!(std::convertible_to<Handlers, const StringRegistry*> || ...))
+bool dispatch(ConstPayload data, Handlers&&... handlers) {
+    return dispatch<Registry>(data, nullptr, std::forward<Handlers>(handlers)...);
+}
+
+}  // namespace sensorstreamkit::core
@@ -0,0 +1,362 @@
+#pragma once
+
+/**
+ * @file message_view.hpp
+ * @brief Zero-copy, non-owning views over serialized sensor messages
+ * @author Jo, SeungHyeon (Jo,SH)
+ * @date 2025
+ */
+
+#include <concepts>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include "sensorstreamkit/core/message.hpp"
+
+namespace sensorstreamkit::core {
+
+namespace detail {
+
+/**
+ * @brief Read a trivially copyable value from an unaligned byte position
+ */
+template <typename U>
+    requires std::is_trivially_copyable_v<U>
+[[nodiscard]] inline U load_unaligned(const uint8_t* src) noexcept {
+    U value;
+    std::memcpy(&value, src, sizeof(U));
+    return value;
+}
+
+/**
+ * @brief Position of Member in its class's fields() tuple
+ */
+template <auto Member>
+inline constexpr size_t field_index = [] {
+    using Layout = FieldLayout<typename Field<Member>::class_type>;
+    return []<size_t... I>(std::index_sequence<I...>) {
+        size_t index = Layout::count;
+        ((std::is_same_v<std::remove_cvref_t<typename Layout::template field_t<I>>, Field<Member>> && (index = I, true)) ||
+         ...);
+        return index;
+    }(std::make_index_sequence<Layout::count>{});
+}();
+
+/**
+ * @brief First field of the fixed-size run that holds Member
+ */
+template <auto Member>
+inline constexpr size_t fixed_run_start = [] {
+    using Layout = FieldLayout<typename Field<Member>::class_type>;
+    static_assert(field_index<Member> < Layout::count, "Member is not listed in fields()");
+    static_assert(Layout::is_fixed[field_index<Member>], "Member is not a fixed-size field");
+    size_t first = field_index<Member>;
+    while (first > 0 && Layout::is_fixed[first - 1]) --first;
+    return first;
+}();
+
+/**
+ * @brief Byte offset of Member within its fixed-size run on the wire
+ */
+template <auto Member>
+inline constexpr size_t fixed_offset =
+    FieldLayout<typename Field<Member>::class_type>::run_bytes(fixed_run_start<Member>, field_index<Member>);
+
+/**
+ * @brief Wire size of the whole fixed-size run that holds Member
+ */
+template <auto Member>
+inline constexpr size_t fixed_run_size = [] {
+    using Layout = FieldLayout<typename Field<Member>::class_type>;
+    return Layout::run_bytes(fixed_run_start<Member>, Layout::run_end(field_index<Member>));
+}();
+
+/**
+ * @brief Read Member from the start of its serialized fixed-size run
+ */
+template <auto Member>
+[[nodiscard]] inline auto load_field(const uint8_t* run) noexcept {
+    return load_unaligned<typename Field<Member>::value_type>(run + fixed_offset<Member>);
+}
+
+}  // namespace detail
+
+
+// ============================================================================
+// Payload Views
+// ============================================================================
+
+/**
+ * @brief Non-owning view over a serialized payload of type T
+ *
+ * Specializations validate the buffer once in from() and then expose
+ * std::string_view and scalar accessors that read straight from the
+ * received bytes. A view never allocates and is only valid while the
+ * underlying buffer is alive. Interned strings are resolved against the
+ * given StringRegistry and point into it instead.
+ */
+template <SensorDataType T>
+class PayloadView;
+
+/**
+ * @brief View over a serialized CameraFrameData
+ */
+template <>
+class PayloadView<CameraFrameData> {
+public:
+    [[nodiscard]] static std::optional<PayloadView> from(ConstPayload data,
+                                                       const StringRegistry* strings = nullptr) noexcept;
+
+    [[nodiscard]] std::string_view sensor_id() const noexcept { return sensor_id_; }
+    [[nodiscard]] uint64_t timestamp_ns() const noexcept {
+        return detail::load_field<&CameraFrameData::timestamp_ns_>(fixed_);
+    }
+    [[nodiscard]] uint32_t frame_id() const noexcept { return detail::load_field<&CameraFrameData::frame_id>(fixed_); }
+    [[nodiscard]] uint32_t width() const noexcept { return detail::load_field<&CameraFrameData::width>(fixed_); }
+    [[nodiscard]] uint32_t height() const noexcept { return detail::load_field<&CameraFrameData::height>(fixed_); }
+    [[nodiscard]] std::string_view encoding() const noexcept { return encoding_; }
+
+    /**
+     * @brief Copy the viewed fields into an owning CameraFrameData
+     */
+    [[nodiscard]] CameraFrameData to_owned() const;
+
+    // Fixed section: timestamp_ns, frame_id, width, height
+    static constexpr size_t fixed_size = detail::fixed_run_size<&CameraFrameData::timestamp_ns_>;
+
+private:
+    std::string_view sensor_id_;
+    std::string_view encoding_;
+    const uint8_t* fixed_{nullptr};
+};
+
+/**
+ * @brief View over a serialized LidarScanData
+ */
+template <>
+class PayloadView<LidarScanData> {
+public:
+    [[nodiscard]] static std::optional<PayloadView> from(ConstPayload data,
+                                                       const StringRegistry* strings = nullptr) noexcept;
+
+    [[nodiscard]] std::string_view sensor_id() const noexcept { return sensor_id_; }
+    [[nodiscard]] uint64_t timestamp_ns() const noexcept {
+        return detail::load_field<&LidarScanData::timestamp_ns_>(fixed_);
+    }
+    [[nodiscard]] uint32_t num_points() const noexcept { return detail::load_field<&LidarScanData::num_points>(fixed_); }
+    [[nodiscard]] float scan_duration_ms() const noexcept {
+        return detail::load_field<&LidarScanData::scan_duration_ms>(fixed_);
+    }
+    [[nodiscard]] const PointCloudView& points() const noexcept { return points_; }
+
+    /**
+     * @brief Copy the viewed fields into an owning LidarScanData
+     */
+    [[nodiscard]] LidarScanData to_owned() const;
+
+    // Fixed section: timestamp_ns, num_points, scan_duration_ms
+    static constexpr size_t fixed_size = detail::fixed_run_size<&LidarScanData::timestamp_ns_>;
+
+private:
+    std::string_view sensor_id_;
+    const uint8_t* fixed_{nullptr};
+    PointCloudView points_;
+};
+
+/**
+ * @brief View over a serialized ImuData
+ */
+template <>
+class PayloadView<ImuData> {
+public:
+    [[nodiscard]] static std::optional<PayloadView> from(ConstPayload data,
+                                                       const StringRegistry* strings = nullptr) noexcept;
+
+    [[nodiscard]] std::string_view sensor_id() const noexcept { return sensor_id_; }
+    [[nodiscard]] uint64_t timestamp_ns() const noexcept { return detail::load_field<&ImuData::timestamp_ns_>(fixed_); }
+    [[nodiscard]] float accel_x() const noexcept { return detail::load_field<&ImuData::accel_x>(fixed_); }
+    [[nodiscard]] float accel_y() const noexcept { return detail::load_field<&ImuData::accel_y>(fixed_); }
+    [[nodiscard]] float accel_z() const noexcept { return detail::load_field<&ImuData::accel_z>(fixed_); }
+    [[nodiscard]] float gyro_x() const noexcept { return detail::load_field<&ImuData::gyro_x>(fixed_); }
+    [[nodiscard]] float gyro_y() const noexcept { return detail::load_field<&ImuData::gyro_y>(fixed_); }
+    [[nodiscard]] float gyro_z() const noexcept { return detail::load_field<&ImuData::gyro_z>(fixed_); }
+
+    /**
+     * @brief Copy the viewed fields into an owning ImuData
+     */
+    [[nodiscard]] ImuData to_owned() const;
+
+    // Fixed section: timestamp_ns, accel_xyz, gyro_xyz
+    static constexpr size_t fixed_size = detail::fixed_run_size<&ImuData::timestamp_ns_>;
+
+private:
+    std::string_view sensor_id_;
+    const uint8_t* fixed_{nullptr};
+};
+
+/**
+ * @brief View over a serialized ImuBatch
+ *
+ * from() checks the whole sample section; the columns themselves are
+ * only decoded by samples().decode_into() or to_owned().
+ */
+template <>
+class PayloadView<ImuBatch> {
+public:
+    [[nodiscard]] static std::optional<PayloadView> from(ConstPayload data,
+                                                       const StringRegistry* strings = nullptr) noexcept;
+
+    [[nodiscard]] std::string_view sensor_id() const noexcept { return sensor_id_; }
+
+    /**
+     * @brief Timestamp of the first sample, or 0 if the batch is empty
+     */
+    [[nodiscard]] uint64_t timestamp_ns() const noexcept { return samples_.front_timestamp_ns(); }
+    [[nodiscard]] const ImuSamplesView& samples() const noexcept { return samples_; }
+
+    /**
+     * @brief Copy the viewed fields into an owning ImuBatch
+     */
+    [[nodiscard]] ImuBatch to_owned() const;
+
+private:
+    std::string_view sensor_id_;
+    ImuSamplesView samples_;
+};
+
+/**
+ * @brief Concept for payload types that have a zero-copy PayloadView
+ */
+template <typename T>
+concept ViewablePayload = SensorDataType<T> && requires(const PayloadView<T>& view) {
+    { PayloadView<T>::from(ConstPayload{}) } -> std::same_as<std::optional<PayloadView<T>>>;
+    { view.sensor_id() } -> std::same_as<std::string_view>;
+    { view.timestamp_ns() } -> std::same_as<uint64_t>;
+    { view.to_owned() } -> std::same_as<T>;
+};
+
+
+// ============================================================================
+// Message View
+// ============================================================================
+
+/**
+ * @brief Zero-copy counterpart of Message<T>
+ *
+ * Validates the serialized message once and exposes the header by value
+ * and the payload as a PayloadView<T> pointing into the original bytes.
+ * A checksummed frame is verified in from(), which reads it once more.
+ */
+template <ViewablePayload T>
+class MessageView {
+public:
+    [[nodiscard]] static std::optional<MessageView> from(ConstPayload data,
+                                                         const StringRegistry* strings = nullptr) noexcept {
+        auto header = MessageHeader::deserialize(data);
+        if (!header || header->has_unknown_flags()) return std::nullopt;
+        if (!MessageHeader::type_matches<T>(header->message_type)) return std::nullopt;
+
+        ConstPayload payload_bytes = data.subspan(MessageHeader::serialized_size());
+        HeaderExtensionsView extensions;
+        if (header->flags & MessageHeader::kFlagExtensions) {
+            if (payload_bytes.size() < MessageHeader::kExtensionSizeBytes) return std::nullopt;
+            const auto size = detail::load_unaligned<uint16_t>(payload_bytes.data());
+            payload_bytes = payload_bytes.subspan(MessageHeader::kExtensionSizeBytes);
+            if (payload_bytes.size() < size) return std::nullopt;
+            auto entries = HeaderExtensionsView::from(payload_bytes.first(size));
+            if (!entries) return std::nullopt;
+            extensions = *entries;
+            payload_bytes = payload_bytes.subspan(size);
+        }
+
+        if (header->has_checksum()) {
+            if (payload_bytes.size() < MessageHeader::kChecksumSize) return std::nullopt;
+            payload_bytes = payload_bytes.first(payload_bytes.size() - MessageHeader::kChecksumSize);
+
+            const size_t covered = data.size() - MessageHeader::kChecksumSize;
+            if (crc32c::compute(data.first(covered)) != detail::load_unaligned<uint32_t>(data.data() + covered)) {
+                return std::nullopt;
+            }
+        }
+
+        // Attachment section at the end: [bytes] [u32 size]
+        ConstPayload attachment;
+        if (header->flags & MessageHeader::kFlagAttachment) {
+            if (payload_bytes.size() < MessageHeader::kAttachmentSizeBytes) return std::nullopt;
+            const auto size = detail::load_unaligned<uint32_t>(payload_bytes.data() + payload_bytes.size() -
+                                                               MessageHeader::kAttachmentSizeBytes);
+            payload_bytes = payload_bytes.first(payload_bytes.size() - MessageHeader::kAttachmentSizeBytes);
+            if (!(header->flags & MessageHeader::kFlagAttachmentDetached)) {
+                if (payload_bytes.size() < size) return std::nullopt;
+                attachment = payload_bytes.last(size);
+                payload_bytes = payload_bytes.first(payload_bytes.size() - size);
+            }
+        }
+
+        auto payload = PayloadView<T>::from(payload_bytes, strings);
+        if (!payload) return std::nullopt;
+        if constexpr (PointCloudPayload<T>) {
+            // Only a flagged frame may carry a cloud (see NativeCodec::decode)
+            if (payload->points().empty() == ((header->flags & MessageHeader::kFlagPointCloud) != 0)) {
+                return std::nullopt;
+            }
+        }
+
+        // As in Message<T>, header() reports the caller's flags, not the frame's
+        header->flags &= ~MessageHeader::kFrameFlags;
+        return MessageView(*header, *payload, data, attachment, extensions, strings);
+    }
+
+    [[nodiscard]] const MessageHeader& header() const noexcept { return header_; }
+    [[nodiscard]] const PayloadView<T>& payload() const noexcept { return payload_; }
+
+    /**
+     * @brief Raw bytes this view points into
+     */
+    [[nodiscard]] ConstPayload bytes() const noexcept { return bytes_; }
+
+    /**
+     * @brief Attachment bytes carried in the frame (e.g. camera pixels)
+     *
+     * Empty if the frame has none or its attachment was sent separately.
+     */
+    [[nodiscard]] ConstPayload attachment() const noexcept { return attachment_; }
+
+    /**
+     * @brief Header extension entries, pointing into the frame
+     */
+    [[nodiscard]] HeaderExtensionsView extensions() const noexcept { return extensions_; }
+
+    /**
+     * @brief Materialize an owning Message<T> (allocates)
+     */
+    [[nodiscard]] std::optional<Message<T>> to_message() const {
+        if (strings_ != nullptr) return Message<T>::deserialize(bytes_, *strings_);
+        return Message<T>::deserialize(bytes_);
+    }
+
+private:
+    MessageView(const MessageHeader& header, const PayloadView<T>& payload, ConstPayload bytes,
+                ConstPayload attachment, HeaderExtensionsView extensions, const StringRegistry* strings) noexcept
+        : header_(header), payload_(payload), bytes_(bytes), attachment_(attachment), extensions_(extensions)
+        , strings_(strings) {}
+
+    MessageHeader header_;
+    PayloadView<T> payload_;
+    ConstPayload bytes_;
+    ConstPayload attachment_;
+    HeaderExtensionsView extensions_;
+    const StringRegistry* strings_;
+};
+
+// Verify concepts are satisfied
+static_assert(ViewablePayload<CameraFrameData>);
+static_assert(ViewablePayload<LidarScanData>);
+static_assert(ViewablePayload<ImuData>);
+static_assert(ViewablePayload<ImuBatch>);
+
+}  // namespace sensorstreamkit::core
@@ -0,0 +1,212 @@
+#pragma once
+
+/**
+ * @file point_cloud.hpp
+ * @brief Structure-of-arrays lidar point cloud with optional int16 quantization
+ * @author Jo, SeungHyeon (Jo,SH)
+ * @date 2025
+ *
+ * Each point attribute is its own cache-line aligned column, so a pass
+ * over one attribute (e.g. a height filter on z) reads only that column
+ * and vectorizes with aligned loads. On the wire the columns follow each other:
+ *
+ *   u32 count | f32 resolution | x | y | z | intensity | ring | time_offset_ns
+ *
+ * With resolution 0 the coordinates are float32. With resolution > 0 they
+ * are int16 multiples of resolution metres, e.g. 5 mm steps cover ±163 m
+ * at 14 instead of 20 bytes per point.
+ *
+ * An empty cloud writes nothing, so a payload without points keeps the
+ * layout it had before clouds existed. The cloud must therefore be the
+ * payload's last field: a payload that ends where the cloud would start
+ * reads as an empty cloud. Frames carrying one set
+ * MessageHeader::kFlagPointCloud, so older readers reject them.
+ */
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <span>
+#include <vector>
+
+#include "sensorstreamkit/core/aligned_allocator.hpp"
+#include "sensorstreamkit/core/serialization.hpp"
+
+namespace sensorstreamkit::core {
+
+// ============================================================================
+// Quantization Kernels
+// ============================================================================
+
+namespace quantization {
+
+// Written for NaN (no return); never the result of saturating a number
+inline constexpr int16_t kInvalidStep = std::numeric_limits<int16_t>::min();
+inline constexpr float kMinStep = -32767.0f;
+inline constexpr float kMaxStep = 32767.0f;
+
+/**
+ * @brief Write count coordinates as int16 multiples of resolution
+ *
+ * Rounds to nearest (ties to even) and saturates values outside
+ * ±32767 steps, infinities included. NaN is written as kInvalidStep.
+ * dst need not be aligned. Uses SSE2 or NEON when built for them; all
+ * paths give the same result.
+ */
+void encode(uint8_t* dst, const float* src, size_t count, float resolution) noexcept;
+
+/**
+ * @brief Expand count int16 steps at src (unaligned) back to coordinates
+ *
+ * kInvalidStep decodes to NaN.
+ */
+void decode(float* dst, const uint8_t* src, size_t count, float resolution) noexcept;
+
+}  // namespace quantization
+
+
+// ============================================================================
+// Point Cloud
+// ============================================================================
+
+/**
+ * @brief One point, for building a cloud or reading it point by point
+ */
+struct LidarPoint {
+    float x{0.0f};
+    float y{0.0f};
+    float z{0.0f};
+    uint16_t intensity{0};
+    uint16_t ring{0};            // Laser / beam index
+    uint32_t time_offset_ns{0};  // Since the start of the scan
+
+    bool operator==(const LidarPoint&) const = default;
+};
+
+/**
+ * @brief Point cloud stored as one column per attribute
+ *
+ * All columns always have size() elements.
+ */
+class PointCloud {
+public:
+    enum class Axis : uint8_t { X, Y, Z };
+
+    PointCloud() = default;
+    explicit PointCloud(size_t size) { resize(size); }
+
+    [[nodiscard]] size_t size() const noexcept { return x_.size(); }
+    [[nodiscard]] bool empty() const noexcept { return x_.empty(); }
+
+    void resize(size_t size);
+    void reserve(size_t size);
+    void clear() noexcept;
+
+    void push_back(const LidarPoint& point);
+    [[nodiscard]] LidarPoint point(size_t index) const noexcept;
+
+    [[nodiscard]] std::span<float> x() noexcept { return x_; }
+    [[nodiscard]] std::span<float> y() noexcept { return y_; }
+    [[nodiscard]] std::span<float> z() noexcept { return z_; }
+    [[nodiscard]] std::span<uint16_t> intensity() noexcept { return intensity_; }
+    [[nodiscard]] std::span<uint16_t> ring() noexcept { return ring_; }
+    [[nodiscard]] std::span<uint32_t> time_offset_ns() noexcept { return time_offset_ns_; }
+
+    [[nodiscard]] std::span<const float> x() const noexcept { return x_; }
+    [[nodiscard]] std::span<const float> y() const noexcept { return y_; }
+    [[nodiscard]] std::span<const float> z() const noexcept { return z_; }
+    [[nodiscard]] std::span<const uint16_t> intensity() const noexcept { return intensity_; }
+    [[nodiscard]] std::span<const uint16_t> ring() const noexcept { return ring_; }
+    [[nodiscard]] std::span<const uint32_t> time_offset_ns() const noexcept { return time_offset_ns_; }
+
+    [[nodiscard]] std::span<float> coordinates(Axis axis) noexcept;
+    [[nodiscard]] std::span<const float> coordinates(Axis axis) const noexcept;
+
+    /**
+     * @brief Metres per int16 step used on the wire; 0 sends float32
+     *
+     * set_resolution() stores 0 for anything valid_resolution() rejects.
+     */
+    [[nodiscard]] float resolution() const noexcept { return resolution_; }
+    void set_resolution(float metres) noexcept { resolution_ = valid_resolution(metres) ? metres : 0.0f; }
+    [[nodiscard]] bool quantized() const noexcept { return resolution_ > 0.0f; }
+
+    /**
+     * @brief 0, or a finite step whose reciprocal (the quantizing scale) is finite too
+     *
+     * Rules out subnormal steps, for which 1/resolution overflows to inf.
+     */
+    [[nodiscard]] static bool valid_resolution(float metres) noexcept {
+        return metres == 0.0f || (metres > 0.0f && std::isfinite(metres) && std::isfinite(1.0f / metres));
+    }
+
+    bool operator==(const PointCloud&) const = default;
+
+    // Wire bytes per point besides the coordinates
+    static constexpr size_t kAttributeBytes = 2 * sizeof(uint16_t) + sizeof(uint32_t);
+
+private:
+    AlignedVector<float> x_;
+    AlignedVector<float> y_;
+    AlignedVector<float> z_;
+    AlignedVector<uint16_t> intensity_;
+    AlignedVector<uint16_t> ring_;
+    AlignedVector<uint32_t> time_offset_ns_;
+    float resolution_{0.0f};
+};
+
+/**
+ * @brief Non-owning view over a serialized PointCloud
+ *
+ * Columns are decoded on demand, so a subscriber that needs only z
+ * dequantizes only z.
+ */
+class PointCloudView {
+public:
+    /**
+     * @brief Validate a cloud at data[offset] and advance offset past it
+     *
+     * offset == data.size() gives an empty cloud (see file comment).
+     */
+    [[nodiscard]] static std::optional<PointCloudView> from(ConstPayload data, size_t& offset) noexcept;
+
+    [[nodiscard]] size_t size() const noexcept { return size_; }
+    [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+    [[nodiscard]] float resolution() const noexcept { return resolution_; }
+    [[nodiscard]] bool quantized() const noexcept { return resolution_ > 0.0f; }
+
+    /**
+     * @brief Write one coordinate column to out, which must hold size() values
+     */
+    void decode(PointCloud::Axis axis, std::span<float> out) const noexcept;
+
+    /**
+     * @brief Decode all columns into out, reusing its capacity
+     */
+    void decode_into(PointCloud& out) const;
+
+    [[nodiscard]] PointCloud to_owned() const;
+
+private:
+    [[nodiscard]] size_t coordinate_bytes() const noexcept {
+        return quantized() ? sizeof(int16_t) : sizeof(float);
+    }
+
+    const uint8_t* columns_{nullptr};
+    size_t size_{0};
+    float resolution_{0.0f};
+};
+
+/**
+ * @brief Wire encoding of a PointCloud field (see file comment)
+ */
+template <>
+struct FieldCodec<PointCloud> {
+    [[nodiscard]] static size_t size(const PointCloud& cloud) noexcept;
+    static uint8_t* write(uint8_t* dst, const PointCloud& cloud) noexcept;
+    static bool read(ConstPayload data, size_t& offset, PointCloud& cloud);
+};
+
+}  // namespace sensorstreamkit::core
@@ -0,0 +1,647 @@
+#pragma once
+
+/**
+ * @file serialization.hpp
+ * @brief Compile-time field descriptors that generate binary serializers
+ * @author Jo, SeungHyeon (Jo,SH)
+ * @date 2025
+ *
+ * A payload describes its wire layout declaratively:
+ *
+ * @code
+ * static constexpr auto fields() noexcept {
+ *     return std::tuple{field<&ImuData::sensor_id_>, field<&ImuData::timestamp_ns_>, ...};
+ * }
+ * @endcode
+ *
+ * and serialized_size()/serialize_into()/deserialize_into() are generated
+ * from that tuple. Adjacent fixed-size fields form a run that is bounds
+ * checked once and, when the members are also adjacent in memory, copied
+ * with a single memcpy.
+ *
+ * Every generated function optionally takes a StringRegistry. String
+ * fields found in it are written as a 4-byte id instead of their bytes.
+ *
+ * The checksumming overloads extend a CRC32C over each field right after
+ * writing or reading it, while its bytes are still in cache, instead of
+ * making a second pass over the whole payload.
+ */
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+#include <span>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "sensorstreamkit/core/crc32c.hpp"
+#include "sensorstreamkit/core/string_registry.hpp"
+
+namespace sensorstreamkit::core {
+
+// ============================================================================
+// Type definitions for Payloads
+// ============================================================================
+
+using ConstPayload = std::span<const uint8_t>;
+using MutablePayload = std::span<uint8_t>;
+
+
+// ============================================================================
+// Field Codecs
+// ============================================================================
+
+/**
+ * @brief Wire encoding of a single field value type
+ *
+ * Fixed-size codecs expose `fixed_size` and are copied bytewise.
+ * Variable-size codecs expose:
+ *   - size_t size(const V&)
+ *   - uint8_t* write(uint8_t* dst, const V&)         (returns advanced dst)
+ *   - bool read(ConstPayload data, size_t& offset, V&) (false on overrun)
+ * and may add overloads of all three taking a trailing
+ * `const StringRegistry*` to support interning.
+ *
+ * A variable codec whose encoding is fitted to the value (see PlannedCodec)
+ * also exposes `Plan plan(const V&)` and size()/write() overloads taking
+ * that Plan, so one serialize call fits the value once.
+ */
+template <typename V>
+struct FieldCodec;
+
+/**
+ * @brief Trivially copyable values are written as their object representation
+ */
+template <typename V>
+    requires std::is_trivially_copyable_v<V>
+struct FieldCodec<V> {
+    static constexpr size_t fixed_size = sizeof(V);
+};
+
+/**
+ * @brief Strings are written as a uint32 length prefix followed by the bytes
+ *
+ * With a registry, an interned string is written as just the prefix with
+ * StringRegistry::kInternedFlag set and the id in the low bits. Covers
+ * std::string and std::pmr::string; reads keep the string's allocator.
+ */
+template <typename Allocator>
+struct FieldCodec<std::basic_string<char, std::char_traits<char>, Allocator>> {
+    using String = std::basic_string<char, std::char_traits<char>, Allocator>;
+
+    [[nodiscard]] static size_t size(const String& value) noexcept {
+        return sizeof(uint32_t) + value.size();
+    }
+
+    static uint8_t* write(uint8_t* dst, const String& value) noexcept {
+        // Cache size: memcpy may alias value, so value.size() would be reloaded
+        const size_t size = value.size();
+        const auto len = static_cast<uint32_t>(size);
+        std::memcpy(dst, &len, sizeof(len));
+        std::memcpy(dst + sizeof(len), value.data(), size);
+        return dst + sizeof(len) + size;
+    }
+
+    static bool read(ConstPayload data, size_t& offset, String& value) {
+        return read(data, offset, value, nullptr);
+    }
+
+    [[nodiscard]] static size_t size(const String& value, const StringRegistry* strings) noexcept {
+        if (strings != nullptr && strings->id_of(value)) return sizeof(uint32_t);
+        return size(value);
+    }
+
+    static uint8_t* write(uint8_t* dst, const String& value, const StringRegistry* strings) noexcept {
+        if (strings != nullptr) {
+            if (auto id = strings->id_of(value)) {
+                const uint32_t tag = StringRegistry::kInternedFlag | *id;
+                std::memcpy(dst, &tag, sizeof(tag));
+                return dst + sizeof(tag);
+            }
+        }
+        return write(dst, value);
+    }
+
+    static bool read(ConstPayload data, size_t& offset, String& value, const StringRegistry* strings) {
+        uint32_t len;
+        if (data.size() - offset < sizeof(len)) [[unlikely]] return false;
+        std::memcpy(&len, data.data() + offset, sizeof(len));
+        offset += sizeof(len);
+
+        if (len & StringRegistry::kInternedFlag) {
+            if (strings == nullptr) [[unlikely]] return false;
+            auto interned = strings->lookup(len & ~StringRegistry::kInternedFlag);
+            if (!interned) [[unlikely]] return false;
+            value.assign(*interned);
+            return true;
+        }
+
+        if (data.size() - offset < len) [[unlikely]] return false;
+        value.assign(reinterpret_cast<const char*>(data.data() + offset), len);
+        offset += len;
+        return true;
+    }
+};
+
+/**
+ * @brief Value types whose codec has a compile-time wire size
+ */
+template <typename V>
+concept FixedSizeField = requires { { FieldCodec<V>::fixed_size } -> std::convertible_to<size_t>; };
+
+/**
+ * @brief Variable codecs that fit their encoding to the value before writing it
+ *
+ * serialization::plan() fits each such field once and write_unchecked()
+ * writes with the same Plan. Planned codecs take no StringRegistry.
+ */
+template <typename C, typename V>
+concept PlannedCodec = requires(const V& value, uint8_t* dst, const typename C::Plan& plan) {
+    { C::plan(value) } -> std::same_as<typename C::Plan>;
+    { C::size(value, plan) } -> std::same_as<size_t>;
+    { C::write(dst, value, plan) } -> std::same_as<uint8_t*>;
+};
+
+
+// ============================================================================
+// Field Descriptors
+// ============================================================================
+
+namespace detail {
+
+template <typename M>
+struct member_pointer_traits;
+
+template <typename C, typename V>
+struct member_pointer_traits<V C::*> {
+    using class_type = C;
+    using value_type = V;
+};
+
+}  // namespace detail
+
+/**
+ * @brief Compile-time descriptor for one serialized data member
+ */
+template <auto Member>
+struct Field {
+    using class_type = typename detail::member_pointer_traits<decltype(Member)>::class_type;
+    using value_type = typename detail::member_pointer_traits<decltype(Member)>::value_type;
+    using codec = FieldCodec<value_type>;
+
+    static constexpr auto member = Member;
+    static constexpr bool is_fixed = FixedSizeField<value_type>;
+    static constexpr size_t fixed_size = [] {
+        if constexpr (is_fixed) {
+            return codec::fixed_size;
+        } else {
+            return size_t{0};
+        }
+    }();
+};
+
+template <auto Member>
+inline constexpr Field<Member> field{};
+
+/**
+ * @brief Types that describe their wire layout with a static fields() tuple
+ */
+template <typename T>
+concept DescribedFields = requires { { T::fields() }; } &&
+                          (std::tuple_size_v<decltype(T::fields())> > 0);
+
+/**
+ * @brief Compile-time layout facts derived from T::fields()
+ */
+template <DescribedFields T>
+struct FieldLayout {
+    using Fields = decltype(T::fields());
+    static constexpr size_t count = std::tuple_size_v<Fields>;
+
+    template <size_t I>
+    using field_t = std::tuple_element_t<I, Fields>;
+
+    static constexpr std::array<bool, count> is_fixed = []<size_t... I>(std::index_sequence<I...>) {
+        return std::array<bool, count>{field_t<I>::is_fixed...};
+    }(std::make_index_sequence<count>{});
+
+    static constexpr std::array<size_t, count> fixed_size = []<size_t... I>(std::index_sequence<I...>) {
+        return std::array<size_t, count>{field_t<I>::fixed_size...};
+    }(std::make_index_sequence<count>{});
+
+    // Sum of all fixed-size fields; variable fields add their own size on top
+    static constexpr size_t fixed_bytes = [] {
+        size_t total = 0;
+        for (size_t size : fixed_size) total += size;
+        return total;
+    }();
+
+    // One past the last field of the fixed run starting at index first
+    static constexpr size_t run_end(size_t first) noexcept {
+        while (first < count && is_fixed[first]) ++first;
+        return first;
+    }
+
+    static constexpr size_t run_bytes(size_t first, size_t last) noexcept {
+        size_t total = 0;
+        for (size_t i = first; i < last; ++i) total += fixed_size[i];
+        return total;
+    }
+};
+
+
+/**
+ * @brief Described types that can be copied to and from the wire as one block
+ *
+ * T is trivially copyable and its fields are all fixed-size and fill all
+ * of sizeof(T), so there is no padding. If fields() also lists them in
+ * declaration order (serialization::is_block_layout()), the object bytes
+ * are exactly the wire bytes.
+ */
+template <typename T>
+concept BlockCopyable = DescribedFields<T> && std::is_trivially_copyable_v<T> &&
+                        FieldLayout<T>::run_end(0) == FieldLayout<T>::count &&
+                        FieldLayout<T>::fixed_bytes == sizeof(T);
+
+
+// ============================================================================
+// Generated Serializers
+// ============================================================================
+
+namespace serialization {
+
+namespace detail {
+
+struct NoPlan {};
+
+template <typename F>
+struct field_plan {
+    using type = NoPlan;
+};
+
+template <typename F>
+    requires PlannedCodec<typename F::codec, typename F::value_type>
+struct field_plan<F> {
+    using type = typename F::codec::Plan;
+};
+
+template <typename T, typename Indices>
+struct field_plans;
+
+template <typename T, size_t... I>
+struct field_plans<T, std::index_sequence<I...>> {
+    using type = std::tuple<typename field_plan<typename FieldLayout<T>::template field_t<I>>::type...>;
+};
+
+}  // namespace detail
+
+/**
+ * @brief Wire size of one object plus the Plan of each PlannedCodec field
+ *
+ * Made by plan() and consumed by write_unchecked() within one serialize
+ * call; it describes obj as it was when planned, so it is not kept.
+ */
+template <DescribedFields T>
+struct WritePlan {
+    size_t size{0};
+    typename detail::field_plans<T, std::make_index_sequence<FieldLayout<T>::count>>::type fields{};
+};
+
+namespace detail {
+
+template <typename T, size_t I>
+[[nodiscard]] inline size_t member_offset(const T& obj) noexcept {
+    using F = typename FieldLayout<T>::template field_t<I>;
+    return static_cast<size_t>(reinterpret_cast<const std::byte*>(std::addressof(obj.*F::member)) -
+                               reinterpret_cast<const std::byte*>(std::addressof(obj)));
+}
+
+/**
+ * @brief True if fields [First, Last) are laid out back-to-back in T
+ *
+ * Offsets of members are constants, so after inlining this folds to a
+ * compile-time true/false and the unused copy path is dropped.
+ */
+template <typename T, size_t First, size_t Last>
+[[nodiscard]] inline bool run_is_contiguous(const T& obj) noexcept {
+    using L = FieldLayout<T>;
+    return [&]<size_t... K>(std::index_sequence<K...>) {
+        return ((member_offset<T, First + K + 1>(obj) ==
+                 member_offset<T, First + K>(obj) + L::fixed_size[First + K]) && ...);
+    }(std::make_index_sequence<Last - First - 1>{});
+}
+
+template <typename T, size_t First, size_t Last>
+inline uint8_t* write_run(const T& obj, uint8_t* dst) noexcept {
+    using L = FieldLayout<T>;
+    constexpr size_t bytes = L::run_bytes(First, Last);
+
+    if (run_is_contiguous<T, First, Last>(obj)) {
+        const auto* base = reinterpret_cast<const std::byte*>(std::addressof(obj));
+        std::memcpy(dst, base + member_offset<T, First>(obj), bytes);
+    } else {
+        [&]<size_t... K>(std::index_sequence<K...>) {
+            size_t offset = 0;
+            ((std::memcpy(dst + offset,
+                          std::addressof(obj.*L::template field_t<First + K>::member),
+                          L::fixed_size[First + K]),
+              offset += L::fixed_size[First + K]), ...);
+        }(std::make_index_sequence<Last - First>{});
+    }
+    return dst + bytes;
+}
+
+template <typename T, size_t First, size_t Last>
+inline bool read_run(ConstPayload data, size_t& offset, T& obj) noexcept {
+    using L = FieldLayout<T>;
+    constexpr size_t bytes = L::run_bytes(First, Last);
+
+    // One bounds check for the whole run
+    if (data.size() - offset < bytes) [[unlikely]] return false;
+    const uint8_t* src = data.data() + offset;
+
+    if (run_is_contiguous<T, First, Last>(obj)) {
+        auto* base = reinterpret_cast<std::byte*>(std::addressof(obj));
+        std::memcpy(base + member_offset<T, First>(obj), src, bytes);
+    } else {
+        [&]<size_t... K>(std::index_sequence<K...>) {
+            size_t run_offset = 0;
+            ((std::memcpy(std::addressof(obj.*L::template field_t<First + K>::member),
+                          src + run_offset,
+                          L::fixed_size[First + K]),
+              run_offset += L::fixed_size[First + K]), ...);
+        }(std::make_index_sequence<Last - First>{});
+    }
+    offset += bytes;
+    return true;
+}
+
+// Variable codecs without registry overloads are called without it
+template <typename C, typename V>
+[[nodiscard]] inline size_t codec_size(const V& value, const StringRegistry* strings) noexcept {
+    if constexpr (requires { C::size(value, strings); }) {
+        return C::size(value, strings);
+    } else {
+        return C::size(value);
+    }
+}
+
+template <typename C, typename V>
+inline uint8_t* codec_write(uint8_t* dst, const V& value, const StringRegistry* strings) noexcept {
+    if constexpr (requires { C::write(dst, value, strings); }) {
+        return C::write(dst, value, strings);
+    } else {
+        return C::write(dst, value);
+    }
+}
+
+// Writes field I with its plan when one was made, else lets the codec plan
+template <typename T, size_t I>
+inline uint8_t* write_field(const T& obj, uint8_t* dst, const StringRegistry* strings,
+                            [[maybe_unused]] const WritePlan<T>* plan) noexcept {
+    using F = typename FieldLayout<T>::template field_t<I>;
+    if constexpr (PlannedCodec<typename F::codec, typename F::value_type>) {
+        if (plan != nullptr) return F::codec::write(dst, obj.*F::member, std::get<I>(plan->fields));
+    }
+    return codec_write<typename F::codec>(dst, obj.*F::member, strings);
+}
+
+template <typename C, typename V>
+inline bool codec_read(ConstPayload data, size_t& offset, V& value, const StringRegistry* strings) {
+    if constexpr (requires { C::read(data, offset, value, strings); }) {
+        return C::read(data, offset, value, strings);
+    } else {
+        return C::read(data, offset, value);
+    }
+}
+
+// With Checksum, crc is extended over [from, to) once each field is written
+template <bool Checksum>
+inline uint8_t* checksum_written(const uint8_t* from, uint8_t* to, uint32_t* crc) noexcept {
+    if constexpr (Checksum) {
+        *crc = crc32c::extend(*crc, from, static_cast<size_t>(to - from));
+    }
+    return to;
+}
+
+template <typename T, size_t I, bool Checksum = false>
+inline uint8_t* write_from(const T& obj, uint8_t* dst, const StringRegistry* strings,
+                           uint32_t* crc = nullptr, const WritePlan<T>* plan = nullptr) noexcept {
+    using L = FieldLayout<T>;
+    if constexpr (I == L::count) {
+        return dst;
+    } else if constexpr (L::is_fixed[I]) {
+        constexpr size_t last = L::run_end(I);
+        uint8_t* next = checksum_written<Checksum>(dst, write_run<T, I, last>(obj, dst), crc);
+        return write_from<T, last, Checksum>(obj, next, strings, crc, plan);
+    } else {
+        uint8_t* next = checksum_written<Checksum>(dst, write_field<T, I>(obj, dst, strings, plan), crc);
+        return write_from<T, I + 1, Checksum>(obj, next, strings, crc, plan);
+    }
+}
+
+// With Checksum, crc is extended over data[start, offset) once a field has been read
+template <bool Checksum>
+inline void checksum_read(ConstPayload data, size_t start, size_t offset, uint32_t* crc) noexcept {
+    if constexpr (Checksum) {
+        *crc = crc32c::extend(*crc, data.data() + start, offset - start);
+    }
+}
+
+template <typename T, size_t I, bool Checksum = false>
+inline bool read_from(ConstPayload data, size_t& offset, T& obj, const StringRegistry* strings,
+                      uint32_t* crc = nullptr) {
+    using L = FieldLayout<T>;
+    if constexpr (I == L::count) {
+        return true;
+    } else if constexpr (L::is_fixed[I]) {
+        constexpr size_t last = L::run_end(I);
+        const size_t start = offset;
+        if (!read_run<T, I, last>(data, offset, obj)) [[unlikely]] return false;
+        checksum_read<Checksum>(data, start, offset, crc);
+        return read_from<T, last, Checksum>(data, offset, obj, strings, crc);
+    } else {
+        using F = typename L::template field_t<I>;
+        const size_t start = offset;
+        if (!codec_read<typename F::codec>(data, offset, obj.*F::member, strings)) [[unlikely]] return false;
+        checksum_read<Checksum>(data, start, offset, crc);
+        return read_from<T, I + 1, Checksum>(data, offset, obj, strings, crc);
+    }
+}
+
+template <typename T, size_t I>
+[[nodiscard]] inline size_t variable_size(const T& obj, const StringRegistry* strings) noexcept {
+    using F = typename FieldLayout<T>::template field_t<I>;
+    if constexpr (F::is_fixed) {
+        return 0;
+    } else {
+        return codec_size<typename F::codec>(obj.*F::member, strings);
+    }
+}
+
+// Like variable_size(), but keeps the plan of a PlannedCodec field for writing
+template <typename T, size_t I>
+[[nodiscard]] inline size_t planned_size(const T& obj, [[maybe_unused]] const StringRegistry* strings,
+                                  [[maybe_unused]] WritePlan<T>& plan) noexcept {
+    using F = typename FieldLayout<T>::template field_t<I>;
+    if constexpr (PlannedCodec<typename F::codec, typename F::value_type>) {
+        auto& field_plan = std::get<I>(plan.fields);
+        field_plan = F::codec::plan(obj.*F::member);
+        return F::codec::size(obj.*F::member, field_plan);
+    } else {
+        return variable_size<T, I>(obj, strings);
+    }
+}
+
+template <typename T, size_t I>
+inline void bind_field(T& obj, std::pmr::memory_resource* resource) noexcept {
+    using F = typename FieldLayout<T>::template field_t<I>;
+    using V = typename F::value_type;
+    if constexpr (std::uses_allocator_v<V, std::pmr::polymorphic_allocator<>>) {
+        // Allocators do not propagate on assignment, so rebuild the member in place
+        V* member = std::addressof(obj.*F::member);
+        std::destroy_at(member);
+        std::construct_at(member, typename V::allocator_type(resource));
+    }
+}
+
+}  // namespace detail
+
+/**
+ * @brief Make obj's allocator-aware fields (e.g. std::pmr::string) allocate from resource
+ *
+ * Those fields are reset to empty; other fields keep their values.
+ * Copies of obj allocate from the default resource again, moves keep resource.
+ */
+template <DescribedFields T>
+inline void bind_resource(T& obj, std::pmr::memory_resource* resource) noexcept {
+    [&]<size_t... I>(std::index_sequence<I...>) {
+        (detail::bind_field<T, I>(obj, resource), ...);
+    }(std::make_index_sequence<FieldLayout<T>::count>{});
+}
+
+/**
+ * @brief True if obj's object bytes are exactly its wire bytes
+ *
+ * Folds to a constant after inlining, like the contiguity check for runs.
+ */
+template <BlockCopyable T>
+[[nodiscard]] inline bool is_block_layout(const T& obj) noexcept {
+    return detail::member_offset<T, 0>(obj) == 0 && detail::run_is_contiguous<T, 0, FieldLayout<T>::count>(obj);
+}
+
+/**
+ * @brief Exact wire size of obj (with strings interned in strings, if given)
+ */
+template <DescribedFields T>
+[[nodiscard]] inline size_t serialized_size(const T& obj, const StringRegistry* strings = nullptr) noexcept {
+    using L = FieldLayout<T>;
+    return L::fixed_bytes + [&]<size_t... I>(std::index_sequence<I...>) {
+        return (detail::variable_size<T, I>(obj, strings) + ... + size_t{0});
+    }(std::make_index_sequence<L::count>{});
+}
+
+/**
+ * @brief serialized_size() that also keeps what write_unchecked() needs to skip refitting
+ */
+template <DescribedFields T>
+[[nodiscard]] inline WritePlan<T> plan(const T& obj, const StringRegistry* strings = nullptr) noexcept {
+    using L = FieldLayout<T>;
+    WritePlan<T> result;
+    result.size = L::fixed_bytes + [&]<size_t... I>(std::index_sequence<I...>) {
+        return (detail::planned_size<T, I>(obj, strings, result) + ... + size_t{0});
+    }(std::make_index_sequence<L::count>{});
+    return result;
+}
+
+/**
+ * @brief Write obj to dst, which must hold serialized_size(obj, strings) bytes
+ * @return One past the last byte written
+ */
+template <DescribedFields T>
+inline uint8_t* write_unchecked(const T& obj, uint8_t* dst, const StringRegistry* strings = nullptr) noexcept {
+    return detail::write_from<T, 0>(obj, dst, strings);
+}
+
+/**
+ * @brief write_unchecked() that also extends crc over every byte written
+ */
+template <DescribedFields T>
+inline uint8_t* write_unchecked(const T& obj, uint8_t* dst, const StringRegistry* strings, uint32_t& crc) noexcept {
+    return detail::write_from<T, 0, true>(obj, dst, strings, &crc);
+}
+
+/**
+ * @brief write_unchecked() with the plans made by plan(obj, strings)
+ *
+ * dst must hold plan.size bytes, and obj must not have changed since.
+ */
+template <DescribedFields T>
+inline uint8_t* write_unchecked(const T& obj, uint8_t* dst, const WritePlan<T>& plan,
+                                const StringRegistry* strings = nullptr) noexcept {
+    return detail::write_from<T, 0>(obj, dst, strings, nullptr, &plan);
+}
+
+template <DescribedFields T>
+inline uint8_t* write_unchecked(const T& obj, uint8_t* dst, const WritePlan<T>& plan, const StringRegistry* strings,
+                                uint32_t& crc) noexcept {
+    return detail::write_from<T, 0, true>(obj, dst, strings, &crc, &plan);
+}
+
+/**
+ * @brief Write obj into a caller-owned buffer
+ * @return Bytes written, or 0 if out is smaller than serialized_size(obj)
+ */
+template <DescribedFields T>
+inline size_t serialize_into(const T& obj, MutablePayload out, const StringRegistry* strings = nullptr) noexcept {
+    const WritePlan<T> fitted = plan(obj, strings);
+    if (out.size() < fitted.size) [[unlikely]] return 0;
+
+    write_unchecked(obj, out.data(), fitted, strings);
+    return fitted.size;
+}
+
+/**
+ * @brief Overwrite obj in place from data
+ * @return false if data is truncated or holds an id unknown to strings;
+ *         obj is then partially updated
+ */
+template <DescribedFields T>
+inline bool deserialize_into(ConstPayload data, T& obj, const StringRegistry* strings = nullptr) {
+    size_t offset = 0;
+    return detail::read_from<T, 0>(data, offset, obj, strings);
+}
+
+/**
+ * @brief deserialize_into() that also extends crc over the bytes it reads
+ *
+ * data must be exactly one serialized T, so that crc ends up covering all
+ * of it.
+ * @return false as above, or if data has bytes left after the last field
+ */
+template <DescribedFields T>
+inline bool deserialize_into(ConstPayload data, T& obj, const StringRegistry* strings, uint32_t& crc) {
+    size_t offset = 0;
+    return detail::read_from<T, 0, true>(data, offset, obj, strings, &crc) && offset == data.size();
+}
+
+/**
+ * @brief Construct a T from data
+ */
+template <DescribedFields T>
+[[nodiscard]] inline std::optional<T> deserialize(ConstPayload data, const StringRegistry* strings = nullptr) {
+    T result;
+    if (!deserialize_into(data, result, strings)) return std::nullopt;
+    return result;
+}
+
+}  // namespace serialization
+
+}  // namespace sensorstreamkit::core
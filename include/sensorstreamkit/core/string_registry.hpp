@@ -0,0 +1,113 @@
+#pragma once
+
+/**
+ * @file string_registry.hpp
+ * @brief Interning table that maps sensor ids and encodings to compact wire ids
+ * @author Jo, SeungHyeon (Jo,SH)
+ * @date 2025
+ *
+ * A string field normally goes on the wire as a uint32 length followed by
+ * its bytes. When the serializer is given a registry that contains the
+ * string, it writes only the uint32 with the top bit set and the id in the
+ * low 31 bits. The receiver resolves the id against its own copy of the
+ * registry, which the publisher announces on a side topic.
+ *
+ * Ids are dense, assigned in intern() order, and never reused, so an
+ * announcement is just the list of strings. Entries are never removed,
+ * and string_views returned by lookup() stay valid for the registry's
+ * lifetime (or until clear()).
+ */
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace sensorstreamkit::core {
+
+// Topic on which publishers announce their registry
+inline constexpr std::string_view kStringRegistryTopic = "__ssk/strings";
+
+/**
+ * @brief Bidirectional string <-> id table (not thread-safe; populate before sharing)
+ */
+class StringRegistry {
+public:
+    // Length-prefix bit marking an interned string; the low bits are the id
+    static constexpr uint32_t kInternedFlag = 0x8000'0000u;
+    static constexpr uint32_t kMaxId = kInternedFlag - 1;
+
+    StringRegistry() = default;
+
+    // Non-copyable (the index views into names_), movable without allocating
+    StringRegistry(const StringRegistry&) = delete;
+    StringRegistry& operator=(const StringRegistry&) = delete;
+    StringRegistry(StringRegistry&&) noexcept = default;
+    StringRegistry& operator=(StringRegistry&&) noexcept = default;
+
+    /**
+     * @brief Add str if not present
+     * @return Its id, or nullopt if the registry already holds kMaxId + 1 strings
+     */
+    std::optional<uint32_t> intern(std::string_view str);
+
+    /**
+     * @brief Id of str, or nullopt if it was never interned
+     */
+    [[nodiscard]] std::optional<uint32_t> id_of(std::string_view str) const noexcept {
+        auto it = ids_.find(str);
+        if (it == ids_.end()) return std::nullopt;
+        return it->second;
+    }
+
+    /**
+     * @brief String for id, or nullopt if id is unknown
+     */
+    [[nodiscard]] std::optional<std::string_view> lookup(uint32_t id) const noexcept {
+        if (id >= names_.size()) [[unlikely]] return std::nullopt;
+        return *names_[id];
+    }
+
+    [[nodiscard]] size_t size() const noexcept { return names_.size(); }
+    [[nodiscard]] bool empty() const noexcept { return names_.empty(); }
+
+    /**
+     * @brief Forget all strings, so ids start from 0 again
+     *
+     * Invalidates string_views returned by lookup().
+     */
+    void clear() noexcept {
+        ids_.clear();
+        names_.clear();
+    }
+
+    /**
+     * @brief Append the announcement: [u32 count] then count x [u32 len][bytes]
+     */
+    void serialize(std::vector<uint8_t>& buffer) const;
+
+    /**
+     * @brief Apply an announcement from the publisher
+     *
+     * New ids are appended. Ids that are already known must map to the
+     * same string; on any mismatch or malformed input nothing is changed.
+     * @return true if the announcement was applied
+     */
+    bool merge(std::span<const uint8_t> announcement);
+
+private:
+    // Indexed by id; each string has its own allocation, so views survive growth
+    std::vector<std::unique_ptr<const std::string>> names_;
+    std::unordered_map<std::string_view, uint32_t> ids_;  // Keys view into names_
+};
+
+// Subscribers reset and move their registry in noexcept functions
+static_assert(std::is_nothrow_move_constructible_v<StringRegistry>);
+static_assert(std::is_nothrow_move_assignable_v<StringRegistry>);
+
+}  // namespace sensorstreamkit::core
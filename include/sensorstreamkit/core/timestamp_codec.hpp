@@ -0,0 +1,76 @@
+#pragma once
+
+/**
+ * @file timestamp_codec.hpp
+ * @brief Compact encoding for runs of nearly periodic timestamps
+ * @author Jo, SeungHyeon (Jo,SH)
+ * @date 2025
+ *
+ * Samples of a fixed-rate sensor sit close to a straight line, so a run
+ * of timestamps is sent as that line plus each sample's small offset
+ * from it:
+ *
+ *   u64 base | u64 period (ns, 16 fractional bits) | u8 width | width bytes x count
+ *
+ * Sample i decodes to base + (i * period >> 16) + residual[i]. width is
+ * the smallest of 0, 1, 2, 4 or 8 bytes that holds every signed
+ * residual. A 1 kHz IMU with sub-microsecond jitter needs 2 bytes per
+ * timestamp instead of 8, a perfectly regular one none. Arithmetic wraps
+ * modulo 2^64, so any input, even unordered, round-trips exactly.
+ *
+ * Residuals are whole bytes rather than arbitrary bit widths so that the
+ * decoder is a plain load / sign-extend / add loop that compilers
+ * vectorize.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+
+#include "sensorstreamkit/core/serialization.hpp"
+
+namespace sensorstreamkit::core::timestamp_codec {
+
+/**
+ * @brief Line and residual width chosen for one run of timestamps
+ */
+struct Plan {
+    uint64_t base{0};
+    uint64_t period_q16{0};  // ns per sample, 16.16 fixed point
+    uint8_t width{0};        // Bytes per residual: 0, 1, 2, 4 or 8
+
+    static constexpr size_t kHeaderBytes = 2 * sizeof(uint64_t) + sizeof(uint8_t);
+};
+
+/**
+ * @brief Fit the line for timestamps and find the residual width
+ */
+[[nodiscard]] Plan plan(std::span<const uint64_t> timestamps) noexcept;
+
+/**
+ * @brief Bytes encode() writes for timestamps under plan
+ */
+[[nodiscard]] inline size_t encoded_size(const Plan& plan, size_t count) noexcept {
+    return Plan::kHeaderBytes + count * plan.width;
+}
+
+/**
+ * @brief Write timestamps as planned
+ * @return One past the last byte written
+ */
+uint8_t* encode(uint8_t* dst, const Plan& plan, std::span<const uint64_t> timestamps) noexcept;
+
+/**
+ * @brief Decode out.size() timestamps at data[offset] and advance offset past them
+ * @return false if data is truncated or has an invalid width
+ */
+bool decode(ConstPayload data, size_t& offset, std::span<uint64_t> out) noexcept;
+
+/**
+ * @brief Check count timestamps at data[offset] and advance offset past them, decoding only the first
+ * @return The first timestamp (0 if count is 0), or nullopt as for decode()
+ */
+std::optional<uint64_t> skip(ConstPayload data, size_t& offset, size_t count) noexcept;
+
+}  // namespace sensorstreamkit::core::timestamp_codec
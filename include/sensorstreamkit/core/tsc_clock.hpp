@@ -0,0 +1,67 @@
+#pragma once
+
+/**
+ * @file tsc_clock.hpp
+ * @brief Invariant-TSC clock calibrated against std::chrono::steady_clock
+ * @author Jo, SeungHyeon (Jo,SH)
+ * @date 2025
+ *
+ * Reading the time stamp counter costs a few nanoseconds, versus a vDSO
+ * call (or worse, a syscall on some VMs) for steady_clock. The counter is
+ * converted to nanoseconds in steady_clock's epoch, so TSC and steady
+ * timestamps can be compared and mixed.
+ *
+ * calibrate() measures the tick rate over kCalibrationWindow. After that,
+ * now_ns() re-anchors to steady_clock about every kRecalibrationInterval.
+ * It slews the rate toward steady_clock instead of stepping, so the clock
+ * stays continuous. Readings never go below the latest one returned on
+ * any thread.
+ */
+
+#include <chrono>
+#include <cstdint>
+
+namespace sensorstreamkit::core {
+
+namespace detail {
+
+/**
+ * @brief steady_clock::now() in nanoseconds since its epoch
+ */
+[[nodiscard]] inline uint64_t steady_clock_ns() noexcept {
+    const auto now = std::chrono::steady_clock::now().time_since_epoch();
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(now).count());
+}
+
+}  // namespace detail
+
+class TscClock {
+public:
+    static constexpr std::chrono::milliseconds kCalibrationWindow{10};
+    static constexpr std::chrono::milliseconds kRecalibrationInterval{1000};
+
+    /**
+     * @brief True on x86 CPUs that report an invariant (constant-rate, non-stop) TSC
+     */
+    [[nodiscard]] static bool available() noexcept;
+
+    /**
+     * @brief Measure the tick rate against steady_clock (blocks for kCalibrationWindow)
+     *
+     * Re-running it re-anchors to steady_clock. A step back is absorbed:
+     * now_ns() holds at its latest reading until the new line passes it.
+     * @return false if the TSC is not available
+     */
+    static bool calibrate() noexcept;
+
+    [[nodiscard]] static bool is_calibrated() noexcept;
+
+    /**
+     * @brief Current time in steady_clock's epoch
+     *
+     * Falls back to steady_clock until calibrate() has succeeded.
+     */
+    [[nodiscard]] static uint64_t now_ns() noexcept;
+};
+
+}  // namespace sensorstreamkit::core
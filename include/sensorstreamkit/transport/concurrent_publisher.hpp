@@ -0,0 +1,199 @@
+#pragma once
+
+/**
+ * @file concurrent_publisher.hpp
+ * @brief Thread-safe publisher: many producer threads, one socket-owning I/O thread
+ * @author Jo, SeungHyeon (Jo,SH)
+ * @date 2025
+ *
+ * ZeroMQ sockets must not be shared between threads, so a ZmqPublisher
+ * belongs to one thread. ConcurrentPublisher lets any number of threads
+ * publish through one socket: each producer serializes its message on its
+ * own thread into a ZeroMQ frame and pushes it into a bounded lock-free
+ * ring, and a dedicated I/O thread takes the frames out in batches and
+ * sends them the way ZmqPublisher::publish_batch() does: consecutive
+ * frames for one topic share a topic part. Producers never touch the socket. Queueing takes no lock,
+ * but frames of SendBufferPool::kMinBlockBytes and up come from the
+ * publisher's send buffer pool, whose size classes each have a mutex:
+ * producers of large frames (lidar scans, batched samples) share it with
+ * each other and with the I/O thread that returns sent blocks.
+ */
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <stop_token>
+#include <string>
+#include <string_view>
+#include <thread>
+
+#include "sensorstreamkit/core/aligned_allocator.hpp"
+#include "sensorstreamkit/core/message.hpp"
+#include "sensorstreamkit/transport/zmq_publisher.hpp"
+
+namespace sensorstreamkit::transport {
+
+/**
+ * @brief What publish() does when the queue is full
+ */
+enum class OverflowPolicy : uint8_t {
+    Block,  // Wait for the I/O thread to free a slot (or for stop)
+    Drop,   // Fail the publish at once and count it in messages_dropped()
+};
+
+/**
+ * @brief Configuration for ConcurrentPublisher
+ */
+struct ConcurrentPublisherConfig {
+    PublisherConfig publisher{};  // Socket options for the I/O thread's publisher
+    size_t queue_capacity = 1024;  // Rounded up to a power of two
+    size_t max_batch = 64;  // Messages the I/O thread takes out per pass, at most
+    OverflowPolicy overflow = OverflowPolicy::Block;
+    int drain_timeout_ms = 1000;  // How long stop() lets queued messages go out before dropping them (< 0 is 0)
+};
+
+/**
+ * @brief ZmqPublisher front end that any number of threads may publish through
+ *
+ * Messages from one producer thread go out in the order they were
+ * published; messages from different threads are interleaved in the order
+ * they were queued. Messages are sent as serialize_into() writes them
+ * (FlatBufferCodec messages as encode() builds them): string interning and
+ * separate attachment parts are ZmqPublisher features and are not used here.
+ *
+ * Messages may be published before bind()/connect(); they wait in the
+ * queue until the I/O thread starts.
+ */
+class ConcurrentPublisher {
+public:
+    explicit ConcurrentPublisher(const ConcurrentPublisherConfig& config = {});
+
+    /**
+     * @brief stop(), then drop anything still queued
+     */
+    ~ConcurrentPublisher();
+
+    // The I/O thread refers to this object: neither copyable nor movable
+    ConcurrentPublisher(const ConcurrentPublisher&) = delete;
+    ConcurrentPublisher& operator=(const ConcurrentPublisher&) = delete;
+
+    /**
+     * @brief Bind to endpoint and start the I/O thread
+     * @return true if successful; false without touching the socket if
+     *         already started or stopped
+     */
+    [[nodiscard]] bool bind();
+
+    /**
+     * @brief Connect to endpoint and start the I/O thread
+     * @return true if successful; false without touching the socket if
+     *         already started or stopped
+     */
+    [[nodiscard]] bool connect();
+
+    /**
+     * @brief Queue a message for sending; safe to call from any thread
+     * @param stoken Cancels waiting for a free slot under OverflowPolicy::Block
+     * @return true if queued; false if the queue was full (Drop), stopped, or cancelled
+     */
+    template <SensorDataType T, typename Codec>
+    bool publish(std::string_view topic, const Message<T, Codec>& message, std::stop_token stoken = {}) {
+        if constexpr (std::same_as<Codec, FlatBufferCodec>) {
+            // Same bytes, built once in this thread's builder rather than once to size and once to write
+            return publish_raw(topic, FlatBufferCodec::encode(message, flatbuffer_builder()), stoken);
+        } else {
+            // Serialize on the calling thread, straight into the frame that is sent
+            zmq::message_t data_msg = publisher_.frame_message(message.serialized_size());
+            if (message.serialize_into({static_cast<uint8_t*>(data_msg.data()), data_msg.size()}) == 0) {
+                return false;
+            }
+            return enqueue(topic, data_msg, stoken);
+        }
+    }
+
+    /**
+     * @brief Queue a copy of raw bytes for sending; safe to call from any thread
+     */
+    bool publish_raw(std::string_view topic, std::span<const uint8_t> data, std::stop_token stoken = {});
+
+    /**
+     * @brief Send what is queued, stop the I/O thread and refuse further publishes
+     *
+     * Queued messages get drain_timeout_ms to go out. After that, a send
+     * waiting on a full pipe is cancelled and the rest are dropped, so
+     * stop() returns even with send_timeout_ms < 0. Producers waiting for
+     * a slot return false. A publish that races with stop() may be left unsent.
+     */
+    void stop();
+
+    /**
+     * @brief Get total messages sent by the I/O thread
+     */
+    [[nodiscard]] uint64_t messages_sent() const noexcept {
+        return publisher_.messages_sent();
+    }
+
+    /**
+     * @brief Get total messages refused because the queue was full (OverflowPolicy::Drop)
+     */
+    [[nodiscard]] uint64_t messages_dropped() const noexcept {
+        return messages_dropped_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Number of messages the queue holds
+     */
+    [[nodiscard]] size_t queue_capacity() const noexcept {
+        return mask_ + 1;
+    }
+
+private:
+    // One queued frame; sequence says whose turn the slot is (see enqueue())
+    struct alignas(core::kCacheLineSize) Slot {
+        std::atomic<uint64_t> sequence{0};
+        std::string topic;
+        zmq::message_t data;
+    };
+
+    /**
+     * @brief The calling producer thread's FlatBuffers builder, kept between publishes
+     */
+    static flatbuffers::FlatBufferBuilder& flatbuffer_builder();
+
+    bool can_start() const noexcept;
+    bool start();
+    bool enqueue(std::string_view topic, zmq::message_t& data_msg, std::stop_token stoken);
+    bool wait_for_space(std::stop_token stoken);
+    bool slot_ready(uint64_t position) const noexcept;
+    size_t send_batch();
+    void run(std::stop_token stoken);
+
+    ConcurrentPublisherConfig config_;
+    ZmqPublisher publisher_;  // Used by the I/O thread only, apart from frame_message()
+    std::unique_ptr<Slot[]> slots_;
+    size_t mask_;
+
+    alignas(core::kCacheLineSize) std::atomic<uint64_t> tail_{0};  // Next position producers claim
+    alignas(core::kCacheLineSize) uint64_t head_{0};  // Next position the I/O thread sends; its own
+
+    // Sleeping and waking; only touched when the queue runs empty or full
+    std::mutex wake_mutex_;
+    std::condition_variable_any messages_ready_;
+    std::condition_variable_any space_ready_;
+    std::atomic<bool> io_waiting_{false};
+    std::atomic<uint32_t> producers_waiting_{0};
+    std::atomic<bool> closed_{false};
+
+    // Ending the drain: run() sets io_done_ once empty; stop() cancels sends at the deadline
+    std::condition_variable_any io_finished_;
+    bool io_done_{false};  // Guarded by wake_mutex_
+    std::stop_source drain_expired_;
+
+    std::atomic<uint64_t> messages_dropped_{0};
+    std::jthread io_thread_;
+};
+
+}  // namespace sensorstreamkit::transport
@@ -0,0 +1,77 @@
+#pragma once
+
+/**
+ * @file send_buffer_pool.hpp
+ * @brief Reusable, size-classed buffers for outgoing ZeroMQ messages
+ * @author Jo, SeungHyeon (Jo,SH)
+ *
+ * ZmqPublisher serializes a frame straight into its zmq::message_t. For
+ * small frames that is one cheap allocation inside libzmq; for large ones
+ * (lidar scans, batched samples) it is a fresh multi-page allocation per
+ * publish, and past the allocator's mmap threshold every publish also
+ * faults its pages in again. SendBufferPool hands out blocks in
+ * power-of-two size classes and gives ZeroMQ a free callback that puts the
+ * block back in its class once the message has been sent, so steady-state
+ * publishing reuses the same warm memory.
+ *
+ * ZeroMQ calls the free callback from whichever thread drops the last
+ * reference (usually its I/O thread), so taking and returning blocks is
+ * thread-safe: each size class keeps its free list under its own mutex.
+ * Blocks still in flight keep the pool's storage alive after the
+ * SendBufferPool itself is destroyed.
+ */
+
+#include <zmq.hpp>
+#include <cstddef>
+#include <cstdint>
+
+namespace sensorstreamkit::transport {
+
+class SendBufferPool {
+public:
+    // Smaller frames are left to libzmq's own allocation, which is cheaper for them
+    static constexpr size_t kMinBlockBytes = 4 * 1024;
+    static constexpr size_t kMaxBlockBytes = 16 * 1024 * 1024;
+    static constexpr size_t kDefaultMaxCachedBytes = 64 * 1024 * 1024;
+
+    /**
+     * @param max_cached_bytes Idle bytes kept for reuse; blocks returned past
+     *                         this are freed
+     */
+    explicit SendBufferPool(size_t max_cached_bytes = kDefaultMaxCachedBytes);
+    ~SendBufferPool();
+
+    SendBufferPool(const SendBufferPool&) = delete;
+    SendBufferPool& operator=(const SendBufferPool&) = delete;
+    SendBufferPool(SendBufferPool&& other) noexcept;
+    SendBufferPool& operator=(SendBufferPool&& other) noexcept;
+
+    /**
+     * @brief True if size is served from the pool
+     */
+    [[nodiscard]] static constexpr bool pooled(size_t size) noexcept {
+        return size >= kMinBlockBytes && size <= kMaxBlockBytes;
+    }
+
+    /**
+     * @brief Rebuild msg as size bytes in a pooled block (cache-line aligned, uninitialized)
+     * @return false (msg unchanged) if !pooled(size)
+     */
+    bool rebuild(zmq::message_t& msg, size_t size);
+
+    /**
+     * @brief Blocks taken from the heap so far; steady state stops increasing it
+     */
+    [[nodiscard]] uint64_t blocks_allocated() const noexcept;
+
+    /**
+     * @brief Bytes in idle blocks waiting for reuse
+     */
+    [[nodiscard]] size_t cached_bytes() const noexcept;
+
+private:
+    struct Shared;
+    Shared* shared_;  // Reference counted by this object and every block in flight
+};
+
+}  // namespace sensorstreamkit::transport
@@ -0,0 +1,83 @@
+#pragma once
+
+/**
+ * @file zmq_context.hpp
+ * @brief ZeroMQ context shared between sockets, with I/O thread count and placement
+ * @author Jo, SeungHyeon (Jo,SH)
+ * @date 2025
+ *
+ * Every ZeroMQ context runs its own I/O threads. A publisher, subscriber
+ * or broker that makes its own context therefore adds a thread per
+ * socket. ZmqContext is one context that many of them can share, sized
+ * and placed once for the whole process: how many I/O threads, which CPUs
+ * they may run on, and their scheduling priority. Sharing a context also
+ * lets sockets reach each other over inproc://.
+ */
+
+#include <zmq.hpp>
+#include <memory>
+#include <vector>
+
+namespace sensorstreamkit::transport {
+
+/**
+ * @brief I/O thread settings, applied when the context is created
+ */
+struct ContextConfig {
+    int io_threads = 1;  // ZMQ_IO_THREADS
+    std::vector<int> io_thread_cpus{};  // ZMQ_THREAD_AFFINITY_CPU_ADD each; empty = any CPU
+    int io_thread_sched_policy = -1;  // ZMQ_THREAD_SCHED_POLICY (e.g. SCHED_FIFO); -1 = OS default
+    int io_thread_priority = -1;  // ZMQ_THREAD_PRIORITY; -1 = OS default
+};
+
+/**
+ * @brief Owner of one zmq::context_t, shared by the sockets created in it
+ *
+ * Sockets keep a std::shared_ptr<ZmqContext>, so the context is terminated
+ * only after the last of them is closed. Reference one from
+ * PublisherConfig::context, SubscriberConfig::context or ZmqTransport.
+ */
+class ZmqContext {
+public:
+    /**
+     * @throws zmq::error_t if the context rejects one of the settings
+     */
+    explicit ZmqContext(const ContextConfig& config = {});
+    ~ZmqContext();
+
+    // Sockets refer to the context by address: neither copyable nor movable
+    ZmqContext(const ZmqContext&) = delete;
+    ZmqContext& operator=(const ZmqContext&) = delete;
+
+    /**
+     * @brief The process-wide context, created on first use
+     *
+     * Uses the settings given to configure_shared(), or ContextConfig{}.
+     */
+    [[nodiscard]] static std::shared_ptr<ZmqContext> shared();
+
+    /**
+     * @brief Set up the process-wide context before anything uses it
+     * @return false if shared() has already created it (settings unchanged)
+     */
+    static bool configure_shared(const ContextConfig& config);
+
+    [[nodiscard]] zmq::context_t& get() noexcept {
+        return context_;
+    }
+
+    [[nodiscard]] const ContextConfig& config() const noexcept {
+        return config_;
+    }
+
+    /**
+     * @brief Number of I/O threads, as the context reports it
+     */
+    [[nodiscard]] int io_threads();
+
+private:
+    ContextConfig config_;
+    zmq::context_t context_;
+};
+
+}  // namespace sensorstreamkit::transport
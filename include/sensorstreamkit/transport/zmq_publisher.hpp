@@ -14,9 +14,15 @@
 #include <thread>
 #include <atomic>
 #include <optional>
+#include <ranges>
+#include <span>
 #include <stop_token>
+#include <vector>
 
 #include "sensorstreamkit/core/message.hpp"
+#include "sensorstreamkit/core/flatbuffers_codec.hpp"
+#include "sensorstreamkit/transport/send_buffer_pool.hpp"
+#include "sensorstreamkit/transport/zmq_context.hpp"
 
 using namespace sensorstreamkit::core;
 
@@ -30,6 +36,20 @@ struct PublisherConfig {
     int high_water_mark = 1000;
     int send_timeout_ms = 1000;
     bool conflate = false;  // Keep only last message per topic
+    uint32_t string_announce_interval = 100;  // Re-announce the string registry every N publishes (0 is taken as 1)
+    bool pool_send_buffers = true;  // Reuse buffers for frames of SendBufferPool::kMinBlockBytes and up
+    std::shared_ptr<ZmqContext> context{};  // e.g. ZmqContext::shared(); nullptr = a private context
+    uint64_t io_affinity = 0;  // ZMQ_AFFINITY: bit i = context I/O thread i may serve this socket; 0 = any
+};
+
+/**
+ * @brief One topic + payload pair for ZmqPublisher::publish_batch()
+ *
+ * Both views must stay valid for the duration of the call only.
+ */
+struct OutgoingMessage {
+    std::string_view topic;
+    std::span<const uint8_t> data;
 };
 
 /**
@@ -60,20 +80,99 @@ public:
 
     /**
      * @brief Publish a message with topic
+     *
+     * A non-empty attachment (e.g. camera pixels) goes out as its own
+     * message part without being copied; the publisher keeps a handle to it
+     * until ZeroMQ has sent it. Messages with a codec other than
+     * NativeCodec are sent as that codec encodes them, without string
+     * interning or a separate attachment part.
      * @tparam T Message payload type (must satisfy SensorDataType concept)
+     * @tparam Codec Wire format of the message (see MessageCodec)
      * @param topic Topic string for subscribers to filter
      * @param message The message to publish
      * @return true if sent successfully
      */
-    template <SensorDataType T>
-    bool publish(std::string_view topic, const Message<T>& message, std::stop_token stoken = {}) {
-        std::vector<uint8_t> buffer;
-        message.serialize(buffer);
-        return publish_raw(topic, buffer, stoken);
+    template <SensorDataType T, typename Codec>
+    bool publish(std::string_view topic, const Message<T, Codec>& message, std::stop_token stoken = {}) {
+        if (!send_encoded(topic, message, stoken)) {
+            return false;
+        }
+        messages_sent_.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    /**
+     * @brief Publish several raw messages in one call
+     *
+     * Messages go out in order, back to back. The bound and stop checks run
+     * once for the batch, and the topic part is built once per run of
+     * messages with the same topic. Each message is sent without blocking;
+     * only a full pipe makes the call wait, as in publish(), and a stop
+     * requested mid-batch takes effect there. Sending stops at the first
+     * message that fails, and messages_sent() is updated once for the batch.
+     * @return Number of messages sent: messages[0, n) went out, the rest did not
+     */
+    size_t publish_batch(std::span<const OutgoingMessage> messages, std::stop_token stoken = {});
+
+    /**
+     * @brief publish() every Message<T, Codec> in messages to topic, as one batch
+     *
+     * One topic part is built for the whole batch and copied for each message.
+     * @return Number of messages sent, in order; see publish_batch(std::span<const OutgoingMessage>)
+     */
+    template <std::ranges::input_range R>
+        requires AnyMessage<std::remove_cvref_t<std::ranges::range_reference_t<R>>>
+    size_t publish_batch(std::string_view topic, R&& messages, std::stop_token stoken = {}) {
+        if (!bound_ || stoken.stop_requested()) {
+            return 0;
+        }
+        BatchTopic batch_topic{zmq::message_t(topic.data(), topic.size())};
+        size_t sent = 0;
+        for (const auto& message : messages) {
+            if (!send_encoded(batch_topic, message, stoken)) {
+                break;
+            }
+            ++sent;
+        }
+        messages_sent_.fetch_add(sent, std::memory_order_relaxed);
+        return sent;
+    }
+
+    /**
+     * @brief Send sensor ids/encodings found in strings as compact ids from now on
+     *
+     * The registry is announced on kStringRegistryTopic before the next
+     * publish() and then every string_announce_interval publishes, so late
+     * subscribers catch up. Only publishes that were sent count toward the
+     * interval, and an announcement that fails to send is tried again
+     * before the next publish. Announcements are not counted in
+     * messages_sent(). The registry must not be modified while set.
+     * @param strings Registry to use, or nullptr to send strings inline again
+     */
+    void set_string_registry(std::shared_ptr<const StringRegistry> strings);
+
+    /**
+     * @brief Announce the current string registry immediately
+     * @return true if sent; false if no registry is set or sending failed
+     */
+    bool announce_strings(std::stop_token stoken = {});
+
+    /**
+     * @brief Publish a message encoded with the FlatBuffers schema
+     *
+     * Subscribers read it in place with ZmqSubscriber::receive_flatbuffer<T>().
+     * The builder is kept and reused, so steady-state encoding does not allocate.
+     */
+    template <FlatBufferPayload T, typename Codec>
+    bool publish_flatbuffer(std::string_view topic, const Message<T, Codec>& message, std::stop_token stoken = {}) {
+        return publish_raw(topic, FlatBufferCodec::encode(message, flatbuffer_builder()), stoken);
     }
 
     /**
      * @brief Publish raw bytes with topic
+     *
+     * data may be any contiguous bytes, e.g. a std::vector<uint8_t> or an
+     * AlignedBuffer filled by Message<T>::serialize().
      */
     bool publish_raw(std::string_view topic, std::span<const uint8_t> data, std::stop_token stoken = {});
 
@@ -84,15 +183,168 @@ public:
         return messages_sent_.load();
     }
 
+    /**
+     * @brief Pool that large frames are serialized into (see PublisherConfig::pool_send_buffers)
+     */
+    [[nodiscard]] const SendBufferPool& send_buffers() const noexcept {
+        return send_buffers_;
+    }
+
     /**
      * @brief Swap contents with another publisher
      */
     void swap(ZmqPublisher& other) noexcept;
 
 private:
+    friend class ConcurrentPublisher;  // Fills frames on producer threads, sends on its I/O thread
+
+    /**
+     * @brief Topic part built once for a batch; each send takes a copy of it
+     *
+     * Sends through it skip the bound and stop checks, which the batch ran up front.
+     */
+    struct BatchTopic {
+        zmq::message_t part;
+    };
+
+    /**
+     * @brief Encode and send message without counting it in messages_sent()
+     * @param topic Topic name, or a BatchTopic within publish_batch()
+     */
+    template <typename Topic, SensorDataType T, typename Codec>
+    bool send_encoded(Topic& topic, const Message<T, Codec>& message, std::stop_token stoken) {
+        if constexpr (std::same_as<Codec, FlatBufferCodec>) {
+            // Same bytes, built once in the kept builder
+            return send_raw(topic, FlatBufferCodec::encode(message, flatbuffer_builder()), stoken);
+        } else if constexpr (!InterningCodec<Codec, T>) {
+            zmq::message_t data_msg = frame_message(message.serialized_size());
+            if (message.serialize_into({static_cast<uint8_t*>(data_msg.data()), data_msg.size()}) == 0) {
+                return false;
+            }
+            return send_message(topic, data_msg, stoken);
+        } else {
+            return send_framed(topic, message, stoken);
+        }
+    }
+
+    template <typename Topic, SensorDataType T, typename Codec>
+    bool send_framed(Topic& topic, const Message<T, Codec>& message, std::stop_token stoken) {
+        if constexpr (AttachmentPayload<T>) {
+            if (!message.payload().attachment().empty()) {
+                return send_detached(topic, message, stoken);
+            }
+        }
+
+        if (strings_) {
+            announce_strings_if_due(stoken);
+            zmq::message_t data_msg = frame_message(message.serialized_size(*strings_));
+            if (message.serialize_into({static_cast<uint8_t*>(data_msg.data()), data_msg.size()}, *strings_) == 0) {
+                return false;  // Never send a frame that was not fully written
+            }
+            if (!send_message(topic, data_msg, stoken)) {
+                return false;
+            }
+            count_interned_publish();
+            return true;
+        }
+
+        // Size once and serialize straight into the outgoing frame
+        zmq::message_t data_msg = frame_message(message.serialized_size());
+        if (message.serialize_into({static_cast<uint8_t*>(data_msg.data()), data_msg.size()}) == 0) {
+            return false;
+        }
+        return send_message(topic, data_msg, stoken);
+    }
+
+    template <typename Topic, SensorDataType T, typename Codec>
+        requires AttachmentPayload<T>
+    bool send_detached(Topic& topic, const Message<T, Codec>& message, std::stop_token stoken) {
+        const StringRegistry* strings = strings_.get();
+        if (strings) {
+            announce_strings_if_due(stoken);
+        }
+
+        zmq::message_t data_msg = frame_message(message.serialized_size_detached(strings));
+        if (message.serialize_detached_into({static_cast<uint8_t*>(data_msg.data()), data_msg.size()}, strings) == 0) {
+            return false;
+        }
+        zmq::message_t attachment_msg = attachment_message(message.payload().attachment());
+        if (!send_message(topic, data_msg, stoken, &attachment_msg)) {
+            return false;
+        }
+        if (strings) {
+            count_interned_publish();
+        }
+        return true;
+    }
+
+    /**
+     * @brief Copy data into an outgoing part and send it, without counting it
+     */
+    bool send_raw(std::string_view topic, std::span<const uint8_t> data, std::stop_token stoken);
+    bool send_raw(BatchTopic& topic, std::span<const uint8_t> data, std::stop_token stoken);
+
+    /**
+     * @brief The kept FlatBuffers builder, created on first use
+     */
+    flatbuffers::FlatBufferBuilder& flatbuffer_builder();
+
+    /**
+     * @brief Uninitialized outgoing part of size bytes, in a pooled buffer if the pool serves that size
+     */
+    zmq::message_t frame_message(size_t size);
+
+    /**
+     * @brief Message part that refers to buffer's bytes and holds a handle until ZeroMQ releases it
+     */
+    static zmq::message_t attachment_message(const ImageBuffer& buffer);
+
+    /**
+     * @brief Copy data into an outgoing part, pooled like frame_message()
+     */
+    zmq::message_t raw_frame(std::span<const uint8_t> data);
+
+    /**
+     * @brief Send topic + data parts if the socket takes them without blocking
+     * @return nullopt if the pipe is full (nothing was queued), else whether the parts were sent
+     */
+    std::optional<bool> try_send(zmq::message_t& topic_msg, zmq::message_t& data_msg, zmq::message_t* attachment);
+
+    /**
+     * @brief Send topic + data parts, waiting for the socket to become writable if it is full
+     *
+     * Tries a non-blocking send first and only polls (up to send_timeout_ms,
+     * or until stoken is triggered) when that would block. Callers count
+     * the message in messages_sent().
+     * @param attachment Optional third part sent after data_msg
+     */
+    bool send_message(std::string_view topic, zmq::message_t& data_msg, std::stop_token stoken,
+                      zmq::message_t* attachment = nullptr);
+
+    /**
+     * @brief send_message() with a copy of the batch's topic part, without the bound and stop checks
+     */
+    bool send_message(BatchTopic& topic, zmq::message_t& data_msg, std::stop_token stoken,
+                      zmq::message_t* attachment = nullptr);
+
+    /**
+     * @brief Try, then poll until the parts are sent, the timeout passes or stoken is triggered
+     */
+    bool send_parts(zmq::message_t& topic_msg, zmq::message_t& data_msg, std::stop_token stoken,
+                    zmq::message_t* attachment);
+
+    void announce_strings_if_due(std::stop_token stoken);
+    void count_interned_publish() noexcept;
+
     PublisherConfig config_;
-    std::unique_ptr<zmq::context_t> context_;
+    std::shared_ptr<ZmqContext> context_;
     std::unique_ptr<zmq::socket_t> socket_;
+    std::unique_ptr<flatbuffers::FlatBufferBuilder> fb_builder_;  // Created on first FlatBuffers publish
+    std::shared_ptr<const StringRegistry> strings_;
+    SendBufferPool send_buffers_;
+    std::vector<uint8_t> strings_announcement_;  // strings_ serialized once on set
+    uint32_t publishes_since_announce_{0};  // Sent since the last scheduled announcement
+    bool announce_due_{false};
     std::atomic<uint64_t> messages_sent_{0};
     std::atomic<bool> bound_{false};
 };
@@ -16,7 +16,13 @@
 #include <stop_token>
 #include <unordered_set>
 
+#include "sensorstreamkit/core/aligned_allocator.hpp"
 #include "sensorstreamkit/core/message.hpp"
+#include "sensorstreamkit/core/message_batch.hpp"
+#include "sensorstreamkit/core/message_registry.hpp"
+#include "sensorstreamkit/core/message_view.hpp"
+#include "sensorstreamkit/core/flatbuffers_codec.hpp"
+#include "sensorstreamkit/transport/zmq_context.hpp"
 
 using namespace sensorstreamkit::core;
 
@@ -30,6 +36,8 @@ struct SubscriberConfig {
     int high_water_mark = 1000;
     int receive_timeout_ms = 1000;
     bool conflate = false;  // Keep only last message per topic
+    std::shared_ptr<ZmqContext> context{};  // e.g. ZmqContext::shared(); nullptr = a private context
+    uint64_t io_affinity = 0;  // ZMQ_AFFINITY: bit i = context I/O thread i may serve this socket; 0 = any
 };
 
 /**
@@ -66,20 +74,184 @@ public:
      */
     bool unsubscribe(std::string_view topic);
 
+    /**
+     * @brief Receive string registry announcements from interning publishers
+     *
+     * Announcements are absorbed by the receive calls and never returned
+     * as messages. Subscribers to all topics ("") get them without this.
+     *
+     * Announcements carry no publisher identity, so all publishers a
+     * subscriber hears must share one registry. Once an announcement is
+     * rejected (ids that disagree with ones already known, or malformed
+     * bytes), interned ids can no longer be trusted: the registry is
+     * emptied, later announcements are ignored, and frames with interned
+     * ids fail to decode. Frames with inline strings are unaffected. See
+     * strings_rejected() and reset_strings(); announcements_rejected() and
+     * decode_failures() count what is lost meanwhile.
+     * @return true if successful
+     */
+    bool enable_string_interning() {
+        return subscribe(kStringRegistryTopic);
+    }
+
+    /**
+     * @brief Strings announced so far, used to resolve interned ids
+     */
+    [[nodiscard]] const StringRegistry& strings() const noexcept {
+        return strings_;
+    }
+
+    /**
+     * @brief Whether an announcement was rejected, leaving interned ids unresolved
+     */
+    [[nodiscard]] bool strings_rejected() const noexcept {
+        return strings_rejected_;
+    }
+
+    /**
+     * @brief Announcements not applied: the rejected one and those ignored after it
+     *
+     * A count that keeps rising usually means a publisher restarted with a
+     * registry in another order; see reset_strings().
+     */
+    [[nodiscard]] uint64_t announcements_rejected() const noexcept {
+        return announcements_rejected_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Forget all announced strings and accept announcements again
+     *
+     * For after strings_rejected(), e.g. once the publisher restarted with
+     * a registry in another order: the next announcement rebuilds the
+     * table from scratch. Interned frames fail to decode until it arrives.
+     */
+    void reset_strings() noexcept {
+        strings_.clear();
+        strings_rejected_ = false;
+    }
+
     /**
      * @brief Receive a message with topic
+     *
+     * An attachment sent as its own part (see ZmqPublisher::publish()) is
+     * not copied: the payload's ImageBuffer keeps the received part alive.
      * @tparam T Message payload type (must satisfy SensorDataType concept)
+     * @tparam Codec Wire format the publisher used (see MessageCodec)
      * @param topic Output topic string
      * @param message Output message
      * @return true if received successfully
      */
+    template <SensorDataType T, typename Codec = NativeCodec>
+    [[nodiscard]] std::optional<Message<T, Codec>> receive(std::stop_token stoken = {}) {
+        if constexpr (AttachmentPayload<T>) {
+            Message<T, Codec> message;
+            if (!receive_into(message, stoken)) {
+                return std::nullopt;
+            }
+            return message;
+        } else {
+            zmq::message_t frame;
+            if (!receive_frame(frame, stoken)) {
+                return std::nullopt;
+            }
+            const ConstPayload data(static_cast<const uint8_t*>(frame.data()), frame.size());
+            std::optional<Message<T, Codec>> message;
+            if constexpr (InterningCodec<Codec, T>) {
+                message = Message<T, Codec>::deserialize(data, strings_);
+            } else {
+                message = Message<T, Codec>::deserialize(data);
+            }
+            count_decode(message.has_value());
+            return message;
+        }
+    }
+
+    /**
+     * @brief Receive into a long-lived message, reusing its string capacity
+     * @tparam T Message payload type (must satisfy SensorDataType concept)
+     * @param message Overwritten in place; only meaningful when true is returned
+     * @return true if a valid message was received
+     *
+     * Intended for receive loops that keep one Message<T> across iterations,
+     * so the steady state does not allocate.
+     */
+    template <SensorDataType T, typename Codec>
+    [[nodiscard]] bool receive_into(Message<T, Codec>& message, std::stop_token stoken = {}) {
+        return receive_into(message, stoken, config_.receive_timeout_ms);
+    }
+
+    /**
+     * @brief Receive up to max_messages into batch, decoded into its arena
+     * @tparam T Message payload type (must satisfy SensorDataType concept)
+     * @param batch Cleared first, which ends the lifetime of its messages
+     * @return Number of messages in batch
+     *
+     * Waits up to receive_timeout_ms for the first message, then takes only
+     * messages that are already queued. The batch ends early at invalid data.
+     */
     template <SensorDataType T>
-    [[nodiscard]] std::optional<Message<T>> receive(std::stop_token stoken = {}) {
-        auto data = receive_raw(stoken);
-        if (!data) {
+    size_t receive_batch(MessageBatch<T>& batch, size_t max_messages, std::stop_token stoken = {}) {
+        batch.clear();
+        int timeout_ms = config_.receive_timeout_ms;
+        while (batch.size() < max_messages) {
+            if (!receive_into(batch.emplace_back(), stoken, timeout_ms)) {
+                batch.pop_back();
+                break;
+            }
+            timeout_ms = 0;
+        }
+        return batch.size();
+    }
+
+    /**
+     * @brief Receive a message as a zero-copy view
+     * @tparam T Message payload type (must have a PayloadView)
+     * @param frame Storage for the received data part; the returned view
+     *              points into it and is valid until frame is reused
+     * @return View over the message, or nullopt on timeout/stop/invalid data
+     */
+    template <ViewablePayload T>
+    [[nodiscard]] std::optional<MessageView<T>> receive_view(zmq::message_t& frame, std::stop_token stoken = {}) {
+        if (!receive_frame(frame, stoken)) {
+            return std::nullopt;
+        }
+        auto view = MessageView<T>::from({static_cast<const uint8_t*>(frame.data()), frame.size()}, &strings_);
+        count_decode(view.has_value());
+        return view;
+    }
+
+    /**
+     * @brief Receive one message of any registered type and pass it to its handler
+     * @tparam Registry Types that may arrive (see dispatch())
+     * @param handlers Callables taking const Message<T>& or const MessageView<T>&
+     * @return true if a handler was called; false on timeout/stop, invalid
+     *         data, or a type without a handler
+     */
+    template <typename Registry = BuiltinMessages, typename... Handlers>
+    bool receive_dispatch(std::stop_token stoken, Handlers&&... handlers) {
+        zmq::message_t frame;
+        if (!receive_frame(frame, stoken)) {
+            return false;
+        }
+        return dispatch<Registry>({static_cast<const uint8_t*>(frame.data()), frame.size()}, &strings_,
+                                  std::forward<Handlers>(handlers)...);
+    }
+
+    /**
+     * @brief Receive a FlatBuffers-encoded message and read it in place
+     * @tparam T Message payload type (must have a FlatBuffers table)
+     * @param frame Storage for the received data part; the returned view
+     *              points into it and is valid until frame is reused
+     * @return Verified view, or nullopt on timeout/stop/invalid data
+     */
+    template <FlatBufferPayload T>
+    [[nodiscard]] std::optional<FlatBufferView<T>> receive_flatbuffer(zmq::message_t& frame, std::stop_token stoken = {}) {
+        if (!receive_frame(frame, stoken)) {
             return std::nullopt;
         }
-        return Message<T>::deserialize(*data);
+        auto view = FlatBufferView<T>::from({static_cast<const uint8_t*>(frame.data()), frame.size()});
+        count_decode(view.has_value());
+        return view;
     }
 
     /**
@@ -90,6 +262,16 @@ public:
      */
     [[nodiscard]] std::optional<std::vector<uint8_t>> receive_raw(std::stop_token stoken = {});
 
+    /**
+     * @brief Receive raw bytes into cache-line aligned storage
+     * @param data Overwritten with the data part, reusing its capacity
+     * @return true if received successfully
+     *
+     * ZeroMQ places received parts at arbitrary addresses; copying into an
+     * AlignedBuffer puts the header on a cache line for in-place readers.
+     */
+    [[nodiscard]] bool receive_raw(AlignedBuffer& data, std::stop_token stoken = {});
+
     /**
      * @brief Get total messages received
      */
@@ -97,6 +279,17 @@ public:
         return messages_received_.load();
     }
 
+    /**
+     * @brief Received messages that receive(), receive_into(), receive_batch()
+     *        or the view receives could not decode
+     *
+     * Includes frames with interned ids the registry cannot resolve, e.g.
+     * after strings_rejected(). Counted in messages_received() as well.
+     */
+    [[nodiscard]] uint64_t decode_failures() const noexcept {
+        return decode_failures_.load(std::memory_order_relaxed);
+    }
+
     /**
      * @brief Check if connected
      */
@@ -105,12 +298,76 @@ public:
     }
 
 private:
+    /**
+     * @brief Wait for the next multipart message and keep its data part
+     *
+     * String registry announcements are merged into strings_ and skipped;
+     * see enable_string_interning() for what a rejected one does.
+     * @param attachment If given, receives the part after the data part
+     *                   (left empty if there is none); otherwise it is dropped
+     * @return true if a data part was received into frame
+     */
+    bool receive_frame(zmq::message_t& frame, std::stop_token stoken, zmq::message_t* attachment = nullptr) {
+        return receive_frame(frame, stoken, attachment, config_.receive_timeout_ms);
+    }
+
+    /**
+     * @brief receive_frame() with its own timeout; 0 polls once without waiting
+     */
+    bool receive_frame(zmq::message_t& frame, std::stop_token stoken, zmq::message_t* attachment, int timeout_ms);
+
+    /**
+     * @brief Count a received frame that did not decode
+     * @return decoded
+     */
+    bool count_decode(bool decoded) noexcept {
+        if (!decoded) decode_failures_.fetch_add(1, std::memory_order_relaxed);
+        return decoded;
+    }
+
+    template <SensorDataType T, typename Codec>
+    bool receive_into(Message<T, Codec>& message, std::stop_token stoken, int timeout_ms) {
+        zmq::message_t frame;
+        if constexpr (!InterningCodec<Codec, T>) {
+            if (!receive_frame(frame, stoken, nullptr, timeout_ms)) {
+                return false;
+            }
+            return count_decode(Message<T, Codec>::deserialize_into(
+                {static_cast<const uint8_t*>(frame.data()), frame.size()}, message));
+        } else {
+            if constexpr (AttachmentPayload<T>) {
+                zmq::message_t attachment;
+                if (!receive_frame(frame, stoken, &attachment, timeout_ms)) {
+                    return false;
+                }
+                if (attachment.size() > 0) {
+                    // The payload's buffer owns the received part from here on
+                    auto owner = std::make_shared<zmq::message_t>(std::move(attachment));
+                    ImageBuffer pixels(owner, {static_cast<const uint8_t*>(owner->data()), owner->size()});
+                    return count_decode(Message<T, Codec>::deserialize_detached_into(
+                        {static_cast<const uint8_t*>(frame.data()), frame.size()}, std::move(pixels), message,
+                        &strings_));
+                }
+            } else {
+                if (!receive_frame(frame, stoken, nullptr, timeout_ms)) {
+                    return false;
+                }
+            }
+            return count_decode(Message<T, Codec>::deserialize_into(
+                {static_cast<const uint8_t*>(frame.data()), frame.size()}, message, strings_));
+        }
+    }
+
     SubscriberConfig config_;
-    std::unique_ptr<zmq::context_t> context_;
+    std::shared_ptr<ZmqContext> context_;
     std::unique_ptr<zmq::socket_t> socket_;
     std::atomic<uint64_t> messages_received_{0};
+    std::atomic<uint64_t> decode_failures_{0};
     std::atomic<bool> connected_{false};
     std::unordered_set<std::string> subscriptions_;
+    StringRegistry strings_;
+    bool strings_rejected_{false};  // Set by a rejected announcement; strings_ stays empty
+    std::atomic<uint64_t> announcements_rejected_{0};
 };
 
 }   // namespace sensorstreamkit::transport
@@ -8,6 +8,7 @@
 
 #include <zmq.hpp>
 
+#include "sensorstreamkit/transport/zmq_context.hpp"
 #include "sensorstreamkit/transport/zmq_publisher.hpp"
 #include "sensorstreamkit/transport/zmq_subscriber.hpp"
 
@@ -16,6 +17,13 @@ namespace sensorstreamkit::transport {
 class ZmqTransport {
 public:
     ZmqTransport();
+
+    /**
+     * @brief Run the broker's sockets in context, e.g. ZmqContext::shared()
+     *
+     * shutdown() then stops every socket in that context, not only the broker's.
+     */
+    explicit ZmqTransport(std::shared_ptr<ZmqContext> context);
     ~ZmqTransport();
 
     // Non-copyable, movable
@@ -36,12 +44,12 @@ public:
      */
     void shutdown() {
         if (context_) {
-            context_->shutdown();
+            context_->get().shutdown();
         }
     }
 
 private:
-    std::unique_ptr<zmq::context_t> context_;
+    std::shared_ptr<ZmqContext> context_;
     std::unique_ptr<zmq::socket_t> frontend_socket_;
     std::unique_ptr<zmq::socket_t> backend_socket_;
 
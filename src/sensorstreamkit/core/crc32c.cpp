@@ -0,0 +1,164 @@
+/**
+ * @file crc32c.cpp
+ * @brief CRC32C with SSE4.2 / ARMv8 instructions and a slicing-by-8 fallback
+ */
+
+#include "sensorstreamkit/core/crc32c.hpp"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstring>
+
+#if defined(__x86_64__)
+#include <nmmintrin.h>
+#define SSK_HAS_SSE42_CRC 1
+#else
+#define SSK_HAS_SSE42_CRC 0
+#endif
+
+#if defined(__ARM_FEATURE_CRC32)
+#include <arm_acle.h>
+#endif
+
+namespace sensorstreamkit::core::crc32c {
+
+namespace {
+
+// Castagnoli polynomial, bit-reversed
+constexpr uint32_t kPolynomial = 0x82F63B78u;
+
+// Copy block size for copy(): small enough that the checksum reads it back from L1
+constexpr size_t kCopyBlock = 4096;
+
+using Tables = std::array<std::array<uint32_t, 256>, 8>;
+
+constexpr Tables make_tables() noexcept {
+    Tables tables{};
+    for (uint32_t i = 0; i < 256; ++i) {
+        uint32_t crc = i;
+        for (int bit = 0; bit < 8; ++bit) {
+            crc = (crc >> 1) ^ (kPolynomial & (0u - (crc & 1u)));
+        }
+        tables[0][i] = crc;
+    }
+    for (size_t slice = 1; slice < tables.size(); ++slice) {
+        for (uint32_t i = 0; i < 256; ++i) {
+            const uint32_t prev = tables[slice - 1][i];
+            tables[slice][i] = (prev >> 8) ^ tables[0][prev & 0xFFu];
+        }
+    }
+    return tables;
+}
+
+constexpr Tables kTables = make_tables();
+
+// The extend_* functions work on the inverted register value
+
+uint32_t extend_software(uint32_t crc, const uint8_t* data, size_t size) noexcept {
+    const auto& t = kTables;
+    if constexpr (std::endian::native == std::endian::little) {
+        for (; size >= 8; data += 8, size -= 8) {
+            uint64_t word;
+            std::memcpy(&word, data, sizeof(word));
+            word ^= crc;
+            crc = t[7][word & 0xFF] ^ t[6][(word >> 8) & 0xFF] ^
+                  t[5][(word >> 16) & 0xFF] ^ t[4][(word >> 24) & 0xFF] ^
+                  t[3][(word >> 32) & 0xFF] ^ t[2][(word >> 40) & 0xFF] ^
+                  t[1][(word >> 48) & 0xFF] ^ t[0][word >> 56];
+        }
+    }
+    for (; size > 0; ++data, --size) {
+        crc = t[0][(crc ^ *data) & 0xFF] ^ (crc >> 8);
+    }
+    return crc;
+}
+
+#if SSK_HAS_SSE42_CRC
+__attribute__((target("sse4.2")))
+uint32_t extend_sse42(uint32_t crc, const uint8_t* data, size_t size) noexcept {
+    uint64_t state = crc;
+    for (; size >= 8; data += 8, size -= 8) {
+        uint64_t word;
+        std::memcpy(&word, data, sizeof(word));
+        state = _mm_crc32_u64(state, word);
+    }
+    // Fields are checksummed one by one, so short tails are common
+    auto crc32 = static_cast<uint32_t>(state);
+    if (size & 4) {
+        uint32_t word;
+        std::memcpy(&word, data, sizeof(word));
+        crc32 = _mm_crc32_u32(crc32, word);
+        data += 4;
+    }
+    if (size & 2) {
+        uint16_t word;
+        std::memcpy(&word, data, sizeof(word));
+        crc32 = _mm_crc32_u16(crc32, word);
+        data += 2;
+    }
+    if (size & 1) {
+        crc32 = _mm_crc32_u8(crc32, *data);
+    }
+    return crc32;
+}
+#endif
+
+#if defined(__ARM_FEATURE_CRC32)
+uint32_t extend_armv8(uint32_t crc, const uint8_t* data, size_t size) noexcept {
+    for (; size >= 8; data += 8, size -= 8) {
+        uint64_t word;
+        std::memcpy(&word, data, sizeof(word));
+        crc = __crc32cd(crc, word);
+    }
+    for (; size > 0; ++data, --size) {
+        crc = __crc32cb(crc, *data);
+    }
+    return crc;
+}
+#endif
+
+using ExtendFn = uint32_t (*)(uint32_t, const uint8_t*, size_t) noexcept;
+
+ExtendFn select_extend() noexcept {
+#if defined(__ARM_FEATURE_CRC32)
+    return extend_armv8;
+#else
+#if SSK_HAS_SSE42_CRC
+    if (__builtin_cpu_supports("sse4.2")) return extend_sse42;
+#endif
+    return extend_software;
+#endif
+}
+
+ExtendFn extend_fn() noexcept {
+    static const ExtendFn fn = select_extend();
+    return fn;
+}
+
+}  // namespace
+
+
+uint32_t extend(uint32_t crc, const uint8_t* data, size_t size) noexcept {
+    return ~extend_fn()(~crc, data, size);
+}
+
+uint8_t* copy(uint8_t* dst, const uint8_t* src, size_t size, uint32_t& crc) noexcept {
+    const ExtendFn fn = extend_fn();
+    uint32_t state = ~crc;
+    while (size > 0) {
+        const size_t block = std::min(size, kCopyBlock);
+        std::memcpy(dst, src, block);
+        state = fn(state, dst, block);
+        dst += block;
+        src += block;
+        size -= block;
+    }
+    crc = ~state;
+    return dst;
+}
+
+bool hardware_accelerated() noexcept {
+    return extend_fn() != extend_software;
+}
+
+}   // namespace sensorstreamkit::core::crc32c
@@ -0,0 +1,122 @@
+/**
+ * @file flatbuffers_codec.cpp
+ * @brief Payload <-> FlatBuffers table conversion
+ */
+
+#include "sensorstreamkit/core/flatbuffers_codec.hpp"
+
+namespace sensorstreamkit::core {
+
+// ===========================================================================
+// Camera Frame Data
+// ===========================================================================
+
+flatbuffers::Offset<fbs::CameraFrameData> FlatBufferTraits<CameraFrameData>::build(
+    flatbuffers::FlatBufferBuilder& builder, const CameraFrameData& data) {
+    // Strings and vectors must be created before the table is started
+    auto sensor_id = builder.CreateString(data.sensor_id_);
+    auto encoding = builder.CreateString(data.encoding);
+    flatbuffers::Offset<flatbuffers::Vector<uint8_t>> pixels;
+    if (!data.pixels.empty()) {
+        pixels = builder.CreateVector(data.pixels.data(), data.pixels.size());
+    }
+    return fbs::CreateCameraFrameData(builder, sensor_id, data.timestamp_ns_,
+                                      data.frame_id, data.width, data.height, encoding, pixels);
+}
+
+CameraFrameData FlatBufferTraits<CameraFrameData>::to_owned(const fbs::CameraFrameData& table) {
+    CameraFrameData data;
+    assign(table, data);
+    return data;
+}
+
+void FlatBufferTraits<CameraFrameData>::assign(const fbs::CameraFrameData& table, CameraFrameData& out) {
+    out.sensor_id_ = detail::to_string_view(table.sensor_id());
+    out.timestamp_ns_ = table.timestamp_ns();
+    out.frame_id = table.frame_id();
+    out.width = table.width();
+    out.height = table.height();
+    out.encoding = detail::to_string_view(table.encoding());
+    // Pixel buffers are shared and immutable, so a frame with pixels still copies them
+    const auto pixels = detail::to_span(table.pixels());
+    out.pixels = pixels.empty() ? ImageBuffer{} : ImageBuffer::copy_of(pixels);
+}
+
+
+// ===========================================================================
+// Lidar Scan Data
+// ===========================================================================
+
+flatbuffers::Offset<fbs::LidarScanData> FlatBufferTraits<LidarScanData>::build(
+    flatbuffers::FlatBufferBuilder& builder, const LidarScanData& data) {
+    auto sensor_id = builder.CreateString(data.sensor_id_);
+    flatbuffers::Offset<flatbuffers::Vector<uint8_t>> points;
+    if (!data.points.empty()) {
+        // Same bytes as the native frame, so quantized clouds stay quantized
+        uint8_t* dst = nullptr;
+        points = builder.CreateUninitializedVector(FieldCodec<PointCloud>::size(data.points), &dst);
+        FieldCodec<PointCloud>::write(dst, data.points);
+    }
+    return fbs::CreateLidarScanData(builder, sensor_id, data.timestamp_ns_,
+                                    data.num_points, data.scan_duration_ms, points);
+}
+
+LidarScanData FlatBufferTraits<LidarScanData>::to_owned(const fbs::LidarScanData& table) {
+    LidarScanData data;
+    assign(table, data);
+    return data;
+}
+
+void FlatBufferTraits<LidarScanData>::assign(const fbs::LidarScanData& table, LidarScanData& out) {
+    out.sensor_id_ = detail::to_string_view(table.sensor_id());
+    out.timestamp_ns_ = table.timestamp_ns();
+    out.num_points = table.num_points();
+    out.scan_duration_ms = table.scan_duration_ms();
+    if (auto view = points(table)) {
+        view->decode_into(out.points);
+    } else {
+        out.points.clear();
+    }
+}
+
+std::optional<PointCloudView> FlatBufferTraits<LidarScanData>::points(const fbs::LidarScanData& table) noexcept {
+    const auto bytes = detail::to_span(table.points());
+    if (bytes.empty()) return PointCloudView{};
+
+    size_t offset = 0;
+    auto view = PointCloudView::from(bytes, offset);
+    if (!view || offset != bytes.size()) return std::nullopt;
+    return view;
+}
+
+
+// ===========================================================================
+// IMU Data
+// ===========================================================================
+
+flatbuffers::Offset<fbs::ImuData> FlatBufferTraits<ImuData>::build(
+    flatbuffers::FlatBufferBuilder& builder, const ImuData& data) {
+    auto sensor_id = builder.CreateString(data.sensor_id_);
+    return fbs::CreateImuData(builder, sensor_id, data.timestamp_ns_,
+                              data.accel_x, data.accel_y, data.accel_z,
+                              data.gyro_x, data.gyro_y, data.gyro_z);
+}
+
+ImuData FlatBufferTraits<ImuData>::to_owned(const fbs::ImuData& table) {
+    ImuData data;
+    assign(table, data);
+    return data;
+}
+
+void FlatBufferTraits<ImuData>::assign(const fbs::ImuData& table, ImuData& out) {
+    out.sensor_id_ = detail::to_string_view(table.sensor_id());
+    out.timestamp_ns_ = table.timestamp_ns();
+    out.accel_x = table.accel_x();
+    out.accel_y = table.accel_y();
+    out.accel_z = table.accel_z();
+    out.gyro_x = table.gyro_x();
+    out.gyro_y = table.gyro_y();
+    out.gyro_z = table.gyro_z();
+}
+
+}   // namespace sensorstreamkit::core
@@ -0,0 +1,175 @@
+/**
+ * @file half_float.cpp
+ * @brief Half float conversion with F16C / NEON kernels and a scalar fallback
+ */
+
+#include "sensorstreamkit/core/half_float.hpp"
+#include <bit>
+#include <cstring>
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#define SSK_HAS_F16C 1
+#else
+#define SSK_HAS_F16C 0
+#endif
+
+#if defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define SSK_HAS_NEON_F16 1
+#else
+#define SSK_HAS_NEON_F16 0
+#endif
+
+namespace sensorstreamkit::core::half_float {
+
+// ============================================================================
+// Scalar Conversion
+// ============================================================================
+
+uint16_t from_float(float value) noexcept {
+    constexpr uint32_t kInfinity = 0x7F800000u;
+    constexpr uint32_t kHalfOverflow = 0x47800000u;   // 65536.0f
+    constexpr uint32_t kHalfNormalMin = 0x38800000u;  // 2^-14
+    // 0.5f: adding it lines the 10 half mantissa bits up with the bottom of
+    // the float mantissa, so the FPU does the round-to-nearest-even
+    constexpr uint32_t kSubnormalMagic = 0x3F000000u;
+
+    uint32_t bits = std::bit_cast<uint32_t>(value);
+    const auto sign = static_cast<uint16_t>((bits >> 16) & 0x8000u);
+    bits &= 0x7FFFFFFFu;
+
+    if (bits >= kHalfOverflow) {
+        if (bits > kInfinity) {
+            // NaN: keep the top payload bits and set the quiet bit, as F16C does
+            return static_cast<uint16_t>(sign | 0x7E00u | ((bits >> 13) & 0x3FFu));
+        }
+        return static_cast<uint16_t>(sign | 0x7C00u);
+    }
+
+    if (bits < kHalfNormalMin) {
+        const float shifted = std::bit_cast<float>(bits) + std::bit_cast<float>(kSubnormalMagic);
+        return static_cast<uint16_t>(sign | (std::bit_cast<uint32_t>(shifted) - kSubnormalMagic));
+    }
+
+    // Rebias the exponent and round the 13 dropped mantissa bits to nearest
+    // even; a carry out of the mantissa correctly bumps the exponent, up to
+    // infinity for values of 65520 and above
+    const uint32_t odd = (bits >> 13) & 1u;
+    bits += 0xC8000000u + 0x0FFFu + odd;  // (15 - 127) << 23, wrapped
+    return static_cast<uint16_t>(sign | (bits >> 13));
+}
+
+float to_float(uint16_t half) noexcept {
+    const uint32_t sign = static_cast<uint32_t>(half & 0x8000u) << 16;
+    const uint32_t exponent = (half >> 10) & 0x1Fu;
+    const uint32_t mantissa = half & 0x3FFu;
+
+    if (exponent == 0) {
+        // Zero or subnormal: mantissa * 2^-24 is exact in float
+        const float magnitude = static_cast<float>(mantissa) * 0x1p-24f;
+        return std::bit_cast<float>(sign | std::bit_cast<uint32_t>(magnitude));
+    }
+    if (exponent == 0x1F) {
+        // Infinity, or NaN with the quiet bit set, as F16C does
+        const uint32_t quiet = mantissa != 0 ? 0x00400000u : 0u;
+        return std::bit_cast<float>(sign | 0x7F800000u | quiet | (mantissa << 13));
+    }
+    return std::bit_cast<float>(sign | ((exponent + 112) << 23) | (mantissa << 13));
+}
+
+// ============================================================================
+// Bulk Conversion
+// ============================================================================
+
+namespace {
+
+void encode_scalar(uint8_t* dst, const float* src, size_t count) noexcept {
+    for (size_t i = 0; i < count; ++i) {
+        const uint16_t half = from_float(src[i]);
+        std::memcpy(dst + i * sizeof(half), &half, sizeof(half));
+    }
+}
+
+void decode_scalar(float* dst, const uint8_t* src, size_t count) noexcept {
+    for (size_t i = 0; i < count; ++i) {
+        uint16_t half;
+        std::memcpy(&half, src + i * sizeof(half), sizeof(half));
+        dst[i] = to_float(half);
+    }
+}
+
+#if SSK_HAS_F16C
+__attribute__((target("avx,f16c")))
+void encode_f16c(uint8_t* dst, const float* src, size_t count) noexcept {
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        const __m128i half = _mm256_cvtps_ph(_mm256_loadu_ps(src + i), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i * sizeof(uint16_t)), half);
+    }
+    encode_scalar(dst + i * sizeof(uint16_t), src + i, count - i);
+}
+
+__attribute__((target("avx,f16c")))
+void decode_f16c(float* dst, const uint8_t* src, size_t count) noexcept {
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        const __m128i half = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * sizeof(uint16_t)));
+        _mm256_storeu_ps(dst + i, _mm256_cvtph_ps(half));
+    }
+    decode_scalar(dst + i, src + i * sizeof(uint16_t), count - i);
+}
+#endif
+
+#if SSK_HAS_NEON_F16
+void encode_neon(uint8_t* dst, const float* src, size_t count) noexcept {
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const uint16x4_t half = vreinterpret_u16_f16(vcvt_f16_f32(vld1q_f32(src + i)));
+        vst1_u8(dst + i * sizeof(uint16_t), vreinterpret_u8_u16(half));
+    }
+    encode_scalar(dst + i * sizeof(uint16_t), src + i, count - i);
+}
+
+void decode_neon(float* dst, const uint8_t* src, size_t count) noexcept {
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const float16x4_t half = vreinterpret_f16_u8(vld1_u8(src + i * sizeof(uint16_t)));
+        vst1q_f32(dst + i, vcvt_f32_f16(half));
+    }
+    decode_scalar(dst + i, src + i * sizeof(uint16_t), count - i);
+}
+#endif
+
+struct Kernels {
+    void (*encode)(uint8_t*, const float*, size_t) noexcept;
+    void (*decode)(float*, const uint8_t*, size_t) noexcept;
+};
+
+Kernels select_kernels() noexcept {
+#if SSK_HAS_NEON_F16
+    return {encode_neon, decode_neon};
+#else
+#if SSK_HAS_F16C
+    if (__builtin_cpu_supports("f16c") && __builtin_cpu_supports("avx")) return {encode_f16c, decode_f16c};
+#endif
+    return {encode_scalar, decode_scalar};
+#endif
+}
+
+const Kernels& kernels() noexcept {
+    static const Kernels selected = select_kernels();
+    return selected;
+}
+
+}  // namespace
+
+void encode(uint8_t* dst, const float* src, size_t count) noexcept {
+    kernels().encode(dst, src, count);
+}
+
+void decode(float* dst, const uint8_t* src, size_t count) noexcept {
+    kernels().decode(dst, src, count);
+}
+
+}  // namespace sensorstreamkit::core::half_float
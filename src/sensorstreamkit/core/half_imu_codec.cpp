@@ -0,0 +1,61 @@
+/**
+ * @file half_imu_codec.cpp
+ * @brief Half precision wire codec for single ImuData messages
+ */
+
+#include "sensorstreamkit/core/half_imu_codec.hpp"
+#include "sensorstreamkit/core/half_float.hpp"
+#include <cstring>
+
+namespace sensorstreamkit::core {
+
+size_t HalfImuCodec::encoded_size(const MessageHeader&, const ImuData& payload) noexcept {
+    return MessageHeader::serialized_size() + sizeof(uint8_t) + payload.sensor_id_.size() +
+           sizeof(payload.timestamp_ns_) + kReadingBytes;
+}
+
+size_t HalfImuCodec::encode(const MessageHeader& header, const ImuData& payload, MutablePayload out) noexcept {
+    const size_t total = encoded_size(header, payload);
+    if (out.size() < total || payload.sensor_id_.size() > UINT8_MAX) return 0;
+
+    // Flagged sections (checksum, extensions) are not written, so neither are their flags
+    const MessageHeader plain{header.timestamp_ns, header.sequence_number, header.message_type, 0};
+    uint8_t* dst = out.data() + plain.serialize_into(out);
+
+    *dst++ = static_cast<uint8_t>(payload.sensor_id_.size());
+    std::memcpy(dst, payload.sensor_id_.data(), payload.sensor_id_.size());
+    dst += payload.sensor_id_.size();
+    std::memcpy(dst, &payload.timestamp_ns_, sizeof(payload.timestamp_ns_));
+    dst += sizeof(payload.timestamp_ns_);
+
+    const float readings[] = {payload.accel_x, payload.accel_y, payload.accel_z,
+                              payload.gyro_x, payload.gyro_y, payload.gyro_z};
+    half_float::encode(dst, readings, 6);
+    return total;
+}
+
+bool HalfImuCodec::decode(ConstPayload data, MessageHeader& header, ImuData& payload) {
+    size_t offset = MessageHeader::serialized_size();
+    if (data.size() < offset + sizeof(uint8_t)) return false;
+    if (!MessageHeader::deserialize_into(data, header)) return false;
+    if (header.flags != 0 || !MessageHeader::type_matches<ImuData>(header.message_type)) return false;
+
+    const size_t id_size = data[offset++];
+    if (data.size() != offset + id_size + sizeof(payload.timestamp_ns_) + kReadingBytes) return false;
+    payload.sensor_id_.assign(reinterpret_cast<const char*>(data.data() + offset), id_size);
+    offset += id_size;
+    std::memcpy(&payload.timestamp_ns_, data.data() + offset, sizeof(payload.timestamp_ns_));
+    offset += sizeof(payload.timestamp_ns_);
+
+    float readings[6];
+    half_float::decode(readings, data.data() + offset, 6);
+    payload.accel_x = readings[0];
+    payload.accel_y = readings[1];
+    payload.accel_z = readings[2];
+    payload.gyro_x = readings[3];
+    payload.gyro_y = readings[4];
+    payload.gyro_z = readings[5];
+    return true;
+}
+
+}  // namespace sensorstreamkit::core
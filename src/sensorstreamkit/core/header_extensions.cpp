@@ -0,0 +1,84 @@
+/**
+ * @file header_extensions.cpp
+ * @brief Extension entry encoding and lookup
+ */
+
+#include "sensorstreamkit/core/header_extensions.hpp"
+
+namespace sensorstreamkit::core {
+
+namespace {
+
+uint16_t load_u16(const uint8_t* src) noexcept {
+    uint16_t value;
+    std::memcpy(&value, src, sizeof(value));
+    return value;
+}
+
+}  // namespace
+
+
+// ===========================================================================
+// Header Extensions View
+// ===========================================================================
+
+std::optional<HeaderExtensionsView> HeaderExtensionsView::from(ConstPayload entries) noexcept {
+    size_t offset = 0;
+    while (offset < entries.size()) {
+        if (entries.size() - offset < kEntryHeaderSize) return std::nullopt;
+        const size_t length = load_u16(entries.data() + offset + sizeof(uint16_t));
+        offset += kEntryHeaderSize;
+        if (entries.size() - offset < length) return std::nullopt;
+        offset += length;
+    }
+    return HeaderExtensionsView(entries);
+}
+
+std::optional<ConstPayload> HeaderExtensionsView::find(uint16_t type) const noexcept {
+    // Entries were validated in from(), so only the lengths need reading
+    size_t offset = 0;
+    while (offset < entries_.size()) {
+        const uint16_t entry_type = load_u16(entries_.data() + offset);
+        const size_t length = load_u16(entries_.data() + offset + sizeof(uint16_t));
+        offset += kEntryHeaderSize;
+        if (entry_type == type) return entries_.subspan(offset, length);
+        offset += length;
+    }
+    return std::nullopt;
+}
+
+
+// ===========================================================================
+// Header Extensions
+// ===========================================================================
+
+bool HeaderExtensions::add(uint16_t type, ConstPayload value) {
+    const size_t entry_size = HeaderExtensionsView::kEntryHeaderSize + value.size();
+    if (value.size() > UINT16_MAX || bytes_.size() + entry_size > kMaxBytes) return false;
+
+    const size_t offset = bytes_.size();
+    bytes_.resize(offset + entry_size);
+    const auto length = static_cast<uint16_t>(value.size());
+    std::memcpy(bytes_.data() + offset, &type, sizeof(type));
+    std::memcpy(bytes_.data() + offset + sizeof(type), &length, sizeof(length));
+    if (!value.empty()) {
+        std::memcpy(bytes_.data() + offset + HeaderExtensionsView::kEntryHeaderSize, value.data(), value.size());
+    }
+    return true;
+}
+
+bool HeaderExtensions::assign(ConstPayload entries) {
+    if (entries.size() > kMaxBytes || !HeaderExtensionsView::from(entries)) {
+        bytes_.clear();
+        return false;
+    }
+    bytes_.assign(entries.begin(), entries.end());
+    return true;
+}
+
+HeaderExtensionsView HeaderExtensions::view() const noexcept {
+    // Built by add()/assign(), so always well formed
+    return HeaderExtensionsView(bytes_);
+}
+
+}  // namespace sensorstreamkit::core
@@ -0,0 +1,208 @@
+/**
+ * @file imu_samples.cpp
+ * @brief ImuSamples columns and wire codec
+ */
+
+#include "sensorstreamkit/core/imu_samples.hpp"
+#include "sensorstreamkit/core/half_float.hpp"
+#include "sensorstreamkit/core/timestamp_codec.hpp"
+#include <cstring>
+
+namespace sensorstreamkit::core {
+
+namespace {
+
+template <typename U>
+uint8_t* write_column(uint8_t* dst, std::span<const U> column) noexcept {
+    std::memcpy(dst, column.data(), column.size_bytes());
+    return dst + column.size_bytes();
+}
+
+template <typename U>
+const uint8_t* read_column(std::span<U> column, const uint8_t* src) noexcept {
+    std::memcpy(column.data(), src, column.size_bytes());
+    return src + column.size_bytes();
+}
+
+uint8_t* write_half_column(uint8_t* dst, std::span<const float> column) noexcept {
+    half_float::encode(dst, column.data(), column.size());
+    return dst + column.size() * sizeof(uint16_t);
+}
+
+const uint8_t* read_half_column(std::span<float> column, const uint8_t* src) noexcept {
+    half_float::decode(column.data(), src, column.size());
+    return src + column.size() * sizeof(uint16_t);
+}
+
+}  // namespace
+
+// ============================================================================
+// IMU Samples
+// ============================================================================
+
+void ImuSamples::resize(size_t size) {
+    timestamp_ns_.resize(size);
+    accel_x_.resize(size);
+    accel_y_.resize(size);
+    accel_z_.resize(size);
+    gyro_x_.resize(size);
+    gyro_y_.resize(size);
+    gyro_z_.resize(size);
+}
+
+void ImuSamples::reserve(size_t size) {
+    timestamp_ns_.reserve(size);
+    accel_x_.reserve(size);
+    accel_y_.reserve(size);
+    accel_z_.reserve(size);
+    gyro_x_.reserve(size);
+    gyro_y_.reserve(size);
+    gyro_z_.reserve(size);
+}
+
+void ImuSamples::clear() noexcept {
+    timestamp_ns_.clear();
+    accel_x_.clear();
+    accel_y_.clear();
+    accel_z_.clear();
+    gyro_x_.clear();
+    gyro_y_.clear();
+    gyro_z_.clear();
+}
+
+void ImuSamples::push_back(const ImuSample& sample) {
+    timestamp_ns_.push_back(sample.timestamp_ns);
+    accel_x_.push_back(sample.accel_x);
+    accel_y_.push_back(sample.accel_y);
+    accel_z_.push_back(sample.accel_z);
+    gyro_x_.push_back(sample.gyro_x);
+    gyro_y_.push_back(sample.gyro_y);
+    gyro_z_.push_back(sample.gyro_z);
+}
+
+ImuSample ImuSamples::sample(size_t index) const noexcept {
+    return ImuSample{
+        .timestamp_ns = timestamp_ns_[index],
+        .accel_x = accel_x_[index],
+        .accel_y = accel_y_[index],
+        .accel_z = accel_z_[index],
+        .gyro_x = gyro_x_[index],
+        .gyro_y = gyro_y_[index],
+        .gyro_z = gyro_z_[index]
+    };
+}
+
+// ============================================================================
+// IMU Samples View
+// ============================================================================
+
+std::optional<ImuSamplesView> ImuSamplesView::from(ConstPayload data, size_t& offset) noexcept {
+    uint32_t count;
+    if (data.size() - offset < sizeof(count)) return std::nullopt;
+    std::memcpy(&count, data.data() + offset, sizeof(count));
+    size_t next = offset + sizeof(count);
+
+    ImuSamplesView view;
+    if (count == 0) {
+        offset = next;
+        return view;
+    }
+
+    // Divide rather than multiply, so a corrupt count cannot overflow
+    if ((data.size() - next) / ImuSamples::kHalfBytes < count) return std::nullopt;
+
+    const size_t timestamps_start = next;
+    auto front = timestamp_codec::skip(data, next, count);
+    if (!front) return std::nullopt;
+    view.timestamps_ = data.subspan(timestamps_start, next - timestamps_start);
+
+    if (next == data.size()) return std::nullopt;
+    const uint8_t half = data[next++];
+    if (half > 1) return std::nullopt;
+
+    const size_t sample_bytes = half ? ImuSamples::kHalfBytes : ImuSamples::kFloatBytes;
+    if ((data.size() - next) / sample_bytes < count) return std::nullopt;
+
+    view.columns_ = data.data() + next;
+    view.size_ = count;
+    view.front_timestamp_ns_ = *front;
+    view.half_precision_ = half != 0;
+    offset = next + size_t{count} * sample_bytes;
+    return view;
+}
+
+void ImuSamplesView::decode_into(ImuSamples& out) const {
+    out.resize(size_);
+    out.set_half_precision(half_precision_);
+    if (size_ == 0) return;
+
+    // Already checked by from()
+    size_t offset = 0;
+    timestamp_codec::decode(timestamps_, offset, out.timestamp_ns());
+
+    auto read = half_precision_ ? read_half_column : read_column<float>;
+    const uint8_t* src = columns_;
+    src = read(out.accel_x(), src);
+    src = read(out.accel_y(), src);
+    src = read(out.accel_z(), src);
+    src = read(out.gyro_x(), src);
+    src = read(out.gyro_y(), src);
+    read(out.gyro_z(), src);
+}
+
+ImuSamples ImuSamplesView::to_owned() const {
+    ImuSamples samples;
+    decode_into(samples);
+    return samples;
+}
+
+
+// ============================================================================
+// Wire Codec
+// ============================================================================
+
+FieldCodec<ImuSamples>::Plan FieldCodec<ImuSamples>::plan(const ImuSamples& samples) noexcept {
+    if (samples.empty()) return {};
+    return timestamp_codec::plan(samples.timestamp_ns());
+}
+
+size_t FieldCodec<ImuSamples>::size(const ImuSamples& samples) noexcept {
+    return size(samples, plan(samples));
+}
+
+size_t FieldCodec<ImuSamples>::size(const ImuSamples& samples, const Plan& plan) noexcept {
+    if (samples.empty()) return sizeof(uint32_t);
+    return sizeof(uint32_t) + timestamp_codec::encoded_size(plan, samples.size()) + sizeof(uint8_t) +
+           samples.size() * (samples.half_precision() ? ImuSamples::kHalfBytes : ImuSamples::kFloatBytes);
+}
+
+uint8_t* FieldCodec<ImuSamples>::write(uint8_t* dst, const ImuSamples& samples) noexcept {
+    return write(dst, samples, plan(samples));
+}
+
+uint8_t* FieldCodec<ImuSamples>::write(uint8_t* dst, const ImuSamples& samples, const Plan& plan) noexcept {
+    const auto count = static_cast<uint32_t>(samples.size());
+    std::memcpy(dst, &count, sizeof(count));
+    dst += sizeof(count);
+    if (count == 0) return dst;
+
+    dst = timestamp_codec::encode(dst, plan, samples.timestamp_ns());
+    *dst++ = samples.half_precision() ? 1 : 0;
+
+    auto write = samples.half_precision() ? write_half_column : write_column<float>;
+    dst = write(dst, samples.accel_x());
+    dst = write(dst, samples.accel_y());
+    dst = write(dst, samples.accel_z());
+    dst = write(dst, samples.gyro_x());
+    dst = write(dst, samples.gyro_y());
+    return write(dst, samples.gyro_z());
+}
+
+bool FieldCodec<ImuSamples>::read(ConstPayload data, size_t& offset, ImuSamples& samples) {
+    auto view = ImuSamplesView::from(data, offset);
+    if (!view) return false;
+    view->decode_into(samples);
+    return true;
+}
+
+}  // namespace sensorstreamkit::core
@@ -4,9 +4,14 @@
  */
 
 #include "sensorstreamkit/core/message.hpp"
+#include "sensorstreamkit/core/tsc_clock.hpp"
+#include <array>
 #include <atomic>
 #include <chrono>
 #include <cstring>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
 
 namespace sensorstreamkit::core {
 
@@ -14,6 +19,12 @@ namespace sensorstreamkit::core {
 // Timestamp
 // ===========================================================================
 
+namespace {
+
+std::atomic<ClockSource> g_clock_source{ClockSource::SteadyClock};
+
+}  // namespace
+
 Timestamp::Timestamp() noexcept : ns_(now().nanoseconds()) {}
 
 double Timestamp::seconds() const noexcept {
@@ -21,9 +32,22 @@ double Timestamp::seconds() const noexcept {
 }
 
 Timestamp Timestamp::now() noexcept {
-    auto now = std::chrono::steady_clock::now();
-    auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(now.time_since_epoch());
-    return Timestamp(static_cast<uint64_t>(ns.count()));
+    if (g_clock_source.load(std::memory_order_relaxed) == ClockSource::Tsc) {
+        return Timestamp(TscClock::now_ns());
+    }
+    return Timestamp(detail::steady_clock_ns());
+}
+
+ClockSource Timestamp::set_clock_source(ClockSource source) noexcept {
+    if (source == ClockSource::Tsc && !TscClock::is_calibrated() && !TscClock::calibrate()) {
+        source = ClockSource::SteadyClock;
+    }
+    g_clock_source.store(source, std::memory_order_relaxed);
+    return source;
+}
+
+ClockSource Timestamp::clock_source() noexcept {
+    return g_clock_source.load(std::memory_order_relaxed);
 }
 
 
@@ -31,7 +55,8 @@ Timestamp Timestamp::now() noexcept {
 // Sequence Counter
 // ===========================================================================
 
-struct SequenceCounter::Impl {
+// Own cache line, so counters of different streams never false-share
+struct alignas(64) SequenceCounter::Impl {
     std::atomic<uint32_t> counter_{0};
 };
 
@@ -48,234 +73,243 @@ uint32_t SequenceCounter::next() noexcept {
 }
 
 
+// ===========================================================================
+// Sequence Streams
+// ===========================================================================
+
+namespace {
+
+struct StringHash {
+    using is_transparent = void;
+    size_t operator()(std::string_view str) const noexcept {
+        return std::hash<std::string_view>{}(str);
+    }
+};
+
+// Distinguishes SequenceStreams objects in the thread-local cache, even
+// when a destroyed one's address is reused
+std::atomic<uint64_t> g_next_streams_id{1};
+
+struct StreamCacheEntry {
+    uint64_t owner{0};
+    std::string_view key;  // Points at the key stored in the owner's map
+    SequenceCounter* counter{nullptr};
+};
+
+struct StreamCache {
+    std::array<StreamCacheEntry, 8> entries{};
+    size_t next_victim{0};
+};
+
+thread_local StreamCache t_stream_cache;
+
+}  // namespace
+
+struct SequenceStreams::Impl {
+    const uint64_t id{g_next_streams_id.fetch_add(1, std::memory_order_relaxed)};
+    std::shared_mutex mutex;
+    // Never erased: nodes (keys and counters) stay put for the object's lifetime
+    std::unordered_map<std::string, std::unique_ptr<SequenceCounter>, StringHash, std::equal_to<>> counters;
+};
+
+SequenceStreams::SequenceStreams() : pImpl_(std::make_unique<Impl>()) {}
+
+SequenceStreams::~SequenceStreams() noexcept = default;
+
+SequenceStreams::SequenceStreams(SequenceStreams&&) noexcept = default;
+
+SequenceStreams& SequenceStreams::operator=(SequenceStreams&&) noexcept = default;
+
+SequenceCounter& SequenceStreams::stream(std::string_view key) {
+    // Fast path: this thread used the stream recently
+    auto& cache = t_stream_cache;
+    for (const auto& entry : cache.entries) {
+        if (entry.owner == pImpl_->id && entry.key == key) {
+            return *entry.counter;
+        }
+    }
+
+    const std::pair<const std::string, std::unique_ptr<SequenceCounter>>* node = nullptr;
+    {
+        std::shared_lock lock(pImpl_->mutex);
+        auto it = pImpl_->counters.find(key);
+        if (it != pImpl_->counters.end()) {
+            node = &*it;
+        }
+    }
+    if (node == nullptr) {
+        std::unique_lock lock(pImpl_->mutex);
+        // Another thread may have inserted it since the shared lock was released
+        auto it = pImpl_->counters.try_emplace(std::string(key), std::make_unique<SequenceCounter>()).first;
+        node = &*it;
+    }
+
+    cache.entries[cache.next_victim] = StreamCacheEntry{pImpl_->id, node->first, node->second.get()};
+    cache.next_victim = (cache.next_victim + 1) % cache.entries.size();
+    return *node->second;
+}
+
+
+// ===========================================================================
+// Serialization Helpers
+// ===========================================================================
+
+namespace {
+
+/**
+ * @brief Append serialized bytes with a single resize of the buffer
+ */
+template <typename T>
+void append_serialized(const T& value, std::vector<uint8_t>& buffer) {
+    const size_t offset = buffer.size();
+    buffer.resize(offset + value.serialized_size());
+    value.serialize_into(MutablePayload(buffer).subspan(offset));
+}
+
+}  // namespace
+
+
 // ===========================================================================
 // Message Header
 // ===========================================================================
 
 void MessageHeader::serialize(std::vector<uint8_t>& buffer) const {
-    // Resize buffer to exact size needed - eliminates sizing errors
-    const size_t offset = buffer.size();
-    buffer.resize(offset + serialized_size);
+    append_serialized(*this, buffer);
+}
 
-    std::memcpy(buffer.data() + offset, &timestamp_ns, sizeof(timestamp_ns));
-    std::memcpy(buffer.data() + offset + 8, &sequence_number, sizeof(sequence_number));
-    std::memcpy(buffer.data() + offset + 12, &message_type, sizeof(message_type));
-    std::memcpy(buffer.data() + offset + 14, &reserved, sizeof(reserved));
+size_t MessageHeader::serialize_into(MutablePayload out) const noexcept {
+    return serialization::serialize_into(*this, out);
 }
 
 std::optional<MessageHeader> MessageHeader::deserialize(ConstPayload data) {
-    if (data.size() < serialized_size) {
-        return std::nullopt;
-    }
+    return serialization::deserialize<MessageHeader>(data);
+}
+
+bool MessageHeader::deserialize_into(ConstPayload data, MessageHeader& out) noexcept {
+    return serialization::deserialize_into(data, out);
+}
+
 
-    MessageHeader header;
-    std::memcpy(&header.timestamp_ns, data.data(), sizeof(header.timestamp_ns));
-    std::memcpy(&header.sequence_number, data.data() + 8, sizeof(header.sequence_number));
-    std::memcpy(&header.message_type, data.data() + 12, sizeof(header.message_type));
-    std::memcpy(&header.reserved, data.data() + 14, sizeof(header.reserved));
+// ===========================================================================
+// Camera Frame Data
+// ===========================================================================
 
-    return header;
+size_t CameraFrameData::serialized_size() const noexcept {
+    return serialization::serialized_size(*this);
 }
 
 void CameraFrameData::serialize(std::vector<uint8_t>& buffer) const {
-    const size_t required_size = sizeof(uint32_t) + sensor_id_.size() +
-                                 sizeof(timestamp_ns_) +
-                                 sizeof(frame_id) +
-                                 sizeof(width) + sizeof(height) +
-                                 sizeof(uint32_t) + encoding.size();
-
-    // Resize buffer to exact size needed - eliminates sizing errors
-    size_t offset = buffer.size();
-    buffer.resize(offset + required_size);
-
-    // Serialize sensor_id length + data
-    uint32_t id_len = static_cast<uint32_t>(sensor_id_.size());
-    std::memcpy(buffer.data() + offset, &id_len, sizeof(id_len));
-    offset += sizeof(id_len);
-    std::memcpy(buffer.data() + offset, sensor_id_.data(), sensor_id_.size());
-    offset += sensor_id_.size();
-
-    // Serialize fixed fields
-    std::memcpy(buffer.data() + offset, &timestamp_ns_, sizeof(timestamp_ns_));
-    offset += sizeof(timestamp_ns_);
-    std::memcpy(buffer.data() + offset, &frame_id, sizeof(frame_id));
-    offset += sizeof(frame_id);
-    std::memcpy(buffer.data() + offset, &width, sizeof(width));
-    offset += sizeof(width);
-    std::memcpy(buffer.data() + offset, &height, sizeof(height));
-    offset += sizeof(height);
-
-    // Serialize encoding
-    uint32_t enc_len = static_cast<uint32_t>(encoding.size());
-    std::memcpy(buffer.data() + offset, &enc_len, sizeof(enc_len));
-    offset += sizeof(enc_len);
-    std::memcpy(buffer.data() + offset, encoding.data(), encoding.size());
+    append_serialized(*this, buffer);
+}
+
+size_t CameraFrameData::serialize_into(MutablePayload out) const noexcept {
+    return serialization::serialize_into(*this, out);
 }
 
 std::optional<CameraFrameData> CameraFrameData::deserialize(ConstPayload data) {
-    if (data.size() < sizeof(uint32_t)) return std::nullopt;
+    return serialization::deserialize<CameraFrameData>(data);
+}
 
-    CameraFrameData result;
-    size_t offset = 0;
+bool CameraFrameData::deserialize_into(ConstPayload data, CameraFrameData& out) {
+    return serialization::deserialize_into(data, out);
+}
 
-    // Deserialize sensor_id
-    uint32_t id_len;
-    std::memcpy(&id_len, data.data() + offset, sizeof(id_len));
-    offset += sizeof(id_len);
-    if (data.size() < offset + id_len) return std::nullopt;
+// ===========================================================================
+// Lidar Scan Data
+// ===========================================================================
 
-    result.sensor_id_.assign(reinterpret_cast<const char*>(data.data() + offset), id_len);
-    offset += id_len;
+size_t LidarScanData::serialized_size() const noexcept {
+    return serialization::serialized_size(*this);
+}
 
-    // Deserialize fixed fields
-    if (data.size() < offset + sizeof(result.timestamp_ns_) + sizeof(result.frame_id) +
-                          sizeof(result.width) + sizeof(result.height))
-        return std::nullopt;
+void LidarScanData::serialize(std::vector<uint8_t>& buffer) const {
+    append_serialized(*this, buffer);
+}
 
-    std::memcpy(&result.timestamp_ns_, data.data() + offset, sizeof(result.timestamp_ns_));
-    offset += sizeof(result.timestamp_ns_);
-    std::memcpy(&result.frame_id, data.data() + offset, sizeof(result.frame_id));
-    offset += sizeof(result.frame_id);
-    std::memcpy(&result.width, data.data() + offset, sizeof(result.width));
-    offset += sizeof(result.width);
-    std::memcpy(&result.height, data.data() + offset, sizeof(result.height));
-    offset += sizeof(result.height);
+size_t LidarScanData::serialize_into(MutablePayload out) const noexcept {
+    return serialization::serialize_into(*this, out);
+}
 
-    // Deserialize encoding
-    if (data.size() < offset + sizeof(uint32_t)) return std::nullopt;
-    uint32_t enc_len;
-    std::memcpy(&enc_len, data.data() + offset, sizeof(enc_len));
-    offset += sizeof(enc_len);
-    if (data.size() < offset + enc_len) return std::nullopt;
-    result.encoding.assign(reinterpret_cast<const char*>(data.data() + offset), enc_len);
+std::optional<LidarScanData> LidarScanData::deserialize(ConstPayload data) {
+    return serialization::deserialize<LidarScanData>(data);
+}
 
-    return result;
+bool LidarScanData::deserialize_into(ConstPayload data, LidarScanData& out) {
+    return serialization::deserialize_into(data, out);
 }
 
-void LidarScanData::serialize(std::vector<uint8_t>& buffer) const {
-    const size_t required_size = sizeof(uint32_t) + sensor_id_.size() +
-                                 sizeof(timestamp_ns_) +
-                                 sizeof(num_points) +
-                                 sizeof(scan_duration_ms);
-
-    // Resize buffer to exact size needed - eliminates sizing errors
-    size_t offset = buffer.size();
-    buffer.resize(offset + required_size);
-
-    // Serialize sensor_id length + data
-    uint32_t id_len = static_cast<uint32_t>(sensor_id_.size());
-    std::memcpy(buffer.data() + offset, &id_len, sizeof(id_len));
-    offset += sizeof(id_len);
-    std::memcpy(buffer.data() + offset, sensor_id_.data(), sensor_id_.size());
-    offset += sensor_id_.size();
-
-    // Serialize fixed fields
-    std::memcpy(buffer.data() + offset, &timestamp_ns_, sizeof(timestamp_ns_));
-    offset += sizeof(timestamp_ns_);
-    std::memcpy(buffer.data() + offset, &num_points, sizeof(num_points));
-    offset += sizeof(num_points);
-    std::memcpy(buffer.data() + offset, &scan_duration_ms, sizeof(scan_duration_ms));
+// ===========================================================================
+// IMU Data
+// ===========================================================================
+
+size_t ImuData::serialized_size() const noexcept {
+    return serialization::serialized_size(*this);
 }
 
-std::optional<LidarScanData> LidarScanData::deserialize(ConstPayload data) {
-    if (data.size() < sizeof(uint32_t)) return std::nullopt;
+void ImuData::serialize(std::vector<uint8_t>& buffer) const {
+    append_serialized(*this, buffer);
+}
 
-    LidarScanData result;
-    size_t offset = 0;
+size_t ImuData::serialize_into(MutablePayload out) const noexcept {
+    return serialization::serialize_into(*this, out);
+}
 
-    // Deserialize sensor_id
-    uint32_t id_len;
-    std::memcpy(&id_len, data.data() + offset, sizeof(id_len));
-    offset += sizeof(id_len);
-    if (data.size() < offset + id_len) return std::nullopt;
+std::optional<ImuData> ImuData::deserialize(ConstPayload data) {
+    return serialization::deserialize<ImuData>(data);
+}
 
-    result.sensor_id_.assign(reinterpret_cast<const char*>(data.data() + offset), id_len);
-    offset += id_len;
+bool ImuData::deserialize_into(ConstPayload data, ImuData& out) {
+    return serialization::deserialize_into(data, out);
+}
 
-    // Deserialize fixed fields
-    constexpr size_t fixed_size = sizeof(result.timestamp_ns_) +
-                                  sizeof(result.num_points) +
-                                  sizeof(result.scan_duration_ms);
-    if (data.size() < offset + fixed_size) return std::nullopt;
+// ===========================================================================
+// IMU Batch
+// ===========================================================================
 
-    std::memcpy(&result.timestamp_ns_, data.data() + offset, sizeof(result.timestamp_ns_));
-    offset += sizeof(result.timestamp_ns_);
-    std::memcpy(&result.num_points, data.data() + offset, sizeof(result.num_points));
-    offset += sizeof(result.num_points);
-    std::memcpy(&result.scan_duration_ms, data.data() + offset, sizeof(result.scan_duration_ms));
+void ImuBatch::push_back(const ImuData& imu) {
+    samples.push_back(ImuSample{
+        .timestamp_ns = imu.timestamp_ns_,
+        .accel_x = imu.accel_x,
+        .accel_y = imu.accel_y,
+        .accel_z = imu.accel_z,
+        .gyro_x = imu.gyro_x,
+        .gyro_y = imu.gyro_y,
+        .gyro_z = imu.gyro_z
+    });
+}
 
-    return result;
+ImuData ImuBatch::sample(size_t index) const {
+    const ImuSample sample = samples.sample(index);
+    return ImuData{
+        .sensor_id_ = sensor_id_,
+        .timestamp_ns_ = sample.timestamp_ns,
+        .accel_x = sample.accel_x,
+        .accel_y = sample.accel_y,
+        .accel_z = sample.accel_z,
+        .gyro_x = sample.gyro_x,
+        .gyro_y = sample.gyro_y,
+        .gyro_z = sample.gyro_z
+    };
 }
 
-void ImuData::serialize(std::vector<uint8_t>& buffer) const {
-    const size_t required_size = sizeof(uint32_t) + sensor_id_.size() +
-                                 sizeof(timestamp_ns_) +
-                                 sizeof(accel_x) + sizeof(accel_y) + sizeof(accel_z) +
-                                 sizeof(gyro_x) + sizeof(gyro_y) + sizeof(gyro_z);
-
-    // Resize buffer to exact size needed - eliminates sizing errors
-    size_t offset = buffer.size();
-    buffer.resize(offset + required_size);
-
-    // Serialize sensor_id length + data
-    uint32_t id_len = static_cast<uint32_t>(sensor_id_.size());
-    std::memcpy(buffer.data() + offset, &id_len, sizeof(id_len));
-    offset += sizeof(id_len);
-    std::memcpy(buffer.data() + offset, sensor_id_.data(), sensor_id_.size());
-    offset += sensor_id_.size();
-
-    // Serialize fixed fields
-    std::memcpy(buffer.data() + offset, &timestamp_ns_, sizeof(timestamp_ns_));
-    offset += sizeof(timestamp_ns_);
-    std::memcpy(buffer.data() + offset, &accel_x, sizeof(accel_x));
-    offset += sizeof(accel_x);
-    std::memcpy(buffer.data() + offset, &accel_y, sizeof(accel_y));
-    offset += sizeof(accel_y);
-    std::memcpy(buffer.data() + offset, &accel_z, sizeof(accel_z));
-    offset += sizeof(accel_z);
-    std::memcpy(buffer.data() + offset, &gyro_x, sizeof(gyro_x));
-    offset += sizeof(gyro_x);
-    std::memcpy(buffer.data() + offset, &gyro_y, sizeof(gyro_y));
-    offset += sizeof(gyro_y);
-    std::memcpy(buffer.data() + offset, &gyro_z, sizeof(gyro_z));
+size_t ImuBatch::serialized_size() const noexcept {
+    return serialization::serialized_size(*this);
 }
 
-std::optional<ImuData> ImuData::deserialize(ConstPayload data) {
-    if (data.size() < sizeof(uint32_t)) return std::nullopt;
-
-    ImuData result;
-    size_t offset = 0;
-
-    // Deserialize sensor_id
-    uint32_t id_len;
-    std::memcpy(&id_len, data.data() + offset, sizeof(id_len));
-    offset += sizeof(id_len);
-    if (data.size() < offset + id_len) return std::nullopt;
-
-    result.sensor_id_.assign(reinterpret_cast<const char*>(data.data() + offset), id_len);
-    offset += id_len;
-
-    // Deserialize fixed fields
-    constexpr size_t fixed_size = sizeof(result.timestamp_ns_) +
-                                  sizeof(result.accel_x) + sizeof(result.accel_y) + sizeof(result.accel_z) +
-                                  sizeof(result.gyro_x) + sizeof(result.gyro_y) + sizeof(result.gyro_z);
-    if (data.size() < offset + fixed_size) return std::nullopt;
-
-    std::memcpy(&result.timestamp_ns_, data.data() + offset, sizeof(result.timestamp_ns_));
-    offset += sizeof(result.timestamp_ns_);
-    std::memcpy(&result.accel_x, data.data() + offset, sizeof(result.accel_x));
-    offset += sizeof(result.accel_x);
-    std::memcpy(&result.accel_y, data.data() + offset, sizeof(result.accel_y));
-    offset += sizeof(result.accel_y);
-    std::memcpy(&result.accel_z, data.data() + offset, sizeof(result.accel_z));
-    offset += sizeof(result.accel_z);
-    std::memcpy(&result.gyro_x, data.data() + offset, sizeof(result.gyro_x));
-    offset += sizeof(result.gyro_x);
-    std::memcpy(&result.gyro_y, data.data() + offset, sizeof(result.gyro_y));
-    offset += sizeof(result.gyro_y);
-    std::memcpy(&result.gyro_z, data.data() + offset, sizeof(result.gyro_z));
-
-    return result;
-}
-
-}   // namespace sensorstreamkit::core
\ No newline at end of file
+void ImuBatch::serialize(std::vector<uint8_t>& buffer) const {
+    append_serialized(*this, buffer);
+}
+
+size_t ImuBatch::serialize_into(MutablePayload out) const noexcept {
+    return serialization::serialize_into(*this, out);
+}
+
+std::optional<ImuBatch> ImuBatch::deserialize(ConstPayload data) {
+    return serialization::deserialize<ImuBatch>(data);
+}
+
+bool ImuBatch::deserialize_into(ConstPayload data, ImuBatch& out) {
+    return serialization::deserialize_into(data, out);
+}
+
+}   // namespace sensorstreamkit::core
@@ -0,0 +1,170 @@
+/**
+ * @file message_view.cpp
+ * @brief Zero-copy payload view validation
+ */
+
+#include "sensorstreamkit/core/message_view.hpp"
+
+namespace sensorstreamkit::core {
+
+namespace {
+
+/**
+ * @brief Parse a uint32 length-prefixed string (or interned id) starting at offset
+ * @return View into data or strings, or nullopt if the prefix or bytes
+ *         overrun the buffer or the id is unknown
+ */
+std::optional<std::string_view> read_string(ConstPayload data, size_t& offset,
+                                            const StringRegistry* strings) noexcept {
+    if (data.size() < offset + sizeof(uint32_t)) return std::nullopt;
+
+    const auto len = detail::load_unaligned<uint32_t>(data.data() + offset);
+    offset += sizeof(uint32_t);
+
+    if (len & StringRegistry::kInternedFlag) {
+        if (strings == nullptr) return std::nullopt;
+        return strings->lookup(len & ~StringRegistry::kInternedFlag);
+    }
+
+    if (data.size() - offset < len) return std::nullopt;
+
+    std::string_view str(reinterpret_cast<const char*>(data.data() + offset), len);
+    offset += len;
+    return str;
+}
+
+}  // namespace
+
+
+// ===========================================================================
+// CameraFrameData View
+// ===========================================================================
+
+std::optional<PayloadView<CameraFrameData>> PayloadView<CameraFrameData>::from(ConstPayload data,
+                                                                               const StringRegistry* strings) noexcept {
+    size_t offset = 0;
+    PayloadView view;
+
+    auto sensor_id = read_string(data, offset, strings);
+    if (!sensor_id) return std::nullopt;
+    view.sensor_id_ = *sensor_id;
+
+    if (data.size() < offset + fixed_size) return std::nullopt;
+    view.fixed_ = data.data() + offset;
+    offset += fixed_size;
+
+    auto encoding = read_string(data, offset, strings);
+    if (!encoding) return std::nullopt;
+    view.encoding_ = *encoding;
+
+    return view;
+}
+
+CameraFrameData PayloadView<CameraFrameData>::to_owned() const {
+    return CameraFrameData{
+        .sensor_id_ = std::pmr::string(sensor_id_),
+        .timestamp_ns_ = timestamp_ns(),
+        .frame_id = frame_id(),
+        .width = width(),
+        .height = height(),
+        .encoding = std::pmr::string(encoding_)
+    };
+}
+
+
+// ===========================================================================
+// LidarScanData View
+// ===========================================================================
+
+std::optional<PayloadView<LidarScanData>> PayloadView<LidarScanData>::from(ConstPayload data,
+                                                                           const StringRegistry* strings) noexcept {
+    size_t offset = 0;
+    PayloadView view;
+
+    auto sensor_id = read_string(data, offset, strings);
+    if (!sensor_id) return std::nullopt;
+    view.sensor_id_ = *sensor_id;
+
+    if (data.size() < offset + fixed_size) return std::nullopt;
+    view.fixed_ = data.data() + offset;
+    offset += fixed_size;
+
+    auto points = PointCloudView::from(data, offset);
+    if (!points) return std::nullopt;
+    view.points_ = *points;
+
+    return view;
+}
+
+LidarScanData PayloadView<LidarScanData>::to_owned() const {
+    return LidarScanData{
+        .sensor_id_ = std::pmr::string(sensor_id_),
+        .timestamp_ns_ = timestamp_ns(),
+        .num_points = num_points(),
+        .scan_duration_ms = scan_duration_ms(),
+        .points = points_.to_owned()
+    };
+}
+
+
+// ===========================================================================
+// ImuData View
+// ===========================================================================
+
+std::optional<PayloadView<ImuData>> PayloadView<ImuData>::from(ConstPayload data,
+                                                               const StringRegistry* strings) noexcept {
+    size_t offset = 0;
+    PayloadView view;
+
+    auto sensor_id = read_string(data, offset, strings);
+    if (!sensor_id) return std::nullopt;
+    view.sensor_id_ = *sensor_id;
+
+    if (data.size() < offset + fixed_size) return std::nullopt;
+    view.fixed_ = data.data() + offset;
+
+    return view;
+}
+
+ImuData PayloadView<ImuData>::to_owned() const {
+    return ImuData{
+        .sensor_id_ = std::pmr::string(sensor_id_),
+        .timestamp_ns_ = timestamp_ns(),
+        .accel_x = accel_x(),
+        .accel_y = accel_y(),
+        .accel_z = accel_z(),
+        .gyro_x = gyro_x(),
+        .gyro_y = gyro_y(),
+        .gyro_z = gyro_z()
+    };
+}
+
+
+// ===========================================================================
+// ImuBatch View
+// ===========================================================================
+
+std::optional<PayloadView<ImuBatch>> PayloadView<ImuBatch>::from(ConstPayload data,
+                                                                 const StringRegistry* strings) noexcept {
+    size_t offset = 0;
+    PayloadView view;
+
+    auto sensor_id = read_string(data, offset, strings);
+    if (!sensor_id) return std::nullopt;
+    view.sensor_id_ = *sensor_id;
+
+    auto samples = ImuSamplesView::from(data, offset);
+    if (!samples) return std::nullopt;
+    view.samples_ = *samples;
+
+    return view;
+}
+
+ImuBatch PayloadView<ImuBatch>::to_owned() const {
+    return ImuBatch{
+        .sensor_id_ = std::pmr::string(sensor_id_),
+        .samples = samples_.to_owned()
+    };
+}
+
+}   // namespace sensorstreamkit::core
@@ -0,0 +1,323 @@
+/**
+ * @file point_cloud.cpp
+ * @brief PointCloud columns, wire codec and SSE2 / NEON quantization kernels
+ */
+
+#include "sensorstreamkit/core/point_cloud.hpp"
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define SSK_HAS_SSE2_QUANTIZE 1
+#else
+#define SSK_HAS_SSE2_QUANTIZE 0
+#endif
+
+#if defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define SSK_HAS_NEON_QUANTIZE 1
+#else
+#define SSK_HAS_NEON_QUANTIZE 0
+#endif
+
+namespace sensorstreamkit::core {
+
+// ============================================================================
+// Quantization Kernels
+// ============================================================================
+
+namespace quantization {
+
+namespace {
+
+constexpr float kInvalidSteps = static_cast<float>(kInvalidStep);
+
+// Same operation order as the vector paths: scale, clamp, round
+inline int16_t encode_one(float value, float inverse) noexcept {
+    float steps = value * inverse;
+    if (std::isnan(steps)) return kInvalidStep;
+    steps = steps < kMaxStep ? steps : kMaxStep;
+    steps = steps > kMinStep ? steps : kMinStep;
+    return static_cast<int16_t>(std::lrint(steps));
+}
+
+}  // namespace
+
+void encode(uint8_t* dst, const float* src, size_t count, float resolution) noexcept {
+    const float inverse = 1.0f / resolution;
+    size_t i = 0;
+
+#if SSK_HAS_SSE2_QUANTIZE
+    const __m128 scale = _mm_set1_ps(inverse);
+    const __m128 lo = _mm_set1_ps(kMinStep);
+    const __m128 hi = _mm_set1_ps(kMaxStep);
+    const __m128 invalid = _mm_set1_ps(kInvalidSteps);
+    // NaN lanes become kInvalidStep; min/max alone would clamp them to kMaxStep
+    auto clamp = [&](__m128 steps) {
+        const __m128 number = _mm_cmpord_ps(steps, steps);
+        const __m128 clamped = _mm_max_ps(_mm_min_ps(steps, hi), lo);
+        return _mm_or_ps(_mm_and_ps(number, clamped), _mm_andnot_ps(number, invalid));
+    };
+    for (; i + 8 <= count; i += 8) {
+        const __m128 a = clamp(_mm_mul_ps(_mm_loadu_ps(src + i), scale));
+        const __m128 b = clamp(_mm_mul_ps(_mm_loadu_ps(src + i + 4), scale));
+        // Converts with the current rounding mode (nearest), like lrint()
+        const __m128i packed = _mm_packs_epi32(_mm_cvtps_epi32(a), _mm_cvtps_epi32(b));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i * sizeof(int16_t)), packed);
+    }
+#elif SSK_HAS_NEON_QUANTIZE
+    const float32x4_t lo = vdupq_n_f32(kMinStep);
+    const float32x4_t hi = vdupq_n_f32(kMaxStep);
+    const float32x4_t invalid = vdupq_n_f32(kInvalidSteps);
+    // NaN lanes become kInvalidStep; vcvtnq alone would turn them into 0
+    auto clamp = [&](float32x4_t steps) {
+        return vbslq_f32(vceqq_f32(steps, steps), vmaxq_f32(vminq_f32(steps, hi), lo), invalid);
+    };
+    for (; i + 8 <= count; i += 8) {
+        const float32x4_t a = clamp(vmulq_n_f32(vld1q_f32(src + i), inverse));
+        const float32x4_t b = clamp(vmulq_n_f32(vld1q_f32(src + i + 4), inverse));
+        const int16x8_t packed = vcombine_s16(vqmovn_s32(vcvtnq_s32_f32(a)), vqmovn_s32(vcvtnq_s32_f32(b)));
+        vst1q_u8(dst + i * sizeof(int16_t), vreinterpretq_u8_s16(packed));
+    }
+#endif
+
+    for (; i < count; ++i) {
+        const int16_t step = encode_one(src[i], inverse);
+        std::memcpy(dst + i * sizeof(int16_t), &step, sizeof(step));
+    }
+}
+
+void decode(float* dst, const uint8_t* src, size_t count, float resolution) noexcept {
+    size_t i = 0;
+
+#if SSK_HAS_SSE2_QUANTIZE
+    const __m128 scale = _mm_set1_ps(resolution);
+    const __m128i invalid = _mm_set1_epi32(kInvalidStep);
+    const __m128 nan = _mm_set1_ps(std::numeric_limits<float>::quiet_NaN());
+    auto expand = [&](__m128i steps) {
+        const __m128 invalid_lanes = _mm_castsi128_ps(_mm_cmpeq_epi32(steps, invalid));
+        const __m128 value = _mm_mul_ps(_mm_cvtepi32_ps(steps), scale);
+        return _mm_or_ps(_mm_andnot_ps(invalid_lanes, value), _mm_and_ps(invalid_lanes, nan));
+    };
+    for (; i + 8 <= count; i += 8) {
+        const __m128i steps = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * sizeof(int16_t)));
+        // Sign-extend: put each int16 in the high half of an int32, then shift down
+        const __m128i low = _mm_srai_epi32(_mm_unpacklo_epi16(steps, steps), 16);
+        const __m128i high = _mm_srai_epi32(_mm_unpackhi_epi16(steps, steps), 16);
+        _mm_storeu_ps(dst + i, expand(low));
+        _mm_storeu_ps(dst + i + 4, expand(high));
+    }
+#elif SSK_HAS_NEON_QUANTIZE
+    const int32x4_t invalid = vdupq_n_s32(kInvalidStep);
+    const float32x4_t nan = vdupq_n_f32(std::numeric_limits<float>::quiet_NaN());
+    auto expand = [&](int32x4_t steps) {
+        return vbslq_f32(vceqq_s32(steps, invalid), nan, vmulq_n_f32(vcvtq_f32_s32(steps), resolution));
+    };
+    for (; i + 8 <= count; i += 8) {
+        const int16x8_t steps = vreinterpretq_s16_u8(vld1q_u8(src + i * sizeof(int16_t)));
+        vst1q_f32(dst + i, expand(vmovl_s16(vget_low_s16(steps))));
+        vst1q_f32(dst + i + 4, expand(vmovl_s16(vget_high_s16(steps))));
+    }
+#endif
+
+    for (; i < count; ++i) {
+        int16_t step;
+        std::memcpy(&step, src + i * sizeof(int16_t), sizeof(step));
+        dst[i] = step == kInvalidStep ? std::numeric_limits<float>::quiet_NaN()
+                                      : static_cast<float>(step) * resolution;
+    }
+}
+
+}  // namespace quantization
+
+
+// ============================================================================
+// Point Cloud
+// ============================================================================
+
+void PointCloud::resize(size_t size) {
+    x_.resize(size);
+    y_.resize(size);
+    z_.resize(size);
+    intensity_.resize(size);
+    ring_.resize(size);
+    time_offset_ns_.resize(size);
+}
+
+void PointCloud::reserve(size_t size) {
+    x_.reserve(size);
+    y_.reserve(size);
+    z_.reserve(size);
+    intensity_.reserve(size);
+    ring_.reserve(size);
+    time_offset_ns_.reserve(size);
+}
+
+void PointCloud::clear() noexcept {
+    x_.clear();
+    y_.clear();
+    z_.clear();
+    intensity_.clear();
+    ring_.clear();
+    time_offset_ns_.clear();
+}
+
+void PointCloud::push_back(const LidarPoint& point) {
+    x_.push_back(point.x);
+    y_.push_back(point.y);
+    z_.push_back(point.z);
+    intensity_.push_back(point.intensity);
+    ring_.push_back(point.ring);
+    time_offset_ns_.push_back(point.time_offset_ns);
+}
+
+LidarPoint PointCloud::point(size_t index) const noexcept {
+    return LidarPoint{
+        .x = x_[index],
+        .y = y_[index],
+        .z = z_[index],
+        .intensity = intensity_[index],
+        .ring = ring_[index],
+        .time_offset_ns = time_offset_ns_[index]
+    };
+}
+
+std::span<float> PointCloud::coordinates(Axis axis) noexcept {
+    switch (axis) {
+        case Axis::X: return x_;
+        case Axis::Y: return y_;
+        case Axis::Z: return z_;
+    }
+    return {};
+}
+
+std::span<const float> PointCloud::coordinates(Axis axis) const noexcept {
+    return const_cast<PointCloud*>(this)->coordinates(axis);
+}
+
+
+// ============================================================================
+// Point Cloud View
+// ============================================================================
+
+namespace {
+
+template <typename U>
+const uint8_t* copy_column(std::span<U> dst, const uint8_t* src) noexcept {
+    std::memcpy(dst.data(), src, dst.size_bytes());
+    return src + dst.size_bytes();
+}
+
+}  // namespace
+
+std::optional<PointCloudView> PointCloudView::from(ConstPayload data, size_t& offset) noexcept {
+    if (offset == data.size()) return PointCloudView{};
+
+    uint32_t count;
+    if (data.size() - offset < sizeof(count)) return std::nullopt;
+    std::memcpy(&count, data.data() + offset, sizeof(count));
+    size_t next = offset + sizeof(count);
+
+    PointCloudView view;
+    if (count == 0) {
+        offset = next;
+        return view;
+    }
+
+    float resolution;
+    if (data.size() - next < sizeof(resolution)) return std::nullopt;
+    std::memcpy(&resolution, data.data() + next, sizeof(resolution));
+    next += sizeof(resolution);
+    if (!PointCloud::valid_resolution(resolution)) return std::nullopt;
+
+    view.size_ = count;
+    view.resolution_ = resolution;
+    // Divide rather than multiply, so a corrupt count cannot overflow
+    const size_t point_bytes = 3 * view.coordinate_bytes() + PointCloud::kAttributeBytes;
+    if ((data.size() - next) / point_bytes < count) return std::nullopt;
+
+    view.columns_ = data.data() + next;
+    offset = next + count * point_bytes;
+    return view;
+}
+
+void PointCloudView::decode(PointCloud::Axis axis, std::span<float> out) const noexcept {
+    const size_t column = static_cast<size_t>(axis) * size_ * coordinate_bytes();
+    if (quantized()) {
+        quantization::decode(out.data(), columns_ + column, size_, resolution_);
+    } else {
+        std::memcpy(out.data(), columns_ + column, size_ * sizeof(float));
+    }
+}
+
+void PointCloudView::decode_into(PointCloud& out) const {
+    out.resize(size_);
+    out.set_resolution(resolution_);
+    if (size_ == 0) return;
+
+    decode(PointCloud::Axis::X, out.x());
+    decode(PointCloud::Axis::Y, out.y());
+    decode(PointCloud::Axis::Z, out.z());
+
+    const uint8_t* src = columns_ + 3 * size_ * coordinate_bytes();
+    src = copy_column(out.intensity(), src);
+    src = copy_column(out.ring(), src);
+    copy_column(out.time_offset_ns(), src);
+}
+
+PointCloud PointCloudView::to_owned() const {
+    PointCloud cloud;
+    decode_into(cloud);
+    return cloud;
+}
+
+
+// ============================================================================
+// Wire Codec
+// ============================================================================
+
+size_t FieldCodec<PointCloud>::size(const PointCloud& cloud) noexcept {
+    if (cloud.empty()) return 0;
+    const size_t coordinate_bytes = cloud.quantized() ? sizeof(int16_t) : sizeof(float);
+    return sizeof(uint32_t) + sizeof(float) + cloud.size() * (3 * coordinate_bytes + PointCloud::kAttributeBytes);
+}
+
+uint8_t* FieldCodec<PointCloud>::write(uint8_t* dst, const PointCloud& cloud) noexcept {
+    if (cloud.empty()) return dst;
+    const auto count = static_cast<uint32_t>(cloud.size());
+    std::memcpy(dst, &count, sizeof(count));
+    dst += sizeof(count);
+
+    const float resolution = cloud.resolution();
+    std::memcpy(dst, &resolution, sizeof(resolution));
+    dst += sizeof(resolution);
+
+    for (auto axis : {PointCloud::Axis::X, PointCloud::Axis::Y, PointCloud::Axis::Z}) {
+        const auto column = cloud.coordinates(axis);
+        if (cloud.quantized()) {
+            quantization::encode(dst, column.data(), column.size(), resolution);
+            dst += column.size() * sizeof(int16_t);
+        } else {
+            std::memcpy(dst, column.data(), column.size_bytes());
+            dst += column.size_bytes();
+        }
+    }
+
+    std::memcpy(dst, cloud.intensity().data(), cloud.intensity().size_bytes());
+    dst += cloud.intensity().size_bytes();
+    std::memcpy(dst, cloud.ring().data(), cloud.ring().size_bytes());
+    dst += cloud.ring().size_bytes();
+    std::memcpy(dst, cloud.time_offset_ns().data(), cloud.time_offset_ns().size_bytes());
+    return dst + cloud.time_offset_ns().size_bytes();
+}
+
+bool FieldCodec<PointCloud>::read(ConstPayload data, size_t& offset, PointCloud& cloud) {
+    auto view = PointCloudView::from(data, offset);
+    if (!view) return false;
+    view->decode_into(cloud);
+    return true;
+}
+
+}  // namespace sensorstreamkit::core
@@ -0,0 +1,92 @@
+/**
+ * @file string_registry.cpp
+ * @brief Interning table and its announcement format
+ */
+
+#include "sensorstreamkit/core/string_registry.hpp"
+#include <algorithm>
+#include <cstring>
+#include <unordered_set>
+
+namespace sensorstreamkit::core {
+
+namespace {
+
+void append_u32(std::vector<uint8_t>& buffer, uint32_t value) {
+    const size_t offset = buffer.size();
+    buffer.resize(offset + sizeof(value));
+    std::memcpy(buffer.data() + offset, &value, sizeof(value));
+}
+
+bool read_u32(std::span<const uint8_t> data, size_t& offset, uint32_t& value) noexcept {
+    if (data.size() - offset < sizeof(value)) return false;
+    std::memcpy(&value, data.data() + offset, sizeof(value));
+    offset += sizeof(value);
+    return true;
+}
+
+}  // namespace
+
+
+std::optional<uint32_t> StringRegistry::intern(std::string_view str) {
+    if (auto id = id_of(str)) {
+        return id;
+    }
+    if (names_.size() > kMaxId) {
+        return std::nullopt;
+    }
+
+    const auto id = static_cast<uint32_t>(names_.size());
+    const std::string& stored = *names_.emplace_back(std::make_unique<const std::string>(str));
+    ids_.emplace(stored, id);
+    return id;
+}
+
+void StringRegistry::serialize(std::vector<uint8_t>& buffer) const {
+    size_t total = sizeof(uint32_t);
+    for (const auto& name : names_) {
+        total += sizeof(uint32_t) + name->size();
+    }
+    buffer.reserve(buffer.size() + total);
+
+    append_u32(buffer, static_cast<uint32_t>(names_.size()));
+    for (const auto& name : names_) {
+        append_u32(buffer, static_cast<uint32_t>(name->size()));
+        buffer.insert(buffer.end(), name->begin(), name->end());
+    }
+}
+
+bool StringRegistry::merge(std::span<const uint8_t> announcement) {
+    size_t offset = 0;
+    uint32_t count;
+    if (!read_u32(announcement, offset, count)) return false;
+    if (count > size_t{kMaxId} + 1) return false;
+
+    // Validate everything before touching the registry
+    std::vector<std::string_view> incoming;
+    incoming.reserve(std::min<size_t>(count, announcement.size() / sizeof(uint32_t)));
+    for (uint32_t i = 0; i < count; ++i) {
+        uint32_t len;
+        if (!read_u32(announcement, offset, len)) return false;
+        if (announcement.size() - offset < len) return false;
+        incoming.emplace_back(reinterpret_cast<const char*>(announcement.data() + offset), len);
+        offset += len;
+    }
+
+    const size_t known = std::min(names_.size(), incoming.size());
+    for (size_t id = 0; id < known; ++id) {
+        if (*names_[id] != incoming[id]) return false;
+    }
+
+    // A string under two ids would make id_of() ambiguous
+    std::unordered_set<std::string_view> fresh;
+    for (size_t id = known; id < incoming.size(); ++id) {
+        if (id_of(incoming[id]) || !fresh.insert(incoming[id]).second) return false;
+    }
+    for (size_t id = known; id < incoming.size(); ++id) {
+        intern(incoming[id]);
+    }
+    return true;
+}
+
+}   // namespace sensorstreamkit::core
@@ -0,0 +1,164 @@
+/**
+ * @file timestamp_codec.cpp
+ * @brief Line fit plus byte-width residuals for runs of timestamps
+ */
+
+#include "sensorstreamkit/core/timestamp_codec.hpp"
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+namespace sensorstreamkit::core::timestamp_codec {
+
+namespace {
+
+// Longest run (about 39 hours) whose grid, span << 16, still fits in 64 bits
+constexpr uint64_t kMaxGridSpan = uint64_t{1} << 47;
+
+template <typename R>
+bool fits(int64_t residual) noexcept {
+    return residual >= std::numeric_limits<R>::min() && residual <= std::numeric_limits<R>::max();
+}
+
+uint8_t width_for(int64_t residual) noexcept {
+    if (residual == 0) return 0;
+    if (fits<int8_t>(residual)) return 1;
+    if (fits<int16_t>(residual)) return 2;
+    if (fits<int32_t>(residual)) return 4;
+    return 8;
+}
+
+/*
+ * grid is advanced by addition rather than computed as i * period, so the
+ * loops below carry a simple induction variable and vectorize.
+ */
+
+template <typename R>
+uint8_t* write_residuals(uint8_t* dst, const Plan& plan, std::span<const uint64_t> timestamps) noexcept {
+    uint64_t grid = 0;
+    for (uint64_t timestamp : timestamps) {
+        const auto residual = static_cast<R>(timestamp - plan.base - (grid >> 16));
+        std::memcpy(dst, &residual, sizeof(residual));
+        dst += sizeof(residual);
+        grid += plan.period_q16;
+    }
+    return dst;
+}
+
+void read_grid(uint64_t* out, size_t count, const Plan& plan) noexcept {
+    uint64_t grid = 0;
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = plan.base + (grid >> 16);
+        grid += plan.period_q16;
+    }
+}
+
+template <typename R>
+void read_residuals(uint64_t* out, size_t count, const uint8_t* src, const Plan& plan) noexcept {
+    uint64_t grid = 0;
+    for (size_t i = 0; i < count; ++i) {
+        R residual;
+        std::memcpy(&residual, src + i * sizeof(R), sizeof(R));
+        // Sign-extend, then wrap like the encoder did
+        out[i] = plan.base + (grid >> 16) + static_cast<uint64_t>(static_cast<int64_t>(residual));
+        grid += plan.period_q16;
+    }
+}
+
+// Reads the plan at data[offset] and checks that count residuals follow it
+bool read_plan(ConstPayload data, size_t offset, size_t count, Plan& plan) noexcept {
+    if (data.size() - offset < Plan::kHeaderBytes) return false;
+    const uint8_t* src = data.data() + offset;
+
+    std::memcpy(&plan.base, src, sizeof(plan.base));
+    src += sizeof(plan.base);
+    std::memcpy(&plan.period_q16, src, sizeof(plan.period_q16));
+    src += sizeof(plan.period_q16);
+    plan.width = *src;
+
+    if (plan.width != 0 && plan.width != 1 && plan.width != 2 && plan.width != 4 && plan.width != 8) return false;
+    // Divide rather than multiply, so a corrupt count cannot overflow
+    return plan.width == 0 || (data.size() - offset - Plan::kHeaderBytes) / plan.width >= count;
+}
+
+void read_timestamps(uint64_t* out, size_t count, const uint8_t* src, const Plan& plan) noexcept {
+    switch (plan.width) {
+        case 0: read_grid(out, count, plan); break;
+        case 1: read_residuals<int8_t>(out, count, src, plan); break;
+        case 2: read_residuals<int16_t>(out, count, src, plan); break;
+        case 4: read_residuals<int32_t>(out, count, src, plan); break;
+        case 8: read_residuals<int64_t>(out, count, src, plan); break;
+    }
+}
+
+}  // namespace
+
+Plan plan(std::span<const uint64_t> timestamps) noexcept {
+    Plan result;
+    if (timestamps.empty()) return result;
+
+    result.base = timestamps.front();
+    const size_t steps = timestamps.size() - 1;
+    const uint64_t span = timestamps.back() - result.base;
+    if (steps > 0 && span < kMaxGridSpan) {
+        result.period_q16 = ((span << 16) + steps / 2) / steps;
+    }
+
+    // Centre the line between the extreme residuals, so jitter on the
+    // first sample does not push all others to one side
+    int64_t low = 0;
+    int64_t high = 0;
+    uint64_t grid = 0;
+    for (uint64_t timestamp : timestamps) {
+        const auto residual = static_cast<int64_t>(timestamp - result.base - (grid >> 16));
+        low = std::min(low, residual);
+        high = std::max(high, residual);
+        grid += result.period_q16;
+    }
+
+    const auto range = static_cast<uint64_t>(high) - static_cast<uint64_t>(low);
+    if (range > static_cast<uint64_t>(std::numeric_limits<int64_t>::max())) {
+        // Residuals need all 64 bits either way; keep them relative to the first sample
+        result.width = sizeof(uint64_t);
+        return result;
+    }
+    const int64_t shift = low + static_cast<int64_t>(range / 2);
+    result.base += static_cast<uint64_t>(shift);
+    result.width = std::max(width_for(low - shift), width_for(high - shift));
+    return result;
+}
+
+uint8_t* encode(uint8_t* dst, const Plan& plan, std::span<const uint64_t> timestamps) noexcept {
+    std::memcpy(dst, &plan.base, sizeof(plan.base));
+    dst += sizeof(plan.base);
+    std::memcpy(dst, &plan.period_q16, sizeof(plan.period_q16));
+    dst += sizeof(plan.period_q16);
+    *dst++ = plan.width;
+
+    switch (plan.width) {
+        case 1: return write_residuals<int8_t>(dst, plan, timestamps);
+        case 2: return write_residuals<int16_t>(dst, plan, timestamps);
+        case 4: return write_residuals<int32_t>(dst, plan, timestamps);
+        case 8: return write_residuals<int64_t>(dst, plan, timestamps);
+        default: return dst;
+    }
+}
+
+bool decode(ConstPayload data, size_t& offset, std::span<uint64_t> out) noexcept {
+    Plan plan;
+    if (!read_plan(data, offset, out.size(), plan)) return false;
+    read_timestamps(out.data(), out.size(), data.data() + offset + Plan::kHeaderBytes, plan);
+    offset += encoded_size(plan, out.size());
+    return true;
+}
+
+std::optional<uint64_t> skip(ConstPayload data, size_t& offset, size_t count) noexcept {
+    Plan plan;
+    if (!read_plan(data, offset, count, plan)) return std::nullopt;
+    uint64_t front = 0;
+    if (count > 0) read_timestamps(&front, 1, data.data() + offset + Plan::kHeaderBytes, plan);
+    offset += encoded_size(plan, count);
+    return front;
+}
+
+}  // namespace sensorstreamkit::core::timestamp_codec
@@ -0,0 +1,199 @@
+/**
+ * @file tsc_clock.cpp
+ * @brief TSC reads, calibration and the seqlock-protected conversion parameters
+ */
+
+#include "sensorstreamkit/core/tsc_clock.hpp"
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#include <x86intrin.h>
+#define SSK_HAS_TSC 1
+#else
+#define SSK_HAS_TSC 0
+#endif
+
+namespace sensorstreamkit::core {
+
+namespace {
+
+[[nodiscard]] inline uint64_t read_tsc() noexcept {
+#if SSK_HAS_TSC
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+struct Sample {
+    uint64_t tsc;
+    uint64_t ns;
+};
+
+/**
+ * @brief Pair a steady_clock reading with the TSC at the midpoint of the call
+ */
+Sample sample() noexcept {
+    const uint64_t before = read_tsc();
+    const uint64_t ns = detail::steady_clock_ns();
+    const uint64_t after = read_tsc();
+    return {before + (after - before) / 2, ns};
+}
+
+/**
+ * @brief Conversion line ns = base_ns + (tsc - base_tsc) * ns_per_tick
+ *
+ * Published with a seqlock: readers retry if seq is odd or changed, so
+ * they never combine fields from two different updates.
+ */
+struct Calibration {
+    std::atomic<uint32_t> seq{0};
+    std::atomic<uint64_t> base_tsc{0};
+    std::atomic<uint64_t> base_ns{0};
+    std::atomic<double> ns_per_tick{0.0};
+    std::atomic<uint64_t> recalibrate_ticks{0};
+    std::atomic<bool> calibrated{false};
+
+    // Held by the one thread that updates the line
+    std::atomic<bool> updating{false};
+    // Start of the long baseline for the rate estimate; only touched while updating
+    Sample origin{0, 0};
+
+    // Largest value now_ns() has returned on any thread; only ever raised
+    std::atomic<uint64_t> last_ns{0};
+};
+
+Calibration g_calibration;
+
+/**
+ * @brief Raise last_ns to ns and return the larger of the two
+ *
+ * A reading on the old line just before a re-anchor can exceed the new
+ * line a few ticks later, on another thread. Holding at last_ns keeps
+ * now_ns() monotonic across threads, not just within one.
+ */
+uint64_t at_least_last(uint64_t ns) noexcept {
+    auto& last_ns = g_calibration.last_ns;
+    uint64_t last = last_ns.load(std::memory_order_relaxed);
+    while (last < ns && !last_ns.compare_exchange_weak(last, ns, std::memory_order_relaxed)) {
+    }
+    return std::max(last, ns);
+}
+
+void publish(uint64_t base_tsc, uint64_t base_ns, double ns_per_tick) noexcept {
+    auto& cal = g_calibration;
+    const uint32_t seq = cal.seq.load(std::memory_order_relaxed);
+    cal.seq.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    cal.base_tsc.store(base_tsc, std::memory_order_relaxed);
+    cal.base_ns.store(base_ns, std::memory_order_relaxed);
+    cal.ns_per_tick.store(ns_per_tick, std::memory_order_relaxed);
+    const auto interval_ns = std::chrono::nanoseconds(TscClock::kRecalibrationInterval).count();
+    cal.recalibrate_ticks.store(static_cast<uint64_t>(static_cast<double>(interval_ns) / ns_per_tick),
+                                std::memory_order_relaxed);
+
+    cal.seq.store(seq + 2, std::memory_order_release);
+}
+
+/**
+ * @brief Re-anchor at tsc: keep the line continuous, correct the rate
+ *
+ * The rate is measured over the whole time since calibrate(), and then
+ * nudged so the accumulated offset from steady_clock is worked off over
+ * the next interval instead of being applied as a step.
+ */
+void recalibrate(uint32_t seen_seq, uint64_t tsc, uint64_t current_ns) noexcept {
+    auto& cal = g_calibration;
+    if (cal.seq.load(std::memory_order_relaxed) != seen_seq) {
+        return;  // Another thread re-anchored since current_ns was computed
+    }
+
+    const uint64_t steady_ns = detail::steady_clock_ns();
+
+    const double rate = static_cast<double>(steady_ns - cal.origin.ns) /
+                        static_cast<double>(tsc - cal.origin.tsc);
+    const double interval_ticks = static_cast<double>(cal.recalibrate_ticks.load(std::memory_order_relaxed));
+    const double offset_ns = static_cast<double>(steady_ns) - static_cast<double>(current_ns);
+
+    // Bound the correction so a stall (e.g. VM pause) cannot make the slope collapse
+    const double ns_per_tick = std::clamp(rate + offset_ns / interval_ticks, rate * 0.5, rate * 1.5);
+    publish(tsc, current_ns, ns_per_tick);
+}
+
+}  // namespace
+
+
+bool TscClock::available() noexcept {
+#if SSK_HAS_TSC
+    static const bool invariant = [] {
+        unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+        if (!__get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx)) return false;
+        return (edx & (1u << 8)) != 0;  // Invariant TSC
+    }();
+    return invariant;
+#else
+    return false;
+#endif
+}
+
+bool TscClock::calibrate() noexcept {
+    if (!available()) {
+        return false;
+    }
+
+    auto& cal = g_calibration;
+    while (cal.updating.exchange(true, std::memory_order_acquire)) {
+        std::this_thread::yield();
+    }
+
+    const Sample start = sample();
+    std::this_thread::sleep_for(kCalibrationWindow);
+    const Sample end = sample();
+
+    cal.origin = start;
+    publish(end.tsc, end.ns, static_cast<double>(end.ns - start.ns) / static_cast<double>(end.tsc - start.tsc));
+    cal.calibrated.store(true, std::memory_order_release);
+
+    cal.updating.store(false, std::memory_order_release);
+    return true;
+}
+
+bool TscClock::is_calibrated() noexcept {
+    return g_calibration.calibrated.load(std::memory_order_acquire);
+}
+
+uint64_t TscClock::now_ns() noexcept {
+    auto& cal = g_calibration;
+    if (!cal.calibrated.load(std::memory_order_acquire)) [[unlikely]] {
+        return at_least_last(detail::steady_clock_ns());
+    }
+
+    for (;;) {
+        const uint32_t seq = cal.seq.load(std::memory_order_acquire);
+        const uint64_t base_tsc = cal.base_tsc.load(std::memory_order_relaxed);
+        const uint64_t base_ns = cal.base_ns.load(std::memory_order_relaxed);
+        const double ns_per_tick = cal.ns_per_tick.load(std::memory_order_relaxed);
+        const uint64_t recalibrate_ticks = cal.recalibrate_ticks.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if ((seq & 1) != 0 || cal.seq.load(std::memory_order_relaxed) != seq) [[unlikely]] {
+            continue;  // Update in progress
+        }
+
+        const uint64_t tsc = read_tsc();
+        const uint64_t ticks = tsc > base_tsc ? tsc - base_tsc : 0;
+        const uint64_t ns = base_ns + static_cast<uint64_t>(static_cast<double>(ticks) * ns_per_tick);
+
+        // One thread re-anchors; the others keep using the current line meanwhile
+        if (ticks > recalibrate_ticks && !cal.updating.exchange(true, std::memory_order_acquire)) [[unlikely]] {
+            recalibrate(seq, tsc, ns);
+            cal.updating.store(false, std::memory_order_release);
+        }
+        return at_least_last(ns);
+    }
+}
+
+}   // namespace sensorstreamkit::core
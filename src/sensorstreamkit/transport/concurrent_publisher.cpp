@@ -0,0 +1,239 @@
+/**
+ * @file concurrent_publisher.cpp
+ * @brief Multi-producer publisher queue and I/O thread
+ */
+
+#include "sensorstreamkit/transport/concurrent_publisher.hpp"
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cstring>
+#include <utility>
+
+namespace sensorstreamkit::transport {
+
+namespace {
+
+constexpr uint32_t kSpinsBeforeWait = 16;
+
+size_t ring_size(size_t requested) {
+    return std::bit_ceil(std::max<size_t>(requested, 1));
+}
+
+}  // namespace
+
+// ============================================================================
+// Queue
+// ============================================================================
+//
+// Bounded multi-producer ring (D. Vyukov's scheme). Slot i of a ring of
+// size N is free for the producer claiming position p when its sequence
+// is p, holds a message for the I/O thread when it is p + 1, and is handed
+// back for position p + N once sent. Producers claim positions with one
+// CAS on tail_; the only consumer owns head_ outright.
+
+ConcurrentPublisher::ConcurrentPublisher(const ConcurrentPublisherConfig& config)
+    : config_(config)
+    , publisher_(config.publisher)
+    , slots_(std::make_unique<Slot[]>(ring_size(config.queue_capacity)))
+    , mask_(ring_size(config.queue_capacity) - 1) {
+
+    config_.max_batch = std::max<size_t>(config_.max_batch, 1);
+    config_.drain_timeout_ms = std::max(config_.drain_timeout_ms, 0);
+    for (size_t i = 0; i <= mask_; ++i) {
+        slots_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+ConcurrentPublisher::~ConcurrentPublisher() {
+    stop();
+}
+
+bool ConcurrentPublisher::bind() {
+    // Leave the socket alone once stopped or running: nobody would send on it
+    return can_start() && publisher_.bind() && start();
+}
+
+bool ConcurrentPublisher::connect() {
+    return can_start() && publisher_.connect() && start();
+}
+
+bool ConcurrentPublisher::can_start() const noexcept {
+    return !io_thread_.joinable() && !closed_.load(std::memory_order_acquire);
+}
+
+bool ConcurrentPublisher::start() {
+    if (!can_start()) {
+        return false;
+    }
+    // Starting the thread publishes the socket to it; nothing else uses it from here on
+    io_thread_ = std::jthread([this](std::stop_token stoken) { run(stoken); });
+    return true;
+}
+
+void ConcurrentPublisher::stop() {
+    {
+        std::lock_guard lock(wake_mutex_);
+        closed_.store(true, std::memory_order_release);
+    }
+    space_ready_.notify_all();
+    if (io_thread_.joinable()) {
+        io_thread_.request_stop();
+        {
+            // Past the deadline, sends stuck on a full pipe give up and the rest is dropped
+            std::unique_lock lock(wake_mutex_);
+            if (!io_finished_.wait_for(lock, std::chrono::milliseconds(config_.drain_timeout_ms),
+                                       [this] { return io_done_; })) {
+                drain_expired_.request_stop();
+            }
+        }
+        io_thread_.join();
+    }
+}
+
+bool ConcurrentPublisher::publish_raw(std::string_view topic, std::span<const uint8_t> data,
+                                      std::stop_token stoken) {
+    zmq::message_t data_msg = publisher_.frame_message(data.size());
+    if (!data.empty()) {
+        std::memcpy(data_msg.data(), data.data(), data.size());
+    }
+    return enqueue(topic, data_msg, stoken);
+}
+
+flatbuffers::FlatBufferBuilder& ConcurrentPublisher::flatbuffer_builder() {
+    thread_local flatbuffers::FlatBufferBuilder builder;
+    return builder;
+}
+
+bool ConcurrentPublisher::enqueue(std::string_view topic, zmq::message_t& data_msg, std::stop_token stoken) {
+    if (closed_.load(std::memory_order_acquire)) {
+        return false;
+    }
+
+    uint64_t position = tail_.load(std::memory_order_relaxed);
+    Slot* slot = nullptr;
+    uint32_t full_spins = 0;
+    while (!slot) {
+        Slot& candidate = slots_[position & mask_];
+        const uint64_t sequence = candidate.sequence.load(std::memory_order_acquire);
+        const auto lag = static_cast<int64_t>(sequence - position);
+        if (lag == 0) {
+            if (tail_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                slot = &candidate;
+            }
+        } else if (lag < 0) {
+            // Full: the slot still holds the message from one lap ago
+            if (config_.overflow == OverflowPolicy::Drop) {
+                messages_dropped_.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+            // The I/O thread frees slots often; yield a few times before sleeping
+            if (++full_spins > kSpinsBeforeWait && !wait_for_space(stoken)) {
+                return false;
+            }
+            std::this_thread::yield();
+            position = tail_.load(std::memory_order_relaxed);
+        } else {
+            position = tail_.load(std::memory_order_relaxed);  // Another producer took it
+        }
+    }
+
+    slot->topic.assign(topic);
+    slot->data = std::move(data_msg);
+    slot->sequence.store(position + 1, std::memory_order_release);
+
+    // Pairs with the fence in run(): either it sees this slot or we see it waiting
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (io_waiting_.load(std::memory_order_relaxed)) {
+        std::lock_guard lock(wake_mutex_);
+        messages_ready_.notify_one();
+    }
+    return true;
+}
+
+bool ConcurrentPublisher::wait_for_space(std::stop_token stoken) {
+    std::unique_lock lock(wake_mutex_);
+    producers_waiting_.fetch_add(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    const bool ready = space_ready_.wait(lock, stoken, [this] {
+        if (closed_.load(std::memory_order_acquire)) {
+            return true;
+        }
+        const uint64_t position = tail_.load(std::memory_order_relaxed);
+        return slots_[position & mask_].sequence.load(std::memory_order_acquire) >= position;
+    });
+    producers_waiting_.fetch_sub(1, std::memory_order_relaxed);
+    return ready && !closed_.load(std::memory_order_acquire);
+}
+
+// ============================================================================
+// I/O Thread
+// ============================================================================
+
+bool ConcurrentPublisher::slot_ready(uint64_t position) const noexcept {
+    return slots_[position & mask_].sequence.load(std::memory_order_acquire) == position + 1;
+}
+
+size_t ConcurrentPublisher::send_batch() {
+    // Checked once per batch, as in ZmqPublisher::publish_batch()
+    const bool bound = publisher_.bound_.load(std::memory_order_relaxed);
+
+    // Runs of one topic share its part. It holds its own copy of the name:
+    // a sent slot's topic belongs to the producers again
+    ZmqPublisher::BatchTopic batch_topic;
+    bool have_topic = false;
+    // Not the I/O thread's token: what was queued before stop() still goes
+    // out, until stop()'s drain deadline cancels this one
+    const std::stop_token cancel = drain_expired_.get_token();
+    size_t taken = 0;
+    uint64_t sent = 0;
+    while (taken < config_.max_batch && slot_ready(head_)) {
+        Slot& slot = slots_[head_ & mask_];
+        if (bound && (!have_topic || slot.topic != batch_topic.part.to_string_view())) {
+            batch_topic.part.rebuild(slot.topic.data(), slot.topic.size());
+            have_topic = true;
+        }
+        if (bound && publisher_.send_message(batch_topic, slot.data, cancel)) {
+            ++sent;
+        } else {
+            slot.data.rebuild();  // Release the frame that failed to send
+        }
+        slot.sequence.store(head_ + mask_ + 1, std::memory_order_release);
+        ++head_;
+        ++taken;
+    }
+    publisher_.messages_sent_.fetch_add(sent, std::memory_order_relaxed);
+
+    if (taken > 0) {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (producers_waiting_.load(std::memory_order_relaxed) > 0) {
+            std::lock_guard lock(wake_mutex_);
+            space_ready_.notify_all();
+        }
+    }
+    return taken;
+}
+
+void ConcurrentPublisher::run(std::stop_token stoken) {
+    for (;;) {
+        if (send_batch() > 0) {
+            continue;
+        }
+        if (stoken.stop_requested()) {
+            {
+                std::lock_guard lock(wake_mutex_);
+                io_done_ = true;  // Stopped and drained
+            }
+            io_finished_.notify_all();
+            return;
+        }
+
+        std::unique_lock lock(wake_mutex_);
+        io_waiting_.store(true, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        messages_ready_.wait(lock, stoken, [this] { return slot_ready(head_); });
+        io_waiting_.store(false, std::memory_order_relaxed);
+    }
+}
+
+}  // namespace sensorstreamkit::transport
@@ -0,0 +1,168 @@
+/**
+ * @file send_buffer_pool.cpp
+ * @brief Size-classed send buffers returned by ZeroMQ's free callback
+ */
+
+#include "sensorstreamkit/transport/send_buffer_pool.hpp"
+#include "sensorstreamkit/core/aligned_allocator.hpp"
+#include <array>
+#include <atomic>
+#include <bit>
+#include <mutex>
+#include <new>
+#include <utility>
+
+namespace sensorstreamkit::transport {
+
+namespace {
+
+constexpr size_t kMinClassShift = std::countr_zero(SendBufferPool::kMinBlockBytes);
+constexpr size_t kClassCount = std::countr_zero(SendBufferPool::kMaxBlockBytes) - kMinClassShift + 1;
+
+[[nodiscard]] constexpr size_t class_of(size_t size) noexcept {
+    return std::bit_width(std::bit_ceil(size)) - 1 - kMinClassShift;
+}
+
+[[nodiscard]] constexpr size_t class_bytes(size_t size_class) noexcept {
+    return SendBufferPool::kMinBlockBytes << size_class;
+}
+
+}  // namespace
+
+
+// ===========================================================================
+// Shared State
+// ===========================================================================
+
+/**
+ * @brief Free lists and counters, alive while the pool or any block in flight refers to them
+ */
+struct SendBufferPool::Shared {
+    // Sits in front of each block's data, one cache line so the data stays aligned
+    struct alignas(core::kCacheLineSize) Block {
+        Shared* owner;
+        Block* next;
+        size_t size_class;
+
+        [[nodiscard]] uint8_t* data() noexcept { return reinterpret_cast<uint8_t*>(this + 1); }
+    };
+
+    struct FreeList {
+        std::mutex mutex;
+        Block* head{nullptr};
+    };
+
+    explicit Shared(size_t max_cached) : max_cached_bytes(max_cached) {}
+
+    ~Shared() {
+        for (auto& list : free_lists) {
+            while (Block* block = list.head) {
+                list.head = block->next;
+                free_block(block);
+            }
+        }
+    }
+
+    Block* acquire(size_t size_class) {
+        FreeList& list = free_lists[size_class];
+        {
+            std::lock_guard lock(list.mutex);
+            if (Block* block = list.head) {
+                list.head = block->next;
+                cached.fetch_sub(class_bytes(size_class), std::memory_order_relaxed);
+                return block;
+            }
+        }
+        void* memory = ::operator new(sizeof(Block) + class_bytes(size_class),
+                                      std::align_val_t{core::kCacheLineSize});
+        allocated.fetch_add(1, std::memory_order_relaxed);
+        return new (memory) Block{this, nullptr, size_class};
+    }
+
+    void release(Block* block) noexcept {
+        const size_t bytes = class_bytes(block->size_class);
+        if (cached.fetch_add(bytes, std::memory_order_relaxed) + bytes > max_cached_bytes) {
+            cached.fetch_sub(bytes, std::memory_order_relaxed);
+            free_block(block);
+            return;
+        }
+        FreeList& list = free_lists[block->size_class];
+        std::lock_guard lock(list.mutex);
+        block->next = list.head;
+        list.head = block;
+    }
+
+    static void free_block(Block* block) noexcept {
+        block->~Block();
+        ::operator delete(block, std::align_val_t{core::kCacheLineSize});
+    }
+
+    void retain() noexcept { refs.fetch_add(1, std::memory_order_relaxed); }
+
+    void drop() noexcept {
+        if (refs.fetch_sub(1, std::memory_order_acq_rel) == 1) delete this;
+    }
+
+    // zmq_free_fn: hint is the block being returned
+    static void on_sent(void*, void* hint) noexcept {
+        auto* block = static_cast<Block*>(hint);
+        Shared* owner = block->owner;
+        owner->release(block);
+        owner->drop();
+    }
+
+    const size_t max_cached_bytes;
+    std::array<FreeList, kClassCount> free_lists;
+    std::atomic<size_t> cached{0};
+    std::atomic<uint64_t> allocated{0};
+    std::atomic<size_t> refs{1};
+};
+
+
+// ===========================================================================
+// Send Buffer Pool
+// ===========================================================================
+
+SendBufferPool::SendBufferPool(size_t max_cached_bytes)
+    : shared_(new Shared(max_cached_bytes)) {}
+
+SendBufferPool::~SendBufferPool() {
+    if (shared_) shared_->drop();
+}
+
+SendBufferPool::SendBufferPool(SendBufferPool&& other) noexcept
+    : shared_(std::exchange(other.shared_, nullptr)) {}
+
+SendBufferPool& SendBufferPool::operator=(SendBufferPool&& other) noexcept {
+    if (this != &other) {
+        if (shared_) shared_->drop();
+        shared_ = std::exchange(other.shared_, nullptr);
+    }
+    return *this;
+}
+
+bool SendBufferPool::rebuild(zmq::message_t& msg, size_t size) {
+    if (!shared_ || !pooled(size)) {
+        return false;
+    }
+    Shared::Block* block = shared_->acquire(class_of(size));
+    shared_->retain();
+    try {
+        msg.rebuild(block->data(), size, &Shared::on_sent, block);
+    } catch (const zmq::error_t&) {
+        // ZeroMQ did not take the block, so it will not call on_sent
+        Shared::on_sent(nullptr, block);
+        throw;
+    }
+    return true;
+}
+
+uint64_t SendBufferPool::blocks_allocated() const noexcept {
+    return shared_ ? shared_->allocated.load(std::memory_order_relaxed) : 0;
+}
+
+size_t SendBufferPool::cached_bytes() const noexcept {
+    return shared_ ? shared_->cached.load(std::memory_order_relaxed) : 0;
+}
+
+}  // namespace sensorstreamkit::transport
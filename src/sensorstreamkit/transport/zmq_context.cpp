@@ -0,0 +1,69 @@
+/**
+ * @file zmq_context.cpp
+ * @brief Shared ZeroMQ context implementation
+ */
+
+#include "sensorstreamkit/transport/zmq_context.hpp"
+#include <mutex>
+
+namespace sensorstreamkit::transport {
+
+namespace {
+
+struct SharedContext {
+    std::mutex mutex;
+    ContextConfig config;
+    std::shared_ptr<ZmqContext> context;
+};
+
+SharedContext& shared_context() {
+    static SharedContext instance;
+    return instance;
+}
+
+}  // namespace
+
+ZmqContext::ZmqContext(const ContextConfig& config)
+    : config_(config)
+    , context_(config.io_threads) {
+
+    // I/O threads start with the first socket, so these still reach all of them
+    for (int cpu : config_.io_thread_cpus) {
+        context_.set(zmq::ctxopt::thread_affinity_cpu_add, cpu);
+    }
+    if (config_.io_thread_sched_policy >= 0) {
+        context_.set(zmq::ctxopt::thread_sched_policy, config_.io_thread_sched_policy);
+    }
+    if (config_.io_thread_priority >= 0) {
+        context_.set(zmq::ctxopt::thread_priority, config_.io_thread_priority);
+    }
+}
+
+ZmqContext::~ZmqContext() {
+    context_.close();
+}
+
+std::shared_ptr<ZmqContext> ZmqContext::shared() {
+    SharedContext& shared = shared_context();
+    std::lock_guard lock(shared.mutex);
+    if (!shared.context) {
+        shared.context = std::make_shared<ZmqContext>(shared.config);
+    }
+    return shared.context;
+}
+
+bool ZmqContext::configure_shared(const ContextConfig& config) {
+    SharedContext& shared = shared_context();
+    std::lock_guard lock(shared.mutex);
+    if (shared.context) {
+        return false;
+    }
+    shared.config = config;
+    return true;
+}
+
+int ZmqContext::io_threads() {
+    return context_.get(zmq::ctxopt::io_threads);
+}
+
+}  // namespace sensorstreamkit::transport
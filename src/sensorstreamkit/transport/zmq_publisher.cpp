@@ -4,6 +4,8 @@
  */
 
 #include "sensorstreamkit/transport/zmq_publisher.hpp"
+#include <cstring>
+#include <memory>
 #include <stdexcept>
 #include <chrono>
 
@@ -11,11 +13,18 @@ namespace sensorstreamkit::transport {
 
 ZmqPublisher::ZmqPublisher(const PublisherConfig& config)
     : config_(config)
-    , context_(std::make_unique<zmq::context_t>(1))
-    , socket_(std::make_unique<zmq::socket_t>(*context_, zmq::socket_type::pub)) {
+    , context_(config.context ? config.context : std::make_shared<ZmqContext>())
+    , socket_(std::make_unique<zmq::socket_t>(context_->get(), zmq::socket_type::pub)) {
+
+    if (config_.string_announce_interval == 0) {
+        config_.string_announce_interval = 1;  // Late subscribers must see a repeat at some point
+    }
 
     socket_->set(zmq::sockopt::sndhwm, config_.high_water_mark);
     socket_->set(zmq::sockopt::sndtimeo, config_.send_timeout_ms);
+    if (config_.io_affinity != 0) {
+        socket_->set(zmq::sockopt::affinity, config_.io_affinity);
+    }
 
     if (config_.conflate) {
         socket_->set(zmq::sockopt::conflate, 1);
@@ -26,15 +35,19 @@ ZmqPublisher::~ZmqPublisher() {
     if (socket_) {
         socket_->close();
     }
-    if (context_) {
-        context_->close();
-    }
+    context_.reset();  // Terminates the context if no other socket shares it
 }
 
 ZmqPublisher::ZmqPublisher(ZmqPublisher&& other) noexcept
     : config_(std::move(other.config_))
     , context_(std::move(other.context_))
     , socket_(std::move(other.socket_))
+    , fb_builder_(std::move(other.fb_builder_))
+    , strings_(std::move(other.strings_))
+    , send_buffers_(std::move(other.send_buffers_))
+    , strings_announcement_(std::move(other.strings_announcement_))
+    , publishes_since_announce_(other.publishes_since_announce_)
+    , announce_due_(other.announce_due_)
     , messages_sent_(other.messages_sent_.load(std::memory_order_relaxed))
     , bound_(other.bound_.load(std::memory_order_relaxed)) {
     // Reset moved-from object to valid state
@@ -55,6 +68,12 @@ void ZmqPublisher::swap(ZmqPublisher& other) noexcept {
     swap(config_, other.config_);
     swap(context_, other.context_);
     swap(socket_, other.socket_);
+    swap(fb_builder_, other.fb_builder_);
+    swap(strings_, other.strings_);
+    swap(send_buffers_, other.send_buffers_);
+    swap(strings_announcement_, other.strings_announcement_);
+    swap(publishes_since_announce_, other.publishes_since_announce_);
+    swap(announce_due_, other.announce_due_);
 
     // Swap atomics (not natively swappable)
     uint64_t ms = messages_sent_.load(std::memory_order_relaxed);
@@ -88,9 +107,153 @@ bool ZmqPublisher::connect() {
     }
 }
 
+void ZmqPublisher::set_string_registry(std::shared_ptr<const StringRegistry> strings) {
+    strings_ = std::move(strings);
+    strings_announcement_.clear();
+    if (strings_) {
+        strings_->serialize(strings_announcement_);
+    }
+    publishes_since_announce_ = 0;
+    announce_due_ = strings_ != nullptr;
+}
+
+bool ZmqPublisher::announce_strings(std::stop_token stoken) {
+    if (!strings_) {
+        return false;
+    }
+    // Not a sensor message, so not counted in messages_sent()
+    return send_raw(kStringRegistryTopic, strings_announcement_, stoken);
+}
+
+void ZmqPublisher::announce_strings_if_due(std::stop_token stoken) {
+    // A failed announcement stays due, so the next publish tries again
+    if (announce_due_ && announce_strings(stoken)) {
+        announce_due_ = false;
+        publishes_since_announce_ = 0;
+    }
+}
+
+void ZmqPublisher::count_interned_publish() noexcept {
+    // Only publishes that went out after the announcement count toward the next one
+    if (!announce_due_ && ++publishes_since_announce_ >= config_.string_announce_interval) {
+        announce_due_ = true;
+    }
+}
+
 bool ZmqPublisher::publish_raw(std::string_view topic, std::span<const uint8_t> data, std::stop_token stoken) {
-    if (!bound_) {
-        return false;  // Not bound
+    if (!send_raw(topic, data, stoken)) {
+        return false;
+    }
+    messages_sent_.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+size_t ZmqPublisher::publish_batch(std::span<const OutgoingMessage> messages, std::stop_token stoken) {
+    if (!bound_ || stoken.stop_requested()) {
+        return 0;
+    }
+
+    BatchTopic batch_topic;
+    std::string_view topic;
+    size_t sent = 0;
+    for (const OutgoingMessage& message : messages) {
+        if (sent == 0 || message.topic != topic) {
+            topic = message.topic;
+            batch_topic.part.rebuild(topic.data(), topic.size());
+        }
+        if (!send_raw(batch_topic, message.data, stoken)) {
+            break;
+        }
+        ++sent;
+    }
+    messages_sent_.fetch_add(sent, std::memory_order_relaxed);
+    return sent;
+}
+
+bool ZmqPublisher::send_raw(std::string_view topic, std::span<const uint8_t> data, std::stop_token stoken) {
+    zmq::message_t data_msg = raw_frame(data);
+    return send_message(topic, data_msg, stoken);
+}
+
+bool ZmqPublisher::send_raw(BatchTopic& topic, std::span<const uint8_t> data, std::stop_token stoken) {
+    zmq::message_t data_msg = raw_frame(data);
+    return send_message(topic, data_msg, stoken);
+}
+
+flatbuffers::FlatBufferBuilder& ZmqPublisher::flatbuffer_builder() {
+    if (!fb_builder_) {
+        fb_builder_ = std::make_unique<flatbuffers::FlatBufferBuilder>();
+    }
+    return *fb_builder_;
+}
+
+zmq::message_t ZmqPublisher::frame_message(size_t size) {
+    if (config_.pool_send_buffers && SendBufferPool::pooled(size)) {
+        zmq::message_t msg;
+        if (send_buffers_.rebuild(msg, size)) {
+            return msg;
+        }
+        // Moved-from pool: fall through to a fresh buffer of the full size
+    }
+    return zmq::message_t(size);
+}
+
+zmq::message_t ZmqPublisher::raw_frame(std::span<const uint8_t> data) {
+    zmq::message_t data_msg = frame_message(data.size());
+    if (!data.empty()) {
+        std::memcpy(data_msg.data(), data.data(), data.size());
+    }
+    return data_msg;
+}
+
+zmq::message_t ZmqPublisher::attachment_message(const ImageBuffer& buffer) {
+    // ZeroMQ frees the part from its I/O thread; the handle keeps the bytes alive until then
+    auto handle = std::make_unique<ImageBuffer>(buffer);
+    auto release = [](void*, void* hint) { delete static_cast<ImageBuffer*>(hint); };
+    zmq::message_t msg(const_cast<uint8_t*>(handle->data()), handle->size(), release, handle.get());
+    handle.release();  // Owned by ZeroMQ now; if the constructor threw, unique_ptr freed it
+    return msg;
+}
+
+std::optional<bool> ZmqPublisher::try_send(zmq::message_t& topic_msg, zmq::message_t& data_msg,
+                                           zmq::message_t* attachment) {
+    try {
+        if (!socket_->send(topic_msg, zmq::send_flags::sndmore | zmq::send_flags::dontwait)) {
+            return std::nullopt;  // Pipe full (EAGAIN); nothing was queued and topic_msg is intact
+        }
+        // The rest of a multipart message is queued once its first part is,
+        // but with sndtimeo set a part may still come back unsent
+        if (attachment && !socket_->send(data_msg, zmq::send_flags::sndmore)) {
+            return false;
+        }
+        return socket_->send(attachment ? *attachment : data_msg, zmq::send_flags::none).has_value();
+    } catch (const zmq::error_t&) {
+        return false;
+    }
+}
+
+bool ZmqPublisher::send_message(std::string_view topic, zmq::message_t& data_msg, std::stop_token stoken,
+                                zmq::message_t* attachment) {
+    if (!bound_ || stoken.stop_requested()) {
+        return false;  // Not bound, or cancelled
+    }
+    zmq::message_t topic_msg(topic.data(), topic.size());
+    return send_parts(topic_msg, data_msg, stoken, attachment);
+}
+
+bool ZmqPublisher::send_message(BatchTopic& topic, zmq::message_t& data_msg, std::stop_token stoken,
+                                zmq::message_t* attachment) {
+    // Sending consumes the part, so each message goes out with its own copy
+    zmq::message_t topic_msg;
+    topic_msg.copy(topic.part);
+    return send_parts(topic_msg, data_msg, stoken, attachment);
+}
+
+bool ZmqPublisher::send_parts(zmq::message_t& topic_msg, zmq::message_t& data_msg, std::stop_token stoken,
+                              zmq::message_t* attachment) {
+    // Fast path: the pipe is rarely at its high water mark, so try before polling
+    if (auto sent = try_send(topic_msg, data_msg, attachment)) {
+        return *sent;
     }
 
     using namespace std::chrono;
@@ -121,15 +284,9 @@ bool ZmqPublisher::publish_raw(std::string_view topic, std::span<const uint8_t>
         }
 
         if (rc > 0 && (items[0].revents & ZMQ_POLLOUT)) {
-            try {
-                zmq::message_t topic_msg(topic.data(), topic.size());
-                socket_->send(topic_msg, zmq::send_flags::sndmore);
-                zmq::message_t data_msg(data.data(), data.size());
-                socket_->send(data_msg, zmq::send_flags::none);
-                messages_sent_.fetch_add(1, std::memory_order_relaxed);
-                return true;
-            } catch (const zmq::error_t&) {
-                return false;
+            // Another sender may have filled the pipe again; keep waiting if so
+            if (auto sent = try_send(topic_msg, data_msg, attachment)) {
+                return *sent;
             }
         }
     }
@@ -4,17 +4,21 @@
  */
 
 #include "sensorstreamkit/transport/zmq_subscriber.hpp"
+#include <algorithm>
 #include <chrono>
 
 namespace sensorstreamkit::transport {
 
 ZmqSubscriber::ZmqSubscriber(const SubscriberConfig& config)
     : config_(config)
-    , context_(std::make_unique<zmq::context_t>(1))
-    , socket_(std::make_unique<zmq::socket_t>(*context_, zmq::socket_type::sub)) {
+    , context_(config.context ? config.context : std::make_shared<ZmqContext>())
+    , socket_(std::make_unique<zmq::socket_t>(context_->get(), zmq::socket_type::sub)) {
 
     socket_->set(zmq::sockopt::rcvhwm, config_.high_water_mark);
     socket_->set(zmq::sockopt::rcvtimeo, config_.receive_timeout_ms);
+    if (config_.io_affinity != 0) {
+        socket_->set(zmq::sockopt::affinity, config_.io_affinity);
+    }
     subscriptions_.clear();
 }
 
@@ -22,9 +26,7 @@ ZmqSubscriber::~ZmqSubscriber() {
     if (socket_) {
         socket_->close();
     }
-    if (context_) {
-        context_->close();
-    }
+    context_.reset();  // Terminates the context if no other socket shares it
 }
 
 ZmqSubscriber::ZmqSubscriber(ZmqSubscriber&& other) noexcept
@@ -32,12 +34,20 @@ ZmqSubscriber::ZmqSubscriber(ZmqSubscriber&& other) noexcept
     , context_(std::move(other.context_))
     , socket_(std::move(other.socket_))
     , messages_received_(other.messages_received_.load())
+    , decode_failures_(other.decode_failures_.load())
     , connected_(other.connected_.load())
-    , subscriptions_(std::move(other.subscriptions_)) {
+    , subscriptions_(std::move(other.subscriptions_))
+    , strings_(std::move(other.strings_))
+    , strings_rejected_(other.strings_rejected_)
+    , announcements_rejected_(other.announcements_rejected_.load()) {
     // Reset moved-from object to valid state
     other.messages_received_.store(0, std::memory_order_relaxed);
+    other.decode_failures_.store(0, std::memory_order_relaxed);
     other.connected_.store(false, std::memory_order_relaxed);
     other.subscriptions_.clear();
+    other.strings_.clear();
+    other.strings_rejected_ = false;
+    other.announcements_rejected_.store(0, std::memory_order_relaxed);
 }
 
 ZmqSubscriber& ZmqSubscriber::operator=(ZmqSubscriber&& other) noexcept {
@@ -46,22 +56,28 @@ ZmqSubscriber& ZmqSubscriber::operator=(ZmqSubscriber&& other) noexcept {
         if (socket_) {
             socket_->close();
         }
-        if (context_) {
-            context_->close();
-        }
+        context_.reset();
 
         // Transfer ownership
         config_ = std::move(other.config_);
         context_ = std::move(other.context_);
         socket_ = std::move(other.socket_);
         messages_received_ = other.messages_received_.load();
+        decode_failures_ = other.decode_failures_.load();
         connected_ = other.connected_.load();
         subscriptions_ = std::move(other.subscriptions_);
+        strings_ = std::move(other.strings_);
+        strings_rejected_ = other.strings_rejected_;
+        announcements_rejected_ = other.announcements_rejected_.load();
 
         // Reset moved-from object to valid state
         other.messages_received_.store(0, std::memory_order_relaxed);
+        other.decode_failures_.store(0, std::memory_order_relaxed);
         other.connected_.store(false, std::memory_order_relaxed);
         other.subscriptions_.clear();
+        other.strings_.clear();
+        other.strings_rejected_ = false;
+        other.announcements_rejected_.store(0, std::memory_order_relaxed);
     }
     return *this;
 }
@@ -111,14 +127,39 @@ bool ZmqSubscriber::unsubscribe(std::string_view topic) {
 }
 
 std::optional<std::vector<uint8_t>> ZmqSubscriber::receive_raw(std::stop_token stoken) {
-    if (!connected_) {
+    zmq::message_t data_msg;
+    if (!receive_frame(data_msg, stoken)) {
         return std::nullopt;
     }
 
+    return std::vector<uint8_t>(
+        static_cast<uint8_t*>(data_msg.data()),
+        static_cast<uint8_t*>(data_msg.data()) + data_msg.size()
+    );
+}
+
+bool ZmqSubscriber::receive_raw(AlignedBuffer& data, std::stop_token stoken) {
+    zmq::message_t data_msg;
+    if (!receive_frame(data_msg, stoken)) {
+        return false;
+    }
+
+    const auto* bytes = static_cast<const uint8_t*>(data_msg.data());
+    data.assign(bytes, bytes + data_msg.size());
+    return true;
+}
+
+bool ZmqSubscriber::receive_frame(zmq::message_t& frame, std::stop_token stoken, zmq::message_t* attachment,
+                                  int timeout_ms) {
+    if (!connected_) {
+        return false;
+    }
+
     using namespace std::chrono;
     auto start_time = steady_clock::now();
-    auto timeout = milliseconds(config_.receive_timeout_ms);
-    bool infinite_timeout = (config_.receive_timeout_ms < 0);
+    auto timeout = milliseconds(timeout_ms);
+    bool infinite_timeout = (timeout_ms < 0);
+    bool polled = false;
 
     while (!stoken.stop_requested()) {
         zmq::pollitem_t items[] = { { *socket_, 0, ZMQ_POLLIN, 0 } };
@@ -127,19 +168,21 @@ std::optional<std::vector<uint8_t>> ZmqSubscriber::receive_raw(std::stop_token s
 
         if (!infinite_timeout) {
             auto elapsed = duration_cast<milliseconds>(steady_clock::now() - start_time);
-            if (elapsed >= timeout) {
-                return std::nullopt; // Timeout
+            // Poll at least once, so a zero timeout still takes a queued message
+            if (elapsed >= timeout && polled) {
+                return false; // Timeout
             }
-            auto remaining = timeout - elapsed;
+            auto remaining = std::max(timeout - elapsed, milliseconds(0));
             if (remaining < poll_duration) {
                 poll_duration = remaining;
             }
         }
+        polled = true;
 
         int rc = zmq::poll(items, 1, poll_duration);
 
         if (rc < 0) {
-            return std::nullopt; // Error in poll
+            return false; // Error in poll
         }
 
         if (rc > 0 && (items[0].revents & ZMQ_POLLIN)) {
@@ -148,20 +191,27 @@ std::optional<std::vector<uint8_t>> ZmqSubscriber::receive_raw(std::stop_token s
                 zmq::message_t topic_msg;
                 auto result = socket_->recv(topic_msg, zmq::recv_flags::none);
                 if (!result) {
-                    return std::nullopt;  // Timeout or error
+                    return false;  // Timeout or error
                 }
 
                 bool has_more = socket_->get(zmq::sockopt::rcvmore);
                 if (!has_more) {
                     // Received a message with only one part, which is not expected.
-                    return std::nullopt;
+                    return false;
                 }
 
                 // Receive data (second part of multipart message)
-                zmq::message_t data_msg;
-                result = socket_->recv(data_msg, zmq::recv_flags::none);
+                result = socket_->recv(frame, zmq::recv_flags::none);
                 if (!result) {
-                    return std::nullopt;  // Timeout or error
+                    return false;  // Timeout or error
+                }
+
+                if (attachment) {
+                    attachment->rebuild();
+                    if (socket_->get(zmq::sockopt::rcvmore) &&
+                        !socket_->recv(*attachment, zmq::recv_flags::none)) {
+                        return false;
+                    }
                 }
 
                 // Consume unexpected extra parts
@@ -172,19 +222,30 @@ std::optional<std::vector<uint8_t>> ZmqSubscriber::receive_raw(std::stop_token s
                     }
                 }
 
-                std::vector<uint8_t> data(
-                    static_cast<uint8_t*>(data_msg.data()),
-                    static_cast<uint8_t*>(data_msg.data()) + data_msg.size()
-                );
+                if (topic_msg.to_string_view() == kStringRegistryTopic) {
+                    if (strings_rejected_ ||
+                        !strings_.merge({static_cast<const uint8_t*>(frame.data()), frame.size()})) {
+                        if (!strings_rejected_) {
+                            // e.g. a second publisher with another registry: its ids would
+                            // resolve to the wrong strings, so resolve none from now on
+                            strings_.clear();
+                            strings_rejected_ = true;
+                        }
+                        announcements_rejected_.fetch_add(1, std::memory_order_relaxed);
+                    }
+                    // Not a receive: with the timeout spent, still take a data message queued behind it
+                    polled = false;
+                    continue;
+                }
 
                 messages_received_.fetch_add(1, std::memory_order_relaxed);
-                return data;
+                return true;
             } catch (const zmq::error_t& e) {
-                return std::nullopt;
+                return false;
             }
         }
     }
-    return std::nullopt; // Stop requested
+    return false; // Stop requested
 }
 
 } // namespace sensorstreamkit::transport
\ No newline at end of file
@@ -7,9 +7,11 @@
 
 namespace sensorstreamkit::transport {
 
-ZmqTransport::ZmqTransport() : context_(std::make_unique<zmq::context_t>(1)) {
-    frontend_socket_ = std::make_unique<zmq::socket_t>(*context_, ZMQ_XSUB);
-    backend_socket_ = std::make_unique<zmq::socket_t>(*context_, ZMQ_XPUB);
+ZmqTransport::ZmqTransport() : ZmqTransport(std::make_shared<ZmqContext>()) {}
+
+ZmqTransport::ZmqTransport(std::shared_ptr<ZmqContext> context) : context_(std::move(context)) {
+    frontend_socket_ = std::make_unique<zmq::socket_t>(context_->get(), ZMQ_XSUB);
+    backend_socket_ = std::make_unique<zmq::socket_t>(context_->get(), ZMQ_XPUB);
 }
     
 
@@ -23,13 +25,10 @@ ZmqTransport::ZmqTransport(ZmqTransport&& other) noexcept
 
 ZmqTransport& ZmqTransport::operator=(ZmqTransport&& other) noexcept {
     if (this != &other) {
-        // Reset sockets first (closes them via unique_ptr), then close context
+        // Reset sockets first (closes them via unique_ptr), then release context
         frontend_socket_.reset();
         backend_socket_.reset();
-        if (context_) {
-            context_->close();
-            context_.reset();
-        }
+        context_.reset();
 
         // Transfer ownership
         context_ = std::move(other.context_);
@@ -40,13 +39,10 @@ ZmqTransport& ZmqTransport::operator=(ZmqTransport&& other) noexcept {
 }
 
 ZmqTransport::~ZmqTransport() {
-    // Reset sockets first (closes them via unique_ptr), then close context
+    // Reset sockets first (closes them via unique_ptr), then release context
     frontend_socket_.reset();
     backend_socket_.reset();
-    if (context_) {
-        context_->close();
-        context_.reset();
-    }
+    context_.reset();
 }
 
 void ZmqTransport::run_broker(const std::string& frontend_endpoint, const std::string& backend_endpoint) {
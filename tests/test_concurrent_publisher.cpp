@@ -0,0 +1,275 @@
+/**
+ * @file test_concurrent_publisher.cpp
+ * @brief Unit tests for ConcurrentPublisher
+ * @author Jo, SeungHyeon (Jo,SH)
+ * @date 2025
+ *
+ * Focuses on:
+ * - Queue capacity and the overflow policies
+ * - Messages queued before bind() and drained by stop(), within its deadline
+ * - Many producer threads publishing through one socket
+ * - Per-producer order as seen by a subscriber
+ * - Topic runs within a drained batch keeping their own topics
+ * - FlatBufferCodec messages, built once on the producer thread
+ */
+
+#include <gtest/gtest.h>
+#include "sensorstreamkit/transport/concurrent_publisher.hpp"
+#include "sensorstreamkit/transport/zmq_subscriber.hpp"
+#include <chrono>
+#include <cstring>
+#include <map>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using namespace sensorstreamkit::transport;
+using namespace sensorstreamkit::core;
+using namespace std::chrono_literals;
+
+// ============================================================================
+// Test Fixture
+// ============================================================================
+
+class ConcurrentPublisherTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        static int port = 16250;
+        port_ = port++;
+        config_.publisher.endpoint = "tcp://*:" + std::to_string(port_);
+        config_.queue_capacity = 4;
+    }
+
+    static std::vector<uint8_t> frame(uint32_t producer, uint32_t index) {
+        std::vector<uint8_t> data(2 * sizeof(uint32_t));
+        std::memcpy(data.data(), &producer, sizeof(producer));
+        std::memcpy(data.data() + sizeof(producer), &index, sizeof(index));
+        return data;
+    }
+
+    int port_;
+    ConcurrentPublisherConfig config_;
+};
+
+// ============================================================================
+// Queue Tests
+// ============================================================================
+
+TEST_F(ConcurrentPublisherTest, CapacityRoundsUpToPowerOfTwo) {
+    config_.queue_capacity = 100;
+    ConcurrentPublisher publisher(config_);
+    EXPECT_EQ(publisher.queue_capacity(), 128u);
+}
+
+TEST_F(ConcurrentPublisherTest, DropPolicyRefusesWhenFull) {
+    config_.overflow = OverflowPolicy::Drop;
+    ConcurrentPublisher publisher(config_);
+
+    // No I/O thread yet, so nothing leaves the queue
+    for (uint32_t i = 0; i < 4; ++i) {
+        EXPECT_TRUE(publisher.publish_raw("imu", frame(0, i)));
+    }
+    EXPECT_FALSE(publisher.publish_raw("imu", frame(0, 4)));
+    EXPECT_FALSE(publisher.publish_raw("imu", frame(0, 5)));
+    EXPECT_EQ(publisher.messages_dropped(), 2u);
+
+    // bind() starts the I/O thread, which sends what was queued
+    ASSERT_TRUE(publisher.bind());
+    publisher.stop();
+    EXPECT_EQ(publisher.messages_sent(), 4u);
+}
+
+TEST_F(ConcurrentPublisherTest, BlockPolicyHonorsStopToken) {
+    ConcurrentPublisher publisher(config_);
+    for (uint32_t i = 0; i < 4; ++i) {
+        ASSERT_TRUE(publisher.publish_raw("imu", frame(0, i)));
+    }
+
+    std::stop_source stop;
+    std::thread canceller([&] {
+        std::this_thread::sleep_for(20ms);
+        stop.request_stop();
+    });
+    EXPECT_FALSE(publisher.publish_raw("imu", frame(0, 4), stop.get_token()));
+    canceller.join();
+    EXPECT_EQ(publisher.messages_dropped(), 0u);
+}
+
+TEST_F(ConcurrentPublisherTest, BlockPolicyWaitsForIoThread) {
+    ConcurrentPublisher publisher(config_);
+    ASSERT_TRUE(publisher.bind());
+
+    for (uint32_t i = 0; i < 100; ++i) {
+        ASSERT_TRUE(publisher.publish_raw("imu", frame(0, i)));
+    }
+    publisher.stop();
+    EXPECT_EQ(publisher.messages_sent(), 100u);
+    EXPECT_EQ(publisher.messages_dropped(), 0u);
+}
+
+TEST_F(ConcurrentPublisherTest, StopReleasesBlockedProducers) {
+    ConcurrentPublisher publisher(config_);
+    for (uint32_t i = 0; i < 4; ++i) {
+        ASSERT_TRUE(publisher.publish_raw("imu", frame(0, i)));
+    }
+
+    std::thread producer([&] { EXPECT_FALSE(publisher.publish_raw("imu", frame(0, 4))); });
+    std::this_thread::sleep_for(20ms);
+    publisher.stop();
+    producer.join();
+
+    EXPECT_FALSE(publisher.publish_raw("imu", frame(0, 5)));
+    EXPECT_FALSE(publisher.bind());
+
+    // The refused bind() left the endpoint free
+    ZmqPublisher other(config_.publisher);
+    EXPECT_TRUE(other.bind());
+}
+
+TEST_F(ConcurrentPublisherTest, StopReturnsWithUnboundedSendTimeout) {
+    config_.publisher.send_timeout_ms = -1;
+    config_.drain_timeout_ms = 0;
+    ConcurrentPublisher publisher(config_);
+    ASSERT_TRUE(publisher.bind());
+    for (uint32_t i = 0; i < 4; ++i) {
+        ASSERT_TRUE(publisher.publish_raw("imu", frame(0, i)));
+    }
+
+    // Sends still waiting at the deadline are cancelled rather than joined forever
+    const auto start = std::chrono::steady_clock::now();
+    publisher.stop();
+    EXPECT_LT(std::chrono::steady_clock::now() - start, 1s);
+    EXPECT_LE(publisher.messages_sent(), 4u);
+}
+
+TEST_F(ConcurrentPublisherTest, BindTwiceFails) {
+    ConcurrentPublisher publisher(config_);
+    ASSERT_TRUE(publisher.bind());
+    EXPECT_FALSE(publisher.bind());
+    EXPECT_FALSE(publisher.connect());
+}
+
+// ============================================================================
+// Concurrency Tests
+// ============================================================================
+
+TEST_F(ConcurrentPublisherTest, ManyProducersOneSocket) {
+    config_.queue_capacity = 64;
+    ConcurrentPublisher publisher(config_);
+    ASSERT_TRUE(publisher.bind());
+
+    constexpr uint32_t kProducers = 8;
+    constexpr uint32_t kPerProducer = 2000;
+    std::vector<std::thread> producers;
+    for (uint32_t p = 0; p < kProducers; ++p) {
+        producers.emplace_back([&publisher, p] {
+            ImuData imu{};
+            imu.sensor_id_ = "imu_" + std::to_string(p);
+            const Message<ImuData> message(imu);
+            for (uint32_t i = 0; i < kPerProducer; ++i) {
+                EXPECT_TRUE(publisher.publish("imu", message));
+            }
+        });
+    }
+    for (auto& producer : producers) {
+        producer.join();
+    }
+    publisher.stop();
+    EXPECT_EQ(publisher.messages_sent(), uint64_t{kProducers} * kPerProducer);
+}
+
+TEST_F(ConcurrentPublisherTest, SubscriberSeesEachProducerInOrder) {
+    config_.queue_capacity = 16;
+    ConcurrentPublisher publisher(config_);
+    ASSERT_TRUE(publisher.bind());
+
+    SubscriberConfig sub_config{.endpoint = "tcp://localhost:" + std::to_string(port_)};
+    sub_config.receive_timeout_ms = 500;
+    ZmqSubscriber subscriber(sub_config);
+    ASSERT_TRUE(subscriber.connect());
+    ASSERT_TRUE(subscriber.subscribe("raw"));
+    std::this_thread::sleep_for(100ms);
+
+    constexpr uint32_t kProducers = 4;
+    constexpr uint32_t kPerProducer = 50;
+    std::vector<std::thread> producers;
+    for (uint32_t p = 0; p < kProducers; ++p) {
+        producers.emplace_back([&publisher, p] {
+            for (uint32_t i = 0; i < kPerProducer; ++i) {
+                EXPECT_TRUE(publisher.publish_raw("raw", frame(p, i)));
+            }
+        });
+    }
+
+    // PUB never blocks the I/O thread, so producers finish without a reader
+    for (auto& producer : producers) {
+        producer.join();
+    }
+
+    std::map<uint32_t, uint32_t> next_index;
+    for (uint32_t n = 0; n < kProducers * kPerProducer; ++n) {
+        auto received = subscriber.receive_raw();
+        ASSERT_TRUE(received.has_value());
+        ASSERT_EQ(received->size(), 2 * sizeof(uint32_t));
+        uint32_t producer = 0;
+        uint32_t index = 0;
+        std::memcpy(&producer, received->data(), sizeof(producer));
+        std::memcpy(&index, received->data() + sizeof(producer), sizeof(index));
+        EXPECT_EQ(index, next_index[producer]++);
+    }
+    EXPECT_EQ(next_index.size(), kProducers);
+}
+
+TEST_F(ConcurrentPublisherTest, MixedTopicsKeepTheirTopics) {
+    config_.queue_capacity = 16;
+    ConcurrentPublisher publisher(config_);
+    ASSERT_TRUE(publisher.bind());
+
+    SubscriberConfig sub_config{.endpoint = "tcp://localhost:" + std::to_string(port_)};
+    sub_config.receive_timeout_ms = 500;
+    ZmqSubscriber subscriber(sub_config);
+    ASSERT_TRUE(subscriber.connect());
+    ASSERT_TRUE(subscriber.subscribe("camera"));
+    std::this_thread::sleep_for(100ms);
+
+    // However the I/O thread splits these into batches and topic runs,
+    // each message must go out under its own topic
+    const std::vector<std::pair<std::string, uint32_t>> queued = {
+        {"camera", 0}, {"camera", 1}, {"lidar", 0}, {"lidar", 1}, {"camera", 2}, {"", 0}, {"camera", 3}};
+    for (const auto& [topic, index] : queued) {
+        ASSERT_TRUE(publisher.publish_raw(topic, frame(0, index)));
+    }
+
+    for (uint32_t index = 0; index < 4; ++index) {
+        auto received = subscriber.receive_raw();
+        ASSERT_TRUE(received.has_value());
+        EXPECT_EQ(*received, frame(0, index));
+    }
+    EXPECT_FALSE(subscriber.receive_raw().has_value());
+    publisher.stop();
+    EXPECT_EQ(publisher.messages_sent(), queued.size());
+}
+
+TEST_F(ConcurrentPublisherTest, FlatBufferCodecMessagesArriveIntact) {
+    ConcurrentPublisher publisher(config_);
+    ASSERT_TRUE(publisher.bind());
+
+    SubscriberConfig sub_config{.endpoint = "tcp://localhost:" + std::to_string(port_)};
+    sub_config.receive_timeout_ms = 500;
+    ZmqSubscriber subscriber(sub_config);
+    ASSERT_TRUE(subscriber.connect());
+    ASSERT_TRUE(subscriber.subscribe("imu"));
+    std::this_thread::sleep_for(100ms);
+
+    ImuData sent_imu{.sensor_id_ = "imu_main", .timestamp_ns_ = 1234567890123, .accel_z = 9.81f};
+    const Message<ImuData, FlatBufferCodec> sent_message(sent_imu);
+    ASSERT_TRUE(publisher.publish("imu", sent_message));
+
+    auto received = subscriber.receive<ImuData, FlatBufferCodec>();
+    ASSERT_TRUE(received.has_value());
+    EXPECT_EQ(received->header().sequence_number, sent_message.header().sequence_number);
+    EXPECT_EQ(received->payload().sensor_id_, sent_imu.sensor_id_);
+    EXPECT_FLOAT_EQ(received->payload().accel_z, sent_imu.accel_z);
+    publisher.stop();
+}
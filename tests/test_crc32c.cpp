@@ -0,0 +1,227 @@
+/**
+ * @file test_crc32c.cpp
+ * @brief Unit tests for CRC32C and checksummed message frames
+ * @author Jo, SeungHyeon (Jo,SH)
+ * @date 2025
+ *
+ * Focuses on:
+ * - Known CRC32C values and incremental extend()/copy()
+ * - Round-trip of checksummed Message<T> and MessageView<T>
+ * - Detection of corrupted and truncated frames
+ * - Rejection of frames with unknown header flags
+ */
+
+#include <gtest/gtest.h>
+#include "sensorstreamkit/core/crc32c.hpp"
+#include "sensorstreamkit/core/message.hpp"
+#include "sensorstreamkit/core/message_view.hpp"
+#include "sensorstreamkit/core/string_registry.hpp"
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+#include <string_view>
+#include <vector>
+
+using namespace sensorstreamkit::core;
+
+namespace {
+
+std::vector<uint8_t> bytes_of(std::string_view text) {
+    return {text.begin(), text.end()};
+}
+
+}  // namespace
+
+// ============================================================================
+// Test Fixture
+// ============================================================================
+
+class Crc32cTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        imu_data_ = ImuData{
+            .sensor_id_ = "imu_main",
+            .timestamp_ns_ = 1234567890,
+            .accel_x = 0.1f,
+            .accel_y = 0.2f,
+            .accel_z = 9.81f,
+            .gyro_x = 0.01f,
+            .gyro_y = 0.02f,
+            .gyro_z = 0.03f
+        };
+
+        camera_data_ = CameraFrameData{
+            .sensor_id_ = "camera_front",
+            .timestamp_ns_ = 1234567890,
+            .frame_id = 42,
+            .width = 1920,
+            .height = 1080,
+            .encoding = "RGB8"
+        };
+    }
+
+    ImuData imu_data_;
+    CameraFrameData camera_data_;
+};
+
+// ============================================================================
+// Checksum Tests
+// ============================================================================
+
+TEST_F(Crc32cTest, KnownValues) {
+    EXPECT_EQ(crc32c::compute({}), 0u);
+    EXPECT_EQ(crc32c::compute(bytes_of("123456789")), 0xE3069283u);
+
+    // RFC 3720 (iSCSI) test vectors
+    EXPECT_EQ(crc32c::compute(std::vector<uint8_t>(32, 0x00)), 0x8A9136AAu);
+    EXPECT_EQ(crc32c::compute(std::vector<uint8_t>(32, 0xFF)), 0x62A8AB43u);
+
+    std::vector<uint8_t> ascending(32);
+    std::iota(ascending.begin(), ascending.end(), uint8_t{0});
+    EXPECT_EQ(crc32c::compute(ascending), 0x46DD794Eu);
+}
+
+TEST_F(Crc32cTest, ExtendMatchesOneShotAtEverySplit) {
+    std::vector<uint8_t> data(100);
+    std::iota(data.begin(), data.end(), uint8_t{7});
+    const uint32_t whole = crc32c::compute(data);
+
+    for (size_t split = 0; split <= data.size(); ++split) {
+        const uint32_t head = crc32c::extend(0, data.data(), split);
+        EXPECT_EQ(crc32c::extend(head, data.data() + split, data.size() - split), whole) << "split " << split;
+    }
+}
+
+TEST_F(Crc32cTest, CopyChecksumsWhatItCopies) {
+    // Spans several copy blocks and ends on a partial one
+    std::vector<uint8_t> source(3 * 4096 + 123);
+    std::iota(source.begin(), source.end(), uint8_t{0});
+    std::vector<uint8_t> target(source.size());
+
+    uint32_t crc = crc32c::extend(0, source.data(), 10);
+    uint8_t* end = crc32c::copy(target.data(), source.data() + 10, source.size() - 10, crc);
+
+    EXPECT_EQ(end, target.data() + source.size() - 10);
+    EXPECT_TRUE(std::equal(source.begin() + 10, source.end(), target.begin()));
+    EXPECT_EQ(crc, crc32c::compute(source));
+}
+
+// ============================================================================
+// Checksummed Message Tests
+// ============================================================================
+
+TEST_F(Crc32cTest, ChecksummedMessageRoundTrip) {
+    Message<ImuData> original(imu_data_);
+    original.set_checksum(true);
+    EXPECT_TRUE(original.header().has_checksum());
+
+    std::vector<uint8_t> buffer;
+    original.serialize(buffer);
+    ASSERT_EQ(buffer.size(), original.serialized_size());
+
+    Message<ImuData> plain(imu_data_);
+    EXPECT_EQ(buffer.size(), plain.serialized_size() + MessageHeader::kChecksumSize);
+
+    // The trailer covers everything before it
+    const size_t covered = buffer.size() - MessageHeader::kChecksumSize;
+    uint32_t trailer;
+    std::memcpy(&trailer, buffer.data() + covered, sizeof(trailer));
+    EXPECT_EQ(trailer, crc32c::compute(ConstPayload(buffer).first(covered)));
+
+    auto result = Message<ImuData>::deserialize(buffer);
+    ASSERT_TRUE(result.has_value());
+    EXPECT_TRUE(result->header().has_checksum());
+    EXPECT_EQ(result->header().sequence_number, original.header().sequence_number);
+    EXPECT_EQ(result->payload().sensor_id_, imu_data_.sensor_id_);
+    EXPECT_FLOAT_EQ(result->payload().accel_z, imu_data_.accel_z);
+}
+
+TEST_F(Crc32cTest, DisablingChecksumRestoresPlainFrame) {
+    Message<ImuData> original(imu_data_);
+    std::vector<uint8_t> plain;
+    original.serialize(plain);
+
+    original.set_checksum(true);
+    original.set_checksum(false);
+    std::vector<uint8_t> buffer;
+    original.serialize(buffer);
+    EXPECT_EQ(buffer, plain);
+}
+
+TEST_F(Crc32cTest, DetectsEverySingleBitFlip) {
+    Message<CameraFrameData> original(camera_data_);
+    original.set_checksum(true);
+    std::vector<uint8_t> buffer;
+    original.serialize(buffer);
+
+    // Skip the flags bit itself: clearing it makes the frame an unchecked one
+    constexpr size_t flags_offset = MessageHeader::serialized_size() - sizeof(uint16_t);
+    for (size_t byte = 0; byte < buffer.size(); ++byte) {
+        for (int bit = 0; bit < 8; ++bit) {
+            if (byte == flags_offset && bit == 0) continue;
+
+            std::vector<uint8_t> corrupted = buffer;
+            corrupted[byte] ^= static_cast<uint8_t>(1u << bit);
+            EXPECT_FALSE(Message<CameraFrameData>::deserialize(corrupted).has_value())
+                << "byte " << byte << " bit " << bit;
+        }
+    }
+}
+
+TEST_F(Crc32cTest, RejectsTruncatedAndPaddedFrames) {
+    Message<CameraFrameData> original(camera_data_);
+    original.set_checksum(true);
+    std::vector<uint8_t> buffer;
+    original.serialize(buffer);
+
+    for (size_t size = 0; size < buffer.size(); ++size) {
+        EXPECT_FALSE(Message<CameraFrameData>::deserialize(ConstPayload(buffer).first(size)).has_value())
+            << "size " << size;
+    }
+
+    buffer.push_back(0);
+    EXPECT_FALSE(Message<CameraFrameData>::deserialize(buffer).has_value());
+}
+
+TEST_F(Crc32cTest, ChecksumWithInternedStrings) {
+    StringRegistry registry;
+    registry.intern(camera_data_.sensor_id_);
+    registry.intern(camera_data_.encoding);
+
+    Message<CameraFrameData> original(camera_data_);
+    original.set_checksum(true);
+    std::vector<uint8_t> buffer(original.serialized_size(registry));
+    ASSERT_EQ(original.serialize_into(buffer, registry), buffer.size());
+
+    Message<CameraFrameData> target;
+    ASSERT_TRUE(Message<CameraFrameData>::deserialize_into(buffer, target, registry));
+    EXPECT_EQ(target.payload().encoding, camera_data_.encoding);
+
+    buffer[MessageHeader::serialized_size() + 1] ^= 0x01;
+    EXPECT_FALSE(Message<CameraFrameData>::deserialize_into(buffer, target, registry));
+}
+
+TEST_F(Crc32cTest, MessageViewVerifiesChecksum) {
+    Message<ImuData> original(imu_data_);
+    original.set_checksum(true);
+    std::vector<uint8_t> buffer;
+    original.serialize(buffer);
+
+    auto view = MessageView<ImuData>::from(buffer);
+    ASSERT_TRUE(view.has_value());
+    EXPECT_EQ(view->payload().sensor_id(), imu_data_.sensor_id_);
+    EXPECT_FLOAT_EQ(view->payload().gyro_z(), imu_data_.gyro_z);
+    ASSERT_TRUE(view->to_message().has_value());
+
+    buffer[buffer.size() - MessageHeader::kChecksumSize - 1] ^= 0x80;
+    EXPECT_FALSE(MessageView<ImuData>::from(buffer).has_value());
+}
+
+TEST_F(Crc32cTest, RejectsUnknownFlags) {
+    Message<ImuData> original(MessageHeader{.flags = 0x8000}, imu_data_);
+    std::vector<uint8_t> buffer;
+    original.serialize(buffer);
+
+    EXPECT_FALSE(Message<ImuData>::deserialize(buffer).has_value());
+    EXPECT_FALSE(MessageView<ImuData>::from(buffer).has_value());
+}
@@ -0,0 +1,288 @@
+/**
+ * @file test_flatbuffers_codec.cpp
+ * @brief Unit tests for the FlatBuffers codec and FlatBufferView<T>
+ * @author Jo, SeungHyeon (Jo,SH)
+ * @date 2025
+ *
+ * Focuses on:
+ * - Round-trip of header and payload through FlatBufferCodec
+ * - Camera pixels and lidar point clouds carried in the tables
+ * - In-place reads (string views point into the encoded buffer)
+ * - Rejection of wrong payload types, header flags, truncated and foreign buffers
+ */
+
+#include <gtest/gtest.h>
+#include "sensorstreamkit/core/flatbuffers_codec.hpp"
+#include <algorithm>
+#include <vector>
+
+using namespace sensorstreamkit::core;
+namespace fbs = sensorstreamkit::fbs;
+
+// Encoding grows a builder, so it must be able to report std::bad_alloc
+static_assert(!noexcept(FlatBufferCodec::encoded_size(MessageHeader{}, CameraFrameData{})));
+static_assert(!Message<CameraFrameData, FlatBufferCodec>::kNothrowEncode);
+static_assert(Message<CameraFrameData>::kNothrowEncode);
+
+// ============================================================================
+// Test Fixture
+// ============================================================================
+
+class FlatBufferCodecTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        camera_data_ = CameraFrameData{
+            .sensor_id_ = "camera_front_left_long_identifier",
+            .timestamp_ns_ = 1234567890123456789ULL,
+            .frame_id = 42,
+            .width = 1920,
+            .height = 1080,
+            .encoding = "BAYER_RGGB8"
+        };
+
+        lidar_data_ = LidarScanData{
+            .sensor_id_ = "lidar_roof",
+            .timestamp_ns_ = 5555555555555555555ULL,
+            .num_points = 100000,
+            .scan_duration_ms = 100.5f
+        };
+
+        imu_data_ = ImuData{
+            .sensor_id_ = "imu_main",
+            .timestamp_ns_ = 9876543210987654321ULL,
+            .accel_x = 1.5f,
+            .accel_y = -2.3f,
+            .accel_z = 9.8f,
+            .gyro_x = 0.1f,
+            .gyro_y = -0.05f,
+            .gyro_z = 0.02f
+        };
+    }
+
+    // Copy out of the builder so the buffer outlives the next encode
+    template <FlatBufferPayload T>
+    std::vector<uint8_t> encode(const Message<T>& message) {
+        auto encoded = FlatBufferCodec::encode(message, builder_);
+        return {encoded.begin(), encoded.end()};
+    }
+
+    flatbuffers::FlatBufferBuilder builder_;
+    CameraFrameData camera_data_;
+    LidarScanData lidar_data_;
+    ImuData imu_data_;
+};
+
+// ============================================================================
+// Round-Trip Tests
+// ============================================================================
+
+TEST_F(FlatBufferCodecTest, CameraRoundTrip) {
+    Message<CameraFrameData> original(camera_data_);
+    auto buffer = encode(original);
+
+    auto decoded = FlatBufferCodec::decode<CameraFrameData>(buffer);
+    ASSERT_TRUE(decoded.has_value());
+
+    EXPECT_EQ(decoded->header().timestamp_ns, original.header().timestamp_ns);
+    EXPECT_EQ(decoded->header().sequence_number, original.header().sequence_number);
+    EXPECT_EQ(decoded->payload().sensor_id_, camera_data_.sensor_id_);
+    EXPECT_EQ(decoded->payload().timestamp_ns_, camera_data_.timestamp_ns_);
+    EXPECT_EQ(decoded->payload().frame_id, camera_data_.frame_id);
+    EXPECT_EQ(decoded->payload().width, camera_data_.width);
+    EXPECT_EQ(decoded->payload().height, camera_data_.height);
+    EXPECT_EQ(decoded->payload().encoding, camera_data_.encoding);
+    EXPECT_TRUE(decoded->payload().pixels.empty());
+}
+
+TEST_F(FlatBufferCodecTest, CameraPixelsRoundTrip) {
+    std::vector<uint8_t> pixels(64 * 48);
+    for (size_t i = 0; i < pixels.size(); ++i) {
+        pixels[i] = static_cast<uint8_t>(i * 7);
+    }
+    camera_data_.pixels = ImageBuffer(pixels);
+    auto buffer = encode(Message<CameraFrameData>(camera_data_));
+
+    // Readable in place, without copying the frame
+    auto view = FlatBufferView<CameraFrameData>::from(buffer);
+    ASSERT_TRUE(view.has_value());
+    ASSERT_NE(view->payload().pixels(), nullptr);
+    EXPECT_TRUE(std::ranges::equal(detail::to_span(view->payload().pixels()), pixels));
+
+    auto decoded = FlatBufferCodec::decode<CameraFrameData>(buffer);
+    ASSERT_TRUE(decoded.has_value());
+    EXPECT_TRUE(std::ranges::equal(decoded->payload().pixels.bytes(), pixels));
+}
+
+TEST_F(FlatBufferCodecTest, LidarRoundTrip) {
+    auto buffer = encode(Message<LidarScanData>(lidar_data_));
+
+    auto decoded = FlatBufferCodec::decode<LidarScanData>(buffer);
+    ASSERT_TRUE(decoded.has_value());
+
+    EXPECT_EQ(decoded->payload().sensor_id_, lidar_data_.sensor_id_);
+    EXPECT_EQ(decoded->payload().timestamp_ns_, lidar_data_.timestamp_ns_);
+    EXPECT_EQ(decoded->payload().num_points, lidar_data_.num_points);
+    EXPECT_FLOAT_EQ(decoded->payload().scan_duration_ms, lidar_data_.scan_duration_ms);
+    EXPECT_TRUE(decoded->payload().points.empty());
+}
+
+TEST_F(FlatBufferCodecTest, LidarPointsRoundTrip) {
+    for (float resolution : {0.0f, 0.01f}) {
+        lidar_data_.points.clear();
+        for (uint32_t i = 0; i < 21; ++i) {
+            lidar_data_.points.push_back(LidarPoint{.x = 0.5f * i, .y = -2.0f, .z = 1.5f, .ring = 3});
+        }
+        lidar_data_.points.set_resolution(resolution);
+        auto buffer = encode(Message<LidarScanData>(lidar_data_));
+
+        auto view = FlatBufferView<LidarScanData>::from(buffer);
+        ASSERT_TRUE(view.has_value());
+        auto points = FlatBufferTraits<LidarScanData>::points(view->payload());
+        ASSERT_TRUE(points.has_value());
+        EXPECT_EQ(points->size(), 21u);
+        EXPECT_EQ(points->resolution(), resolution);
+
+        // Multiples of 0.5 m are exact at 1 cm steps too
+        auto decoded = FlatBufferCodec::decode<LidarScanData>(buffer);
+        ASSERT_TRUE(decoded.has_value());
+        EXPECT_EQ(decoded->payload().points, lidar_data_.points) << "resolution " << resolution;
+    }
+}
+
+TEST_F(FlatBufferCodecTest, ImuRoundTrip) {
+    auto buffer = encode(Message<ImuData>(imu_data_));
+
+    auto decoded = FlatBufferCodec::decode<ImuData>(buffer);
+    ASSERT_TRUE(decoded.has_value());
+
+    EXPECT_EQ(decoded->payload().sensor_id_, imu_data_.sensor_id_);
+    EXPECT_FLOAT_EQ(decoded->payload().accel_x, imu_data_.accel_x);
+    EXPECT_FLOAT_EQ(decoded->payload().accel_y, imu_data_.accel_y);
+    EXPECT_FLOAT_EQ(decoded->payload().accel_z, imu_data_.accel_z);
+    EXPECT_FLOAT_EQ(decoded->payload().gyro_x, imu_data_.gyro_x);
+    EXPECT_FLOAT_EQ(decoded->payload().gyro_y, imu_data_.gyro_y);
+    EXPECT_FLOAT_EQ(decoded->payload().gyro_z, imu_data_.gyro_z);
+}
+
+TEST_F(FlatBufferCodecTest, EmptyStringsRoundTrip) {
+    auto buffer = encode(Message<CameraFrameData>(CameraFrameData{}));
+
+    auto decoded = FlatBufferCodec::decode<CameraFrameData>(buffer);
+    ASSERT_TRUE(decoded.has_value());
+    EXPECT_TRUE(decoded->payload().sensor_id_.empty());
+    EXPECT_TRUE(decoded->payload().encoding.empty());
+}
+
+// ============================================================================
+// In-Place View Tests
+// ============================================================================
+
+TEST_F(FlatBufferCodecTest, ViewReadsInPlace) {
+    auto buffer = encode(Message<CameraFrameData>(camera_data_));
+
+    auto view = FlatBufferView<CameraFrameData>::from(buffer);
+    ASSERT_TRUE(view.has_value());
+
+    const auto* begin = reinterpret_cast<const char*>(buffer.data());
+    const auto sensor_id = view->sensor_id();
+    EXPECT_EQ(sensor_id, camera_data_.sensor_id_);
+    EXPECT_GE(sensor_id.data(), begin);
+    EXPECT_LE(sensor_id.data() + sensor_id.size(), begin + buffer.size());
+
+    EXPECT_EQ(view->timestamp_ns(), camera_data_.timestamp_ns_);
+    EXPECT_EQ(view->payload().frame_id(), camera_data_.frame_id);
+    EXPECT_EQ(view->bytes().data(), buffer.data());
+}
+
+TEST_F(FlatBufferCodecTest, TrustedViewMatchesVerifiedView) {
+    Message<ImuData> original(imu_data_);
+    auto buffer = encode(original);
+
+    auto view = FlatBufferView<ImuData>::from_trusted(buffer);
+    ASSERT_TRUE(view.has_value());
+    EXPECT_EQ(view->header().sequence_number, original.header().sequence_number);
+    EXPECT_EQ(view->sensor_id(), imu_data_.sensor_id_);
+    EXPECT_FLOAT_EQ(view->payload().accel_z(), imu_data_.accel_z);
+}
+
+TEST_F(FlatBufferCodecTest, BuilderIsReusable) {
+    auto first = encode(Message<ImuData>(imu_data_));
+    auto second = encode(Message<LidarScanData>(lidar_data_));
+
+    EXPECT_TRUE(FlatBufferView<ImuData>::from(first).has_value());
+    EXPECT_TRUE(FlatBufferView<LidarScanData>::from(second).has_value());
+}
+
+// ============================================================================
+// Validation Tests
+// ============================================================================
+
+TEST_F(FlatBufferCodecTest, RejectsWrongPayloadType) {
+    auto buffer = encode(Message<ImuData>(imu_data_));
+
+    EXPECT_FALSE(FlatBufferView<CameraFrameData>::from(buffer).has_value());
+    EXPECT_FALSE(FlatBufferView<LidarScanData>::from_trusted(buffer).has_value());
+}
+
+TEST_F(FlatBufferCodecTest, EncodesNoHeaderFlags) {
+    Message<ImuData> message(imu_data_);
+    message.set_checksum(true);
+    auto buffer = encode(message);
+
+    auto view = FlatBufferView<ImuData>::from(buffer);
+    ASSERT_TRUE(view.has_value());
+    EXPECT_EQ(view->header().flags, 0);
+}
+
+TEST_F(FlatBufferCodecTest, RejectsHeaderFlags) {
+    // Built by hand: the codec itself never writes flags
+    const fbs::MessageHeader header(1, 2, ImuData::kMessageType, MessageHeader::kFlagCrc32c);
+    auto payload = FlatBufferTraits<ImuData>::build(builder_, imu_data_);
+    auto root = fbs::CreateSensorMessage(builder_, &header, fbs::SensorPayload::ImuData, payload.Union());
+    fbs::FinishSensorMessageBuffer(builder_, root);
+    std::vector<uint8_t> buffer(builder_.GetBufferPointer(), builder_.GetBufferPointer() + builder_.GetSize());
+
+    EXPECT_FALSE(FlatBufferView<ImuData>::from(buffer).has_value());
+    EXPECT_FALSE(FlatBufferView<ImuData>::from_trusted(buffer).has_value());
+    EXPECT_FALSE(FlatBufferCodec::decode<ImuData>(buffer).has_value());
+}
+
+TEST_F(FlatBufferCodecTest, RejectsMalformedLidarPoints) {
+    // A cloud claiming more points than its bytes hold
+    const std::vector<uint8_t> cloud{100, 0, 0, 0, 0, 0, 0, 0, 1, 2, 3};
+    const fbs::MessageHeader header(1, 2, LidarScanData::kMessageType, 0);
+    auto sensor_id = builder_.CreateString(lidar_data_.sensor_id_);
+    auto points = builder_.CreateVector(cloud.data(), cloud.size());
+    auto payload = fbs::CreateLidarScanData(builder_, sensor_id, 0, 100, 0.0f, points);
+    auto root = fbs::CreateSensorMessage(builder_, &header, fbs::SensorPayload::LidarScanData, payload.Union());
+    fbs::FinishSensorMessageBuffer(builder_, root);
+    std::vector<uint8_t> buffer(builder_.GetBufferPointer(), builder_.GetBufferPointer() + builder_.GetSize());
+
+    EXPECT_FALSE(FlatBufferView<LidarScanData>::from(buffer).has_value());
+    EXPECT_FALSE(FlatBufferCodec::decode<LidarScanData>(buffer).has_value());
+}
+
+TEST_F(FlatBufferCodecTest, RejectsEmptyBuffer) {
+    std::vector<uint8_t> empty;
+    EXPECT_FALSE(FlatBufferView<ImuData>::from(empty).has_value());
+    EXPECT_FALSE(FlatBufferView<ImuData>::from_trusted(empty).has_value());
+}
+
+TEST_F(FlatBufferCodecTest, RejectsMemcpyCodecBuffer) {
+    std::vector<uint8_t> buffer;
+    Message<ImuData>(imu_data_).serialize(buffer);
+
+    EXPECT_FALSE(FlatBufferView<ImuData>::from(buffer).has_value());
+}
+
+TEST_F(FlatBufferCodecTest, RejectsTruncatedBuffer) {
+    auto buffer = encode(Message<CameraFrameData>(camera_data_));
+
+    // The builder writes back to front, so the strings created first sit at
+    // the tail (behind at most a few alignment bytes); cutting into them
+    // must fail verification
+    for (size_t cut : {size_t{8}, size_t{16}, buffer.size() / 2}) {
+        ConstPayload prefix(buffer.data(), buffer.size() - cut);
+        EXPECT_FALSE(FlatBufferView<CameraFrameData>::from(prefix).has_value()) << "cut " << cut;
+    }
+}
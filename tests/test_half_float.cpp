@@ -0,0 +1,139 @@
+/**
+ * @file test_half_float.cpp
+ * @brief Unit tests for half float conversion
+ * @author Jo, SeungHyeon (Jo,SH)
+ * @date 2025
+ *
+ * Focuses on:
+ * - Exact values, rounding to nearest even and overflow to infinity
+ * - Subnormals, infinities and NaNs
+ * - Bulk (F16C / NEON) and scalar conversion agreeing bit for bit
+ */
+
+#include <gtest/gtest.h>
+#include "sensorstreamkit/core/half_float.hpp"
+#include <bit>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+using namespace sensorstreamkit::core;
+
+// ============================================================================
+// Test Fixture
+// ============================================================================
+
+class HalfFloatTest : public ::testing::Test {
+protected:
+    static float from_bits(uint32_t bits) { return std::bit_cast<float>(bits); }
+
+    // Floats around every interesting half boundary, plus random bit patterns
+    static std::vector<float> probe_values() {
+        std::vector<float> values = {
+            0.0f, -0.0f, 1.0f, -1.0f, 9.81f, 0.1f, 65504.0f, 65519.99f, 65520.0f, -65520.0f, 1e10f,
+            std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity(),
+            std::numeric_limits<float>::quiet_NaN(), from_bits(0x7F800001u), from_bits(0xFFA5A5A5u),
+            0x1p-14f, 0x1p-24f, 0x1p-25f, 0x1.8p-25f, 0x1p-26f, std::numeric_limits<float>::denorm_min(),
+        };
+        std::mt19937 rng(11);
+        for (int i = 0; i < 200'000; ++i) {
+            values.push_back(from_bits(static_cast<uint32_t>(rng())));
+        }
+        return values;
+    }
+};
+
+// ============================================================================
+// Scalar Conversion Tests
+// ============================================================================
+
+TEST_F(HalfFloatTest, ExactValues) {
+    EXPECT_EQ(half_float::from_float(1.0f), 0x3C00u);
+    EXPECT_EQ(half_float::from_float(-2.0f), 0xC000u);
+    EXPECT_EQ(half_float::from_float(65504.0f), 0x7BFFu);
+    EXPECT_EQ(half_float::from_float(0x1p-14f), 0x0400u);
+    EXPECT_EQ(half_float::from_float(0x1p-24f), 0x0001u);
+    EXPECT_EQ(half_float::from_float(-0.0f), 0x8000u);
+    EXPECT_FLOAT_EQ(half_float::to_float(0x3555u), 0.333251953125f);
+}
+
+TEST_F(HalfFloatTest, RoundsToNearestEven) {
+    // Halfway between 1 and 1 + 2^-10 rounds down to the even mantissa
+    EXPECT_EQ(half_float::from_float(1.0f + 0x1p-11f), 0x3C00u);
+    EXPECT_EQ(half_float::from_float(1.0f + 3 * 0x1p-11f), 0x3C02u);
+    EXPECT_EQ(half_float::from_float(1.0f + 0x1p-11f + 0x1p-20f), 0x3C01u);
+    // Same in the subnormal range
+    EXPECT_EQ(half_float::from_float(0x1p-25f), 0x0000u);
+    EXPECT_EQ(half_float::from_float(0x1.8p-24f), 0x0002u);
+}
+
+TEST_F(HalfFloatTest, OverflowAndSpecialValues) {
+    EXPECT_EQ(half_float::from_float(65519.99f), 0x7BFFu);
+    EXPECT_EQ(half_float::from_float(65520.0f), 0x7C00u);
+    EXPECT_EQ(half_float::from_float(-1e10f), 0xFC00u);
+    EXPECT_TRUE(std::isinf(half_float::to_float(0x7C00u)));
+    EXPECT_TRUE(std::isnan(half_float::to_float(half_float::from_float(std::numeric_limits<float>::quiet_NaN()))));
+    // Signalling NaN stays NaN instead of turning into infinity
+    EXPECT_EQ(half_float::from_float(from_bits(0x7F800001u)), 0x7E00u);
+}
+
+TEST_F(HalfFloatTest, EveryHalfRoundTrips) {
+    for (uint32_t bits = 0; bits <= 0xFFFFu; ++bits) {
+        const auto half = static_cast<uint16_t>(bits);
+        const float value = half_float::to_float(half);
+        if (std::isnan(value)) {
+            // Quieting sets the top mantissa bit
+            EXPECT_EQ(half_float::from_float(value), half | 0x0200u) << std::hex << bits;
+        } else {
+            EXPECT_EQ(half_float::from_float(value), half) << std::hex << bits;
+        }
+    }
+}
+
+// ============================================================================
+// Bulk Conversion Tests
+// ============================================================================
+
+TEST_F(HalfFloatTest, BulkEncodeMatchesScalar) {
+    const auto values = probe_values();
+    std::vector<uint8_t> encoded(values.size() * sizeof(uint16_t) + 1);
+    // Odd offset: dst need not be aligned
+    half_float::encode(encoded.data() + 1, values.data(), values.size());
+
+    for (size_t i = 0; i < values.size(); ++i) {
+        uint16_t half;
+        std::memcpy(&half, encoded.data() + 1 + i * sizeof(half), sizeof(half));
+        ASSERT_EQ(half, half_float::from_float(values[i])) << "value " << values[i] << " at " << i;
+    }
+}
+
+TEST_F(HalfFloatTest, BulkDecodeMatchesScalar) {
+    std::vector<uint8_t> encoded(0x10000 * sizeof(uint16_t) + 1);
+    for (uint32_t bits = 0; bits <= 0xFFFFu; ++bits) {
+        const auto half = static_cast<uint16_t>(bits);
+        std::memcpy(encoded.data() + 1 + bits * sizeof(half), &half, sizeof(half));
+    }
+    std::vector<float> decoded(0x10000);
+    half_float::decode(decoded.data(), encoded.data() + 1, decoded.size());
+
+    for (uint32_t bits = 0; bits <= 0xFFFFu; ++bits) {
+        ASSERT_EQ(std::bit_cast<uint32_t>(decoded[bits]),
+                  std::bit_cast<uint32_t>(half_float::to_float(static_cast<uint16_t>(bits))))
+            << std::hex << bits;
+    }
+}
+
+TEST_F(HalfFloatTest, ShortRunsUseTail) {
+    const std::vector<float> values = {1.5f, -3.25f, 1000.0f, 0.001f, 7.0f};
+    for (size_t count = 0; count <= values.size(); ++count) {
+        std::vector<uint8_t> encoded(count * sizeof(uint16_t));
+        half_float::encode(encoded.data(), values.data(), count);
+        std::vector<float> decoded(count);
+        half_float::decode(decoded.data(), encoded.data(), count);
+        for (size_t i = 0; i < count; ++i) {
+            EXPECT_NEAR(decoded[i], values[i], std::abs(values[i]) / 2048.0f);
+        }
+    }
+}
@@ -0,0 +1,226 @@
+/**
+ * @file test_header_extensions.cpp
+ * @brief Unit tests for HeaderExtensions and the extension block in frames
+ * @author Jo, SeungHyeon (Jo,SH)
+ * @date 2025
+ *
+ * Focuses on:
+ * - Adding, finding and typed access to entries
+ * - Frames without extensions staying byte-for-byte unchanged
+ * - Round trips with and without checksum and attachment
+ * - Skipping unknown entry types, rejecting malformed blocks
+ * - MessageView exposing entries without copying them
+ */
+
+#include <gtest/gtest.h>
+#include "sensorstreamkit/core/header_extensions.hpp"
+#include "sensorstreamkit/core/message.hpp"
+#include "sensorstreamkit/core/message_view.hpp"
+#include <array>
+#include <cstring>
+#include <vector>
+
+using namespace sensorstreamkit::core;
+
+// ============================================================================
+// Test Fixture
+// ============================================================================
+
+class HeaderExtensionsTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        imu_data_.sensor_id_ = "imu_front";
+        imu_data_.timestamp_ns_ = 1'234'567'890ull;
+        imu_data_.accel_z = 9.81f;
+        imu_data_.gyro_y = -0.02f;
+    }
+
+    static std::vector<uint8_t> serialize_message(const Message<ImuData>& message) {
+        std::vector<uint8_t> frame;
+        message.serialize(frame);
+        return frame;
+    }
+
+    ImuData imu_data_;
+    const std::array<uint8_t, 16> trace_id_{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16};
+};
+
+// ============================================================================
+// Entry Tests
+// ============================================================================
+
+TEST_F(HeaderExtensionsTest, AddAndFind) {
+    HeaderExtensions extensions;
+    EXPECT_TRUE(extensions.empty());
+    ASSERT_TRUE(extensions.add(HeaderExtensions::kTraceId, trace_id_));
+    ASSERT_TRUE(extensions.add(HeaderExtensions::kDeadlineNs, uint64_t{5'000'000}));
+    EXPECT_EQ(extensions.size(), 4 + 16 + 4 + 8u);
+
+    auto trace = extensions.find(HeaderExtensions::kTraceId);
+    ASSERT_TRUE(trace.has_value());
+    EXPECT_TRUE(std::equal(trace->begin(), trace->end(), trace_id_.begin(), trace_id_.end()));
+    EXPECT_EQ(extensions.get<uint64_t>(HeaderExtensions::kDeadlineNs), 5'000'000u);
+
+    EXPECT_FALSE(extensions.find(HeaderExtensions::kPublisherId).has_value());
+    // Wrong size for the requested type
+    EXPECT_FALSE(extensions.get<uint32_t>(HeaderExtensions::kDeadlineNs).has_value());
+
+    extensions.clear();
+    EXPECT_TRUE(extensions.empty());
+}
+
+TEST_F(HeaderExtensionsTest, RefusesOversizedBlock) {
+    HeaderExtensions extensions;
+    std::vector<uint8_t> value(HeaderExtensions::kMaxBytes - HeaderExtensionsView::kEntryHeaderSize);
+    ASSERT_TRUE(extensions.add(HeaderExtensions::kFirstUserType, value));
+    EXPECT_EQ(extensions.size(), HeaderExtensions::kMaxBytes);
+    EXPECT_FALSE(extensions.add(HeaderExtensions::kFirstUserType + 1, ConstPayload{}));
+    EXPECT_EQ(extensions.size(), HeaderExtensions::kMaxBytes);
+}
+
+TEST_F(HeaderExtensionsTest, ViewRejectsMalformedEntries) {
+    HeaderExtensions extensions;
+    ASSERT_TRUE(extensions.add(HeaderExtensions::kPublisherId, uint64_t{42}));
+    std::vector<uint8_t> entries(extensions.bytes().begin(), extensions.bytes().end());
+
+    EXPECT_TRUE(HeaderExtensionsView::from(entries).has_value());
+    EXPECT_FALSE(HeaderExtensionsView::from(ConstPayload(entries).first(entries.size() - 1)).has_value());
+    EXPECT_FALSE(HeaderExtensionsView::from(ConstPayload(entries).first(3)).has_value());
+
+    HeaderExtensions target;
+    ASSERT_TRUE(target.add(HeaderExtensions::kTraceId, trace_id_));
+    EXPECT_FALSE(target.assign(ConstPayload(entries).first(entries.size() - 1)));
+    EXPECT_TRUE(target.empty());
+    EXPECT_TRUE(target.assign(entries));
+    EXPECT_EQ(target, extensions);
+}
+
+// ============================================================================
+// Frame Tests
+// ============================================================================
+
+TEST_F(HeaderExtensionsTest, NoExtensionsLeavesFrameUnchanged) {
+    Message<ImuData> message(imu_data_);
+    const auto frame = serialize_message(message);
+    EXPECT_EQ(frame.size(), MessageHeader::serialized_size() + imu_data_.serialized_size());
+
+    uint16_t flags;
+    std::memcpy(&flags, frame.data() + 14, sizeof(flags));
+    EXPECT_EQ(flags, 0u);
+}
+
+TEST_F(HeaderExtensionsTest, RoundTrip) {
+    for (bool checksum : {false, true}) {
+        Message<ImuData> original(imu_data_);
+        original.set_checksum(checksum);
+        ASSERT_TRUE(original.extensions().add(HeaderExtensions::kTraceId, trace_id_));
+        ASSERT_TRUE(original.extensions().add(HeaderExtensions::kDeadlineNs, uint64_t{77}));
+        const auto frame = serialize_message(original);
+        ASSERT_EQ(frame.size(), original.serialized_size());
+        EXPECT_EQ(frame.size(), MessageHeader::serialized_size() + 2 + original.extensions().size() +
+                                    imu_data_.serialized_size() + (checksum ? 4 : 0));
+
+        auto decoded = Message<ImuData>::deserialize(frame);
+        ASSERT_TRUE(decoded.has_value()) << "checksum " << checksum;
+        EXPECT_EQ(decoded->extensions(), original.extensions());
+        EXPECT_EQ(decoded->extensions().get<uint64_t>(HeaderExtensions::kDeadlineNs), 77u);
+        EXPECT_EQ(decoded->header().flags, original.header().flags);
+        EXPECT_EQ(decoded->payload().sensor_id_, imu_data_.sensor_id_);
+        EXPECT_FLOAT_EQ(decoded->payload().accel_z, imu_data_.accel_z);
+    }
+}
+
+TEST_F(HeaderExtensionsTest, RoundTripWithAttachment) {
+    CameraFrameData camera{.sensor_id_ = "cam_0", .timestamp_ns_ = 5, .frame_id = 3, .width = 2, .height = 2,
+                           .encoding = "MONO8", .pixels = ImageBuffer({1, 2, 3, 4})};
+    Message<CameraFrameData> original(camera);
+    original.set_checksum(true);
+    ASSERT_TRUE(original.extensions().add(HeaderExtensions::kPublisherId, uint64_t{9}));
+    std::vector<uint8_t> frame;
+    original.serialize(frame);
+
+    auto decoded = Message<CameraFrameData>::deserialize(frame);
+    ASSERT_TRUE(decoded.has_value());
+    EXPECT_EQ(decoded->extensions().get<uint64_t>(HeaderExtensions::kPublisherId), 9u);
+    ASSERT_EQ(decoded->payload().pixels.size(), 4u);
+    EXPECT_EQ(decoded->payload().pixels.data()[3], 4);
+}
+
+TEST_F(HeaderExtensionsTest, SkipsUnknownTypes) {
+    Message<ImuData> original(imu_data_);
+    const std::array<uint8_t, 5> unknown{0xAA, 0xBB, 0xCC, 0xDD, 0xEE};
+    ASSERT_TRUE(original.extensions().add(HeaderExtensions::kFirstUserType + 7, unknown));
+    ASSERT_TRUE(original.extensions().add(HeaderExtensions::kDeadlineNs, uint64_t{123}));
+
+    auto decoded = Message<ImuData>::deserialize(serialize_message(original));
+    ASSERT_TRUE(decoded.has_value());
+    EXPECT_EQ(decoded->extensions().get<uint64_t>(HeaderExtensions::kDeadlineNs), 123u);
+}
+
+TEST_F(HeaderExtensionsTest, ReuseClearsPreviousEntries) {
+    Message<ImuData> with(imu_data_);
+    ASSERT_TRUE(with.extensions().add(HeaderExtensions::kTraceId, trace_id_));
+    const Message<ImuData> without(imu_data_);
+
+    Message<ImuData> target;
+    ASSERT_TRUE(Message<ImuData>::deserialize_into(serialize_message(with), target));
+    EXPECT_FALSE(target.extensions().empty());
+    ASSERT_TRUE(Message<ImuData>::deserialize_into(serialize_message(without), target));
+    EXPECT_TRUE(target.extensions().empty());
+}
+
+TEST_F(HeaderExtensionsTest, RejectsMalformedBlock) {
+    Message<ImuData> original(imu_data_);
+    ASSERT_TRUE(original.extensions().add(HeaderExtensions::kDeadlineNs, uint64_t{1}));
+    auto frame = serialize_message(original);
+
+    // Block size past the end of the frame
+    auto oversized = frame;
+    const uint16_t block_size = 0xFFFF;
+    std::memcpy(oversized.data() + MessageHeader::serialized_size(), &block_size, sizeof(block_size));
+    EXPECT_FALSE(Message<ImuData>::deserialize(oversized).has_value());
+    EXPECT_FALSE(MessageView<ImuData>::from(oversized).has_value());
+
+    // Entry length past the end of the block
+    auto bad_entry = frame;
+    const uint16_t length = 9;
+    std::memcpy(bad_entry.data() + MessageHeader::serialized_size() + 4, &length, sizeof(length));
+    EXPECT_FALSE(Message<ImuData>::deserialize(bad_entry).has_value());
+    EXPECT_FALSE(MessageView<ImuData>::from(bad_entry).has_value());
+
+    // Also when the caller does not keep the entries
+    MessageHeader header;
+    ImuData payload;
+    EXPECT_TRUE(NativeCodec::decode(frame, header, payload));
+    EXPECT_FALSE(NativeCodec::decode(bad_entry, header, payload));
+}
+
+TEST_F(HeaderExtensionsTest, EntriesStayOnTheMessage) {
+    Message<ImuData> original(imu_data_);
+    ASSERT_TRUE(original.extensions().add(HeaderExtensions::kDeadlineNs, uint64_t{5}));
+
+    // The header is plain data; a message rebuilt from it starts without entries
+    const Message<ImuData> rebuilt(original.header(), original.payload());
+    EXPECT_TRUE(rebuilt.extensions().empty());
+    EXPECT_EQ(rebuilt.serialized_size() + original.extensions().block_size(), original.serialized_size());
+
+    const Message<ImuData> copy = original;
+    EXPECT_EQ(copy.extensions(), original.extensions());
+}
+
+TEST_F(HeaderExtensionsTest, ViewExposesEntries) {
+    Message<ImuData> original(imu_data_);
+    original.set_checksum(true);
+    ASSERT_TRUE(original.extensions().add(HeaderExtensions::kTraceId, trace_id_));
+    const auto frame = serialize_message(original);
+
+    auto view = MessageView<ImuData>::from(frame);
+    ASSERT_TRUE(view.has_value());
+    auto trace = view->extensions().find(HeaderExtensions::kTraceId);
+    ASSERT_TRUE(trace.has_value());
+    EXPECT_TRUE(std::equal(trace->begin(), trace->end(), trace_id_.begin(), trace_id_.end()));
+    // Points into the frame rather than a copy
+    EXPECT_GE(trace->data(), frame.data());
+    EXPECT_LT(trace->data(), frame.data() + frame.size());
+    EXPECT_EQ(view->payload().sensor_id(), imu_data_.sensor_id_);
+}
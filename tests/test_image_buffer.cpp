@@ -0,0 +1,198 @@
+/**
+ * @file test_image_buffer.cpp
+ * @brief Unit tests for ImageBuffer and camera frames carrying pixels
+ * @author Jo, SeungHyeon (Jo,SH)
+ * @date 2025
+ *
+ * Focuses on:
+ * - ImageBuffer sharing bytes instead of copying them
+ * - Round-trip of frames with the attachment inline or detached
+ * - Checksums covering inline pixels
+ * - MessageView exposing inline pixels without copying
+ * - Frames with a missing or mismatched attachment
+ */
+
+#include <gtest/gtest.h>
+#include "sensorstreamkit/core/image_buffer.hpp"
+#include "sensorstreamkit/core/message.hpp"
+#include "sensorstreamkit/core/message_view.hpp"
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+#include <vector>
+
+using namespace sensorstreamkit::core;
+
+// ============================================================================
+// Test Fixture
+// ============================================================================
+
+class ImageBufferTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        pixels_.resize(64 * 48 * 3);
+        std::iota(pixels_.begin(), pixels_.end(), uint8_t{0});
+
+        camera_data_ = CameraFrameData{
+            .sensor_id_ = "camera_front",
+            .timestamp_ns_ = 1234567890,
+            .frame_id = 42,
+            .width = 64,
+            .height = 48,
+            .encoding = "RGB8",
+            .pixels = ImageBuffer(pixels_)
+        };
+    }
+
+    static bool same_bytes(std::span<const uint8_t> a, std::span<const uint8_t> b) {
+        return std::equal(a.begin(), a.end(), b.begin(), b.end());
+    }
+
+    std::vector<uint8_t> pixels_;
+    CameraFrameData camera_data_;
+};
+
+// ============================================================================
+// ImageBuffer Tests
+// ============================================================================
+
+TEST_F(ImageBufferTest, CopiesShareBytes) {
+    ImageBuffer empty;
+    EXPECT_TRUE(empty.empty());
+    EXPECT_EQ(empty.use_count(), 0);
+
+    std::vector<uint8_t> bytes(1024, 0xAB);
+    const uint8_t* storage = bytes.data();
+    ImageBuffer buffer(std::move(bytes));
+    EXPECT_EQ(buffer.data(), storage);
+    EXPECT_EQ(buffer.use_count(), 1);
+
+    {
+        ImageBuffer copy = buffer;
+        EXPECT_EQ(copy.data(), buffer.data());
+        EXPECT_EQ(buffer.use_count(), 2);
+    }
+    EXPECT_EQ(buffer.use_count(), 1);
+
+    // Copying a payload shares its pixels too
+    CameraFrameData a;
+    a.pixels = buffer;
+    CameraFrameData b = a;
+    EXPECT_EQ(b.pixels.data(), storage);
+    EXPECT_EQ(buffer.use_count(), 3);
+}
+
+TEST_F(ImageBufferTest, ForeignOwnerIsKeptAlive) {
+    auto storage = std::make_shared<std::vector<uint8_t>>(pixels_);
+    ImageBuffer buffer(storage, std::span<const uint8_t>(*storage).subspan(16, 32));
+    std::weak_ptr<std::vector<uint8_t>> watch = storage;
+    storage.reset();
+
+    EXPECT_FALSE(watch.expired());
+    EXPECT_EQ(buffer.size(), 32u);
+    EXPECT_EQ(buffer.data()[0], pixels_[16]);
+
+    buffer = ImageBuffer{};
+    EXPECT_TRUE(watch.expired());
+}
+
+// ============================================================================
+// Attachment Tests
+// ============================================================================
+
+TEST_F(ImageBufferTest, InlinePixelsRoundTrip) {
+    Message<CameraFrameData> original(camera_data_);
+    std::vector<uint8_t> buffer;
+    original.serialize(buffer);
+
+    CameraFrameData without_pixels = camera_data_;
+    without_pixels.pixels = ImageBuffer{};
+    Message<CameraFrameData> metadata_only(without_pixels);
+    EXPECT_EQ(buffer.size(), metadata_only.serialized_size() + pixels_.size() + MessageHeader::kAttachmentSizeBytes);
+
+    auto result = Message<CameraFrameData>::deserialize(buffer);
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(result->payload().encoding, camera_data_.encoding);
+    EXPECT_TRUE(same_bytes(result->payload().pixels.bytes(), pixels_));
+
+    // Attachment flags describe the frame, not the message
+    EXPECT_EQ(result->header().flags, 0u);
+    std::vector<uint8_t> again;
+    result->serialize(again);
+    EXPECT_EQ(again, buffer);
+}
+
+TEST_F(ImageBufferTest, ChecksumCoversInlinePixels) {
+    Message<CameraFrameData> original(camera_data_);
+    original.set_checksum(true);
+    std::vector<uint8_t> buffer;
+    original.serialize(buffer);
+
+    auto result = Message<CameraFrameData>::deserialize(buffer);
+    ASSERT_TRUE(result.has_value());
+    EXPECT_TRUE(same_bytes(result->payload().pixels.bytes(), pixels_));
+
+    // Corrupt one pixel, then the attachment size
+    buffer[buffer.size() - MessageHeader::kChecksumSize - MessageHeader::kAttachmentSizeBytes - 1] ^= 0x01;
+    EXPECT_FALSE(Message<CameraFrameData>::deserialize(buffer).has_value());
+    buffer[buffer.size() - MessageHeader::kChecksumSize - MessageHeader::kAttachmentSizeBytes - 1] ^= 0x01;
+    buffer[buffer.size() - MessageHeader::kChecksumSize - 1] ^= 0x01;
+    EXPECT_FALSE(Message<CameraFrameData>::deserialize(buffer).has_value());
+}
+
+TEST_F(ImageBufferTest, DetachedPixelsAreNotCopied) {
+    Message<CameraFrameData> original(camera_data_);
+    std::vector<uint8_t> buffer(original.serialized_size_detached());
+    ASSERT_EQ(original.serialize_detached_into(buffer), buffer.size());
+    EXPECT_EQ(buffer.size(), original.serialized_size() - pixels_.size());
+
+    Message<CameraFrameData> target;
+    const ImageBuffer& sent = original.payload().pixels;
+    ASSERT_TRUE(Message<CameraFrameData>::deserialize_detached_into(buffer, sent, target));
+    EXPECT_EQ(target.payload().pixels.data(), sent.data());
+    EXPECT_EQ(target.payload().frame_id, camera_data_.frame_id);
+
+    // Wrong size for the frame
+    ImageBuffer short_pixels(std::vector<uint8_t>(10));
+    EXPECT_FALSE(Message<CameraFrameData>::deserialize_detached_into(buffer, short_pixels, target));
+
+    // Without the separate part only the metadata is decoded
+    auto metadata = Message<CameraFrameData>::deserialize(buffer);
+    ASSERT_TRUE(metadata.has_value());
+    EXPECT_EQ(metadata->payload().width, camera_data_.width);
+    EXPECT_TRUE(metadata->payload().pixels.empty());
+}
+
+TEST_F(ImageBufferTest, ViewExposesInlinePixels) {
+    Message<CameraFrameData> original(camera_data_);
+    original.set_checksum(true);
+    std::vector<uint8_t> buffer;
+    original.serialize(buffer);
+
+    auto view = MessageView<CameraFrameData>::from(buffer);
+    ASSERT_TRUE(view.has_value());
+    EXPECT_EQ(view->payload().encoding(), camera_data_.encoding);
+    EXPECT_EQ(view->payload().height(), camera_data_.height);
+    ASSERT_EQ(view->attachment().size(), pixels_.size());
+    EXPECT_GE(view->attachment().data(), buffer.data());
+    EXPECT_LT(view->attachment().data(), buffer.data() + buffer.size());
+    EXPECT_TRUE(same_bytes(view->attachment(), pixels_));
+}
+
+TEST_F(ImageBufferTest, RejectsBadAttachmentSize) {
+    Message<CameraFrameData> original(camera_data_);
+    std::vector<uint8_t> buffer;
+    original.serialize(buffer);
+
+    // Claims more pixels than the frame holds
+    const uint32_t too_big = static_cast<uint32_t>(buffer.size());
+    std::memcpy(buffer.data() + buffer.size() - sizeof(too_big), &too_big, sizeof(too_big));
+    EXPECT_FALSE(Message<CameraFrameData>::deserialize(buffer).has_value());
+    EXPECT_FALSE(MessageView<CameraFrameData>::from(buffer).has_value());
+
+    // Truncated pixels
+    buffer.clear();
+    original.serialize(buffer);
+    buffer.erase(buffer.end() - 8, buffer.end() - 4);
+    EXPECT_FALSE(Message<CameraFrameData>::deserialize(buffer).has_value());
+}
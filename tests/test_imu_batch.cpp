@@ -0,0 +1,248 @@
+/**
+ * @file test_imu_batch.cpp
+ * @brief Unit tests for ImuSamples, ImuBatch and AlignedAllocator
+ * @author Jo, SeungHyeon (Jo,SH)
+ * @date 2025
+ *
+ * Focuses on:
+ * - Columns staying the same length and cache-line aligned
+ * - Round-trip of batches through Message<ImuBatch>, with and without checksum
+ * - Per-sample wire cost compared to single ImuData messages
+ * - Half precision accel and gyro columns
+ * - Dispatch of batches next to single samples
+ * - Rejection of truncated and corrupt batches
+ */
+
+#include <gtest/gtest.h>
+#include "sensorstreamkit/core/half_float.hpp"
+#include "sensorstreamkit/core/message.hpp"
+#include "sensorstreamkit/core/message_registry.hpp"
+#include "sensorstreamkit/core/timestamp_codec.hpp"
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+using namespace sensorstreamkit::core;
+
+namespace {
+
+bool cache_line_aligned(const void* ptr) {
+    return reinterpret_cast<uintptr_t>(ptr) % kCacheLineSize == 0;
+}
+
+}  // namespace
+
+// ============================================================================
+// Test Fixture
+// ============================================================================
+
+class ImuBatchTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        batch_.sensor_id_ = "imu_main";
+        for (uint32_t i = 0; i < 100; ++i) {
+            batch_.push_back(ImuData{
+                .sensor_id_ = "imu_main",
+                .timestamp_ns_ = 1'000'000'000ull + i * 1'000'000ull,
+                .accel_x = 0.01f * static_cast<float>(i),
+                .accel_y = -0.02f,
+                .accel_z = 9.81f,
+                .gyro_x = 0.001f,
+                .gyro_y = 0.002f,
+                .gyro_z = 0.003f * static_cast<float>(i)
+            });
+        }
+    }
+
+    ImuBatch batch_;
+};
+
+// ============================================================================
+// Column Tests
+// ============================================================================
+
+TEST_F(ImuBatchTest, ColumnsAreCacheLineAligned) {
+    const ImuSamples& samples = batch_.samples;
+    ASSERT_EQ(samples.size(), 100u);
+    EXPECT_TRUE(cache_line_aligned(samples.timestamp_ns().data()));
+    EXPECT_TRUE(cache_line_aligned(samples.accel_x().data()));
+    EXPECT_TRUE(cache_line_aligned(samples.accel_z().data()));
+    EXPECT_TRUE(cache_line_aligned(samples.gyro_z().data()));
+
+    AlignedVector<uint8_t> bytes(3);
+    EXPECT_TRUE(cache_line_aligned(bytes.data()));
+}
+
+TEST_F(ImuBatchTest, ColumnsStayTheSameLength) {
+    ImuSamples samples(5);
+    EXPECT_EQ(samples.gyro_y().size(), 5u);
+    samples.push_back(ImuSample{.timestamp_ns = 7, .gyro_y = 1.5f});
+    EXPECT_EQ(samples.accel_x().size(), 6u);
+    EXPECT_EQ(samples.sample(5), (ImuSample{.timestamp_ns = 7, .gyro_y = 1.5f}));
+    samples.clear();
+    EXPECT_TRUE(samples.empty());
+    EXPECT_TRUE(samples.gyro_z().empty());
+}
+
+TEST_F(ImuBatchTest, SampleRebuildsImuData) {
+    const ImuData sample = batch_.sample(42);
+    EXPECT_EQ(sample.sensor_id_, "imu_main");
+    EXPECT_EQ(sample.timestamp_ns_, 1'042'000'000ull);
+    EXPECT_FLOAT_EQ(sample.accel_x, 0.42f);
+    EXPECT_FLOAT_EQ(sample.gyro_z, 0.126f);
+    EXPECT_EQ(batch_.timestamp_ns(), 1'000'000'000ull);
+    EXPECT_EQ(ImuBatch{}.timestamp_ns(), 0u);
+}
+
+// ============================================================================
+// Serialization Tests
+// ============================================================================
+
+TEST_F(ImuBatchTest, RoundTrip) {
+    for (bool checksum : {false, true}) {
+        Message<ImuBatch> original(batch_);
+        original.set_checksum(checksum);
+        EXPECT_EQ(original.header().message_type, ImuBatch::kMessageType);
+
+        std::vector<uint8_t> buffer;
+        original.serialize(buffer);
+        ASSERT_EQ(buffer.size(), original.serialized_size());
+
+        Message<ImuBatch> target;
+        ASSERT_TRUE(Message<ImuBatch>::deserialize_into(buffer, target)) << "checksum " << checksum;
+        EXPECT_EQ(target.payload().sensor_id_, batch_.sensor_id_);
+        EXPECT_EQ(target.payload().samples, batch_.samples);
+        EXPECT_TRUE(cache_line_aligned(target.payload().samples.gyro_x().data()));
+    }
+}
+
+TEST_F(ImuBatchTest, SizingOneBatchDoesNotPlanAnother) {
+    // Same count, but timestamps too irregular for the steady batch's residual width
+    ImuBatch jittery = batch_;
+    for (size_t i = 0; i < jittery.samples.size(); ++i) {
+        jittery.samples.timestamp_ns()[i] += (i % 2) * 5'000'000'000ull;
+    }
+
+    Message<ImuBatch> steady(batch_);
+    Message<ImuBatch> original(jittery);
+    const size_t steady_size = steady.serialized_size();
+    EXPECT_LT(steady_size, original.serialized_size());
+
+    std::vector<uint8_t> buffer;
+    original.serialize(buffer);
+    ASSERT_EQ(buffer.size(), original.serialized_size());
+    auto target = Message<ImuBatch>::deserialize(buffer);
+    ASSERT_TRUE(target.has_value());
+    EXPECT_EQ(target->payload().samples, jittery.samples);
+
+    std::vector<uint8_t> steady_buffer;
+    steady.serialize(steady_buffer);
+    EXPECT_EQ(steady_buffer.size(), steady_size);
+}
+
+TEST_F(ImuBatchTest, WriteFitsTimestampsEditedAfterSizing) {
+    ImuSamples& samples = batch_.samples;
+    const size_t size = FieldCodec<ImuSamples>::size(samples);
+
+    // Same count and spacing, so the same size, but another base; write()
+    // must not reuse anything fitted by the size() call above
+    for (uint64_t& timestamp : samples.timestamp_ns()) {
+        timestamp += 7'000'000'000ull;
+    }
+
+    std::vector<uint8_t> buffer(size);
+    ASSERT_EQ(FieldCodec<ImuSamples>::write(buffer.data(), samples), buffer.data() + size);
+    size_t offset = 0;
+    ImuSamples target;
+    ASSERT_TRUE(FieldCodec<ImuSamples>::read(buffer, offset, target));
+    EXPECT_EQ(target, samples);
+}
+
+TEST_F(ImuBatchTest, WritesWithThePlanMadeWhenSizing) {
+    const auto plan = serialization::plan(batch_);
+    EXPECT_EQ(plan.size, serialization::serialized_size(batch_));
+
+    std::vector<uint8_t> planned(plan.size);
+    std::vector<uint8_t> refitted(plan.size);
+    ASSERT_EQ(serialization::write_unchecked(batch_, planned.data(), plan), planned.data() + plan.size);
+    ASSERT_EQ(serialization::write_unchecked(batch_, refitted.data()), refitted.data() + plan.size);
+    EXPECT_EQ(planned, refitted);
+}
+
+TEST_F(ImuBatchTest, CheaperPerSampleThanSingleMessages) {
+    std::vector<uint8_t> batch_frame;
+    Message<ImuBatch>(batch_).serialize(batch_frame);
+
+    size_t single_bytes = 0;
+    for (size_t i = 0; i < batch_.samples.size(); ++i) {
+        single_bytes += Message<ImuData>(batch_.sample(i)).serialized_size();
+    }
+
+    // One header and one sensor id for the whole batch, and the regular
+    // 1 ms timestamps reduce to base and period
+    EXPECT_EQ(batch_frame.size(), MessageHeader::serialized_size() + sizeof(uint32_t) + batch_.sensor_id_.size() +
+                                      sizeof(uint32_t) + timestamp_codec::Plan::kHeaderBytes + sizeof(uint8_t) +
+                                      batch_.samples.size() * ImuSamples::kFloatBytes);
+    EXPECT_LT(batch_frame.size() * 3, single_bytes * 2);
+}
+
+TEST_F(ImuBatchTest, HalfPrecisionRoundTrip) {
+    const size_t full_size = Message<ImuBatch>(batch_).serialized_size();
+    batch_.samples.set_half_precision(true);
+    Message<ImuBatch> original(batch_);
+
+    std::vector<uint8_t> buffer;
+    original.serialize(buffer);
+    ASSERT_EQ(buffer.size(), original.serialized_size());
+    EXPECT_EQ(full_size - buffer.size(), batch_.samples.size() * (ImuSamples::kFloatBytes - ImuSamples::kHalfBytes));
+
+    Message<ImuBatch> target;
+    ASSERT_TRUE(Message<ImuBatch>::deserialize_into(buffer, target));
+    const ImuSamples& samples = target.payload().samples;
+    EXPECT_TRUE(samples.half_precision());
+    ASSERT_EQ(samples.size(), batch_.samples.size());
+    for (size_t i = 0; i < samples.size(); ++i) {
+        const ImuSample expected = batch_.samples.sample(i);
+        const ImuSample actual = samples.sample(i);
+        EXPECT_EQ(actual.timestamp_ns, expected.timestamp_ns);
+        // 11 significant bits: relative error at most 2^-11
+        EXPECT_NEAR(actual.accel_x, expected.accel_x, std::abs(expected.accel_x) / 2048.0f);
+        EXPECT_NEAR(actual.accel_z, expected.accel_z, std::abs(expected.accel_z) / 2048.0f);
+        EXPECT_NEAR(actual.gyro_z, expected.gyro_z, std::abs(expected.gyro_z) / 2048.0f);
+        EXPECT_EQ(actual.accel_y, half_float::to_float(half_float::from_float(expected.accel_y)));
+    }
+
+    // Mode byte other than 0 or 1
+    const size_t mode_offset = MessageHeader::serialized_size() + sizeof(uint32_t) + batch_.sensor_id_.size() +
+                               sizeof(uint32_t) + timestamp_codec::Plan::kHeaderBytes;
+    buffer[mode_offset] = 2;
+    EXPECT_FALSE(Message<ImuBatch>::deserialize(buffer).has_value());
+}
+
+TEST_F(ImuBatchTest, DispatchesNextToSingleSamples) {
+    std::vector<uint8_t> batch_frame;
+    Message<ImuBatch>(batch_).serialize(batch_frame);
+    std::vector<uint8_t> single_frame;
+    Message<ImuData>(batch_.sample(0)).serialize(single_frame);
+
+    size_t samples = 0;
+    auto on_single = [&](const Message<ImuData>&) { ++samples; };
+    auto on_batch = [&](const Message<ImuBatch>& msg) { samples += msg.payload().samples.size(); };
+
+    EXPECT_TRUE(dispatch(batch_frame, on_single, on_batch));
+    EXPECT_TRUE(dispatch(single_frame, on_single, on_batch));
+    EXPECT_EQ(samples, 101u);
+}
+
+TEST_F(ImuBatchTest, RejectsTruncatedAndCorruptBatches) {
+    std::vector<uint8_t> buffer;
+    Message<ImuBatch>(batch_).serialize(buffer);
+
+    EXPECT_FALSE(Message<ImuBatch>::deserialize(ConstPayload(buffer).first(buffer.size() - 1)).has_value());
+
+    // Count claiming more samples than the frame holds
+    const size_t count_offset = MessageHeader::serialized_size() + sizeof(uint32_t) + batch_.sensor_id_.size();
+    const uint32_t huge = 0xFFFFFFFFu;
+    std::memcpy(buffer.data() + count_offset, &huge, sizeof(huge));
+    EXPECT_FALSE(Message<ImuBatch>::deserialize(buffer).has_value());
+}
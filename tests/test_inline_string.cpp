@@ -0,0 +1,214 @@
+/**
+ * @file test_inline_string.cpp
+ * @brief Unit tests for InlineString and block-copied payloads
+ * @author Jo, SeungHyeon (Jo,SH)
+ * @date 2025
+ *
+ * Focuses on:
+ * - InlineString contents, comparison and overlong input
+ * - Payloads with an InlineString id being trivially copyable
+ * - Block copy producing the same bytes as the field-by-field path
+ * - Fallback to the field path when fields() is not in declaration order
+ * - Rejection of truncated frames and clamping of corrupt sizes
+ */
+
+#include <gtest/gtest.h>
+#include "sensorstreamkit/core/message.hpp"
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace sensorstreamkit::core;
+
+namespace {
+
+/**
+ * @brief ImuData with its id stored inline: 64 bytes, no padding
+ */
+struct CompactImuData {
+    InlineString<31> sensor_id_;
+    uint64_t timestamp_ns_{0};
+    float accel_x{0.0f};
+    float accel_y{0.0f};
+    float accel_z{0.0f};
+    float gyro_x{0.0f};
+    float gyro_y{0.0f};
+    float gyro_z{0.0f};
+
+    static constexpr uint16_t kMessageType = 101;
+
+    static constexpr auto fields() noexcept {
+        return std::tuple{field<&CompactImuData::sensor_id_>, field<&CompactImuData::timestamp_ns_>,
+                          field<&CompactImuData::accel_x>, field<&CompactImuData::accel_y>,
+                          field<&CompactImuData::accel_z>, field<&CompactImuData::gyro_x>,
+                          field<&CompactImuData::gyro_y>, field<&CompactImuData::gyro_z>};
+    }
+
+    [[nodiscard]] uint64_t timestamp_ns() const noexcept { return timestamp_ns_; }
+    [[nodiscard]] std::string_view sensor_id() const noexcept { return sensor_id_; }
+
+    [[nodiscard]] size_t serialized_size() const noexcept { return serialization::serialized_size(*this); }
+    void serialize(std::vector<uint8_t>& buffer) const {
+        const size_t offset = buffer.size();
+        buffer.resize(offset + serialized_size());
+        serialize_into(MutablePayload(buffer).subspan(offset));
+    }
+    size_t serialize_into(MutablePayload out) const noexcept { return serialization::serialize_into(*this, out); }
+    static std::optional<CompactImuData> deserialize(ConstPayload data) {
+        return serialization::deserialize<CompactImuData>(data);
+    }
+    static bool deserialize_into(ConstPayload data, CompactImuData& out) {
+        return serialization::deserialize_into(data, out);
+    }
+
+    bool operator==(const CompactImuData&) const = default;
+};
+
+/**
+ * @brief Same members, but fields() puts the timestamp first
+ */
+struct ReorderedImuData : CompactImuData {
+    static constexpr auto fields() noexcept {
+        return std::tuple{field<&ReorderedImuData::timestamp_ns_>, field<&ReorderedImuData::sensor_id_>,
+                          field<&ReorderedImuData::accel_x>, field<&ReorderedImuData::accel_y>,
+                          field<&ReorderedImuData::accel_z>, field<&ReorderedImuData::gyro_x>,
+                          field<&ReorderedImuData::gyro_y>, field<&ReorderedImuData::gyro_z>};
+    }
+
+    size_t serialize_into(MutablePayload out) const noexcept { return serialization::serialize_into(*this, out); }
+    static std::optional<ReorderedImuData> deserialize(ConstPayload data) {
+        return serialization::deserialize<ReorderedImuData>(data);
+    }
+    static bool deserialize_into(ConstPayload data, ReorderedImuData& out) {
+        return serialization::deserialize_into(data, out);
+    }
+};
+
+static_assert(std::is_trivially_copyable_v<InlineString<31>>);
+static_assert(sizeof(InlineString<31>) == 32);
+static_assert(FieldCodec<InlineString<31>>::fixed_size == 32);
+static_assert(std::is_trivially_copyable_v<CompactImuData>);
+static_assert(BlockCopyable<CompactImuData>);
+static_assert(sizeof(CompactImuData) == 64);
+static_assert(!BlockCopyable<ImuData>);
+static_assert(InlineString<8>("imu") == "imu");
+
+}  // namespace
+
+// ============================================================================
+// Test Fixture
+// ============================================================================
+
+class InlineStringTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        data_.sensor_id_ = "vehicle_07/imu_front_left";
+        data_.timestamp_ns_ = 1'234'567'890ull;
+        data_.accel_x = 0.1f;
+        data_.accel_z = 9.81f;
+        data_.gyro_y = -0.02f;
+    }
+
+    CompactImuData data_;
+};
+
+// ============================================================================
+// InlineString Tests
+// ============================================================================
+
+TEST_F(InlineStringTest, HoldsAndComparesContents) {
+    InlineString<16> id = "lidar_top";
+    EXPECT_EQ(id.size(), 9u);
+    EXPECT_EQ(id.view(), "lidar_top");
+    EXPECT_TRUE(id == "lidar_top");
+    EXPECT_TRUE(id == std::string("lidar_top"));
+    EXPECT_FALSE(id == "lidar");
+    EXPECT_EQ(id, InlineString<16>("lidar_top"));
+    EXPECT_EQ(InlineString<16>::capacity(), 16u);
+    EXPECT_TRUE(InlineString<4>{}.empty());
+}
+
+TEST_F(InlineStringTest, OverlongValues) {
+    InlineString<4> id = "cam";
+    EXPECT_FALSE(id.assign("camera"));
+    EXPECT_EQ(id, "cam");
+    EXPECT_TRUE(id.assign("cam1"));
+    EXPECT_EQ(id, "cam1");
+
+    // The string_view constructor keeps the first N characters
+    EXPECT_EQ(InlineString<4>(std::string_view("camera")), "came");
+}
+
+TEST_F(InlineStringTest, ShorterValueClearsTail) {
+    InlineString<8> a = "abcdefgh";
+    a.assign("ab");
+    const InlineString<8> b = "ab";
+    // Same contents, same bytes: the wire form does not leak old characters
+    EXPECT_EQ(std::memcmp(&a, &b, sizeof(a)), 0);
+}
+
+// ============================================================================
+// Block Copy Tests
+// ============================================================================
+
+TEST_F(InlineStringTest, BlockCopyMatchesFieldPath) {
+    Message<CompactImuData> message(data_);
+    std::vector<uint8_t> frame;
+    message.serialize(frame);
+    ASSERT_EQ(frame.size(), MessageHeader::serialized_size() + sizeof(CompactImuData));
+
+    // What the generated field-by-field writer produces for the same payload
+    std::vector<uint8_t> fields(sizeof(CompactImuData));
+    ASSERT_EQ(serialization::serialize_into(data_, fields), fields.size());
+    EXPECT_TRUE(std::equal(fields.begin(), fields.end(), frame.begin() + MessageHeader::serialized_size()));
+}
+
+TEST_F(InlineStringTest, RoundTrip) {
+    for (bool checksum : {false, true}) {
+        Message<CompactImuData> original(data_);
+        original.set_checksum(checksum);
+        std::vector<uint8_t> frame;
+        original.serialize(frame);
+        ASSERT_EQ(frame.size(), original.serialized_size());
+
+        Message<CompactImuData> target;
+        ASSERT_TRUE(Message<CompactImuData>::deserialize_into(frame, target)) << "checksum " << checksum;
+        EXPECT_EQ(target.payload(), data_);
+        EXPECT_EQ(target.payload().sensor_id(), "vehicle_07/imu_front_left");
+        EXPECT_EQ(target.header().sequence_number, original.header().sequence_number);
+    }
+}
+
+TEST_F(InlineStringTest, ReorderedFieldsUseFieldPath) {
+    ReorderedImuData reordered;
+    static_cast<CompactImuData&>(reordered) = data_;
+    EXPECT_FALSE(serialization::is_block_layout(reordered));
+    EXPECT_TRUE(serialization::is_block_layout(data_));
+
+    std::vector<uint8_t> frame;
+    Message<ReorderedImuData>(reordered).serialize(frame);
+    uint64_t first_field;
+    std::memcpy(&first_field, frame.data() + MessageHeader::serialized_size(), sizeof(first_field));
+    EXPECT_EQ(first_field, data_.timestamp_ns_);
+
+    auto decoded = Message<ReorderedImuData>::deserialize(frame);
+    ASSERT_TRUE(decoded.has_value());
+    EXPECT_EQ(static_cast<const CompactImuData&>(decoded->payload()), data_);
+}
+
+TEST_F(InlineStringTest, RejectsTruncatedFramesAndClampsSize) {
+    for (bool checksum : {false, true}) {
+        Message<CompactImuData> original(data_);
+        original.set_checksum(checksum);
+        std::vector<uint8_t> frame;
+        original.serialize(frame);
+        EXPECT_FALSE(Message<CompactImuData>::deserialize(ConstPayload(frame).first(frame.size() - 1)).has_value());
+    }
+
+    std::vector<uint8_t> frame;
+    Message<CompactImuData>(data_).serialize(frame);
+    frame[MessageHeader::serialized_size()] = 0xFF;  // Id size byte
+    auto decoded = Message<CompactImuData>::deserialize(frame);
+    ASSERT_TRUE(decoded.has_value());
+    EXPECT_EQ(decoded->payload().sensor_id_.size(), 31u);
+}
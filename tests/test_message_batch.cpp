@@ -0,0 +1,196 @@
+/**
+ * @file test_message_batch.cpp
+ * @brief Unit tests for decoding into memory resources and MessageBatch
+ * @author Jo, SeungHyeon (Jo,SH)
+ * @date 2025
+ *
+ * Focuses on:
+ * - deserialize() placing payload strings in the given resource
+ * - Copies leaving the arena, moves staying in it
+ * - bind_resource() touching only allocator-aware fields
+ * - MessageBatch appending, rejecting bad frames, and rewinding its arena
+ * - MessageBatch reusing its messages' point cloud columns across batches
+ */
+
+#include <gtest/gtest.h>
+#include "sensorstreamkit/core/message_batch.hpp"
+#include <array>
+#include <cstddef>
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+using namespace sensorstreamkit::core;
+
+// ============================================================================
+// Test Fixture
+// ============================================================================
+
+class MessageBatchTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        imu_data_.sensor_id_ = "vehicle_07/imu_front_left_with_a_long_name";
+        imu_data_.timestamp_ns_ = 1'234'567'890ull;
+        imu_data_.accel_z = 9.81f;
+        imu_data_.gyro_y = -0.02f;
+        Message<ImuData>(imu_data_).serialize(frame_);
+    }
+
+    // True if str's characters live inside buffer
+    template <size_t N>
+    static bool in_buffer(const std::pmr::string& str, const std::array<std::byte, N>& buffer) {
+        const auto* chars = reinterpret_cast<const std::byte*>(str.data());
+        return chars >= buffer.data() && chars < buffer.data() + buffer.size();
+    }
+
+    ImuData imu_data_;
+    std::vector<uint8_t> frame_;
+};
+
+// ============================================================================
+// Memory Resource Tests
+// ============================================================================
+
+TEST_F(MessageBatchTest, DeserializeIntoResource) {
+    alignas(std::max_align_t) std::array<std::byte, 1024> buffer;
+    std::pmr::monotonic_buffer_resource arena(buffer.data(), buffer.size(), std::pmr::null_memory_resource());
+
+    auto decoded = Message<ImuData>::deserialize(frame_, &arena);
+    ASSERT_TRUE(decoded.has_value());
+    EXPECT_EQ(decoded->payload().sensor_id_, imu_data_.sensor_id_);
+    EXPECT_EQ(decoded->payload().timestamp_ns_, imu_data_.timestamp_ns_);
+    EXPECT_FLOAT_EQ(decoded->payload().accel_z, imu_data_.accel_z);
+    EXPECT_EQ(decoded->payload().sensor_id_.get_allocator().resource(), &arena);
+    EXPECT_TRUE(in_buffer(decoded->payload().sensor_id_, buffer));
+
+    EXPECT_FALSE(Message<ImuData>::deserialize(ConstPayload(frame_).first(10), &arena).has_value());
+}
+
+TEST_F(MessageBatchTest, InternedStringsIntoResource) {
+    StringRegistry strings;
+    ASSERT_TRUE(strings.intern(imu_data_.sensor_id_));
+    Message<ImuData> original(imu_data_);
+    std::vector<uint8_t> frame(original.serialized_size(strings));
+    original.serialize_into(frame, strings);
+
+    alignas(std::max_align_t) std::array<std::byte, 1024> buffer;
+    std::pmr::monotonic_buffer_resource arena(buffer.data(), buffer.size(), std::pmr::null_memory_resource());
+    auto decoded = Message<ImuData>::deserialize(frame, &arena, &strings);
+    ASSERT_TRUE(decoded.has_value());
+    EXPECT_EQ(decoded->payload().sensor_id_, imu_data_.sensor_id_);
+    EXPECT_TRUE(in_buffer(decoded->payload().sensor_id_, buffer));
+}
+
+TEST_F(MessageBatchTest, CopyLeavesArenaMoveStays) {
+    alignas(std::max_align_t) std::array<std::byte, 1024> buffer;
+    std::pmr::monotonic_buffer_resource arena(buffer.data(), buffer.size(), std::pmr::null_memory_resource());
+    auto decoded = Message<ImuData>::deserialize(frame_, &arena);
+    ASSERT_TRUE(decoded.has_value());
+
+    const Message<ImuData> copy = *decoded;
+    EXPECT_EQ(copy.payload().sensor_id_, imu_data_.sensor_id_);
+    EXPECT_EQ(copy.payload().sensor_id_.get_allocator().resource(), std::pmr::get_default_resource());
+
+    const Message<ImuData> moved = std::move(*decoded);
+    EXPECT_EQ(moved.payload().sensor_id_.get_allocator().resource(), &arena);
+    EXPECT_TRUE(in_buffer(moved.payload().sensor_id_, buffer));
+}
+
+TEST_F(MessageBatchTest, BindResourceResetsOnlyAllocatorAwareFields) {
+    std::pmr::monotonic_buffer_resource arena;
+    ImuData data = imu_data_;
+    serialization::bind_resource(data, &arena);
+
+    EXPECT_TRUE(data.sensor_id_.empty());
+    EXPECT_EQ(data.sensor_id_.get_allocator().resource(), &arena);
+    EXPECT_EQ(data.timestamp_ns_, imu_data_.timestamp_ns_);
+    EXPECT_FLOAT_EQ(data.accel_z, imu_data_.accel_z);
+
+    // Assignment keeps the bound resource
+    data.sensor_id_ = imu_data_.sensor_id_;
+    EXPECT_EQ(data.sensor_id_.get_allocator().resource(), &arena);
+}
+
+// ============================================================================
+// MessageBatch Tests
+// ============================================================================
+
+TEST_F(MessageBatchTest, AppendAndIterate) {
+    MessageBatch<ImuData> batch;
+    EXPECT_TRUE(batch.empty());
+    for (int i = 0; i < 3; ++i) {
+        ASSERT_TRUE(batch.append(frame_));
+    }
+    ASSERT_EQ(batch.size(), 3u);
+
+    size_t count = 0;
+    for (const auto& msg : batch) {
+        EXPECT_EQ(msg.payload().sensor_id_, imu_data_.sensor_id_);
+        EXPECT_EQ(msg.payload().sensor_id_.get_allocator().resource(), batch.resource());
+        ++count;
+    }
+    EXPECT_EQ(count, 3u);
+}
+
+TEST_F(MessageBatchTest, AppendRejectsInvalidFrame) {
+    MessageBatch<ImuData> batch;
+    ASSERT_TRUE(batch.append(frame_));
+    EXPECT_FALSE(batch.append(ConstPayload(frame_).first(frame_.size() - 1)));
+    EXPECT_EQ(batch.size(), 1u);
+}
+
+TEST_F(MessageBatchTest, ClearRewindsArena) {
+    MessageBatch<ImuData> batch;
+    ASSERT_TRUE(batch.append(frame_));
+    const char* first = batch[0].payload().sensor_id_.data();
+
+    batch.clear();
+    EXPECT_TRUE(batch.empty());
+    ASSERT_TRUE(batch.append(frame_));
+    // The next batch reuses the same bytes of the initial buffer
+    EXPECT_EQ(batch[0].payload().sensor_id_.data(), first);
+}
+
+TEST_F(MessageBatchTest, GrowsPastInitialBuffer) {
+    constexpr size_t kArenaBytes = 128;
+    MessageBatch<ImuData> batch(kArenaBytes, 4);
+    for (int i = 0; i < 16; ++i) {
+        ASSERT_TRUE(batch.append(frame_));
+    }
+    // Growing the vector moves messages, which keeps their strings in the arena
+    ASSERT_EQ(batch.size(), 16u);
+    for (const auto& msg : batch) {
+        EXPECT_EQ(msg.payload().sensor_id_, imu_data_.sensor_id_);
+        EXPECT_EQ(msg.payload().sensor_id_.get_allocator().resource(), batch.resource());
+    }
+
+    // Extra blocks go back upstream; the next batch starts in the initial buffer
+    const char* first = batch[0].payload().sensor_id_.data();
+    batch.clear();
+    ASSERT_TRUE(batch.append(frame_));
+    EXPECT_EQ(batch[0].payload().sensor_id_.data(), first);
+}
+
+TEST_F(MessageBatchTest, ClearKeepsPointCloudColumns) {
+    LidarScanData scan;
+    scan.sensor_id_ = "vehicle_07/lidar_roof_with_a_long_name";
+    for (int i = 0; i < 256; ++i) {
+        scan.points.push_back({.x = static_cast<float>(i), .y = 1.0f, .z = 2.0f});
+    }
+    std::vector<uint8_t> frame;
+    Message<LidarScanData>(scan).serialize(frame);
+
+    MessageBatch<LidarScanData> batch;
+    ASSERT_TRUE(batch.append(frame));
+    const float* column = batch[0].payload().points.x().data();
+
+    batch.clear();
+    EXPECT_TRUE(batch.empty());
+    EXPECT_TRUE(batch[0].payload().sensor_id_.empty());
+    ASSERT_TRUE(batch.append(frame));
+    // The message is reused, so the next batch decodes into the same column
+    EXPECT_EQ(batch[0].payload().points.x().data(), column);
+    EXPECT_EQ(batch[0].payload().points, scan.points);
+    EXPECT_EQ(batch[0].payload().sensor_id_, scan.sensor_id_);
+    EXPECT_EQ(batch[0].payload().sensor_id_.get_allocator().resource(), batch.resource());
+}
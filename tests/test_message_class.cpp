@@ -86,8 +86,8 @@ TEST_F(MessageCameraTest, DefaultConstructor) {
     // Header should be default-initialized
     EXPECT_EQ(msg.header().timestamp_ns, 0);
     EXPECT_EQ(msg.header().sequence_number, 0);
-    EXPECT_EQ(msg.header().message_type, 0);
-    EXPECT_EQ(msg.header().reserved, 0);
+    EXPECT_EQ(msg.header().message_type, CameraFrameData::kMessageType);
+    EXPECT_EQ(msg.header().flags, 0);
 
     // Payload should be default-constructed
     EXPECT_EQ(msg.payload().sensor_id_, "");
@@ -273,7 +273,7 @@ TEST_F(MessageCameraTest, SerializeBasic) {
     EXPECT_GT(buffer.size(), 0);
 
     // Should at least contain header
-    EXPECT_GE(buffer.size(), MessageHeader::serialized_size);
+    EXPECT_GE(buffer.size(), MessageHeader::serialized_size());
 }
 
 TEST_F(MessageCameraTest, SerializeToEmptyBuffer) {
@@ -312,7 +312,7 @@ TEST_F(MessageImuTest, SerializeImuData) {
 
     msg.serialize(buffer);
 
-    EXPECT_GT(buffer.size(), MessageHeader::serialized_size);
+    EXPECT_GT(buffer.size(), MessageHeader::serialized_size());
 }
 
 TEST_F(MessageLidarTest, SerializeLidarData) {
@@ -321,7 +321,91 @@ TEST_F(MessageLidarTest, SerializeLidarData) {
 
     msg.serialize(buffer);
 
-    EXPECT_GT(buffer.size(), MessageHeader::serialized_size);
+    EXPECT_GT(buffer.size(), MessageHeader::serialized_size());
+}
+
+// ============================================================================
+// Serialization Tests - serialized_size() / serialize_into()
+// ============================================================================
+
+static_assert(MessageHeader::serialized_size() == 16, "header size must be a compile-time constant");
+
+TEST_F(MessageCameraTest, SerializedSizeMatchesSerialize) {
+    Message<CameraFrameData> msg(sample_camera_data_);
+    std::vector<uint8_t> buffer;
+
+    msg.serialize(buffer);
+
+    EXPECT_EQ(buffer.size(), msg.serialized_size());
+    EXPECT_EQ(msg.serialized_size(),
+              MessageHeader::serialized_size() + msg.payload().serialized_size());
+}
+
+TEST_F(MessageLidarTest, SerializedSizeMatchesSerializeLidar) {
+    Message<LidarScanData> msg(sample_lidar_data_);
+    std::vector<uint8_t> buffer;
+
+    msg.serialize(buffer);
+
+    EXPECT_EQ(buffer.size(), msg.serialized_size());
+}
+
+TEST_F(MessageImuTest, SerializedSizeMatchesSerializeImu) {
+    Message<ImuData> msg(sample_imu_data_);
+    std::vector<uint8_t> buffer;
+
+    msg.serialize(buffer);
+
+    EXPECT_EQ(buffer.size(), msg.serialized_size());
+}
+
+TEST_F(MessageCameraTest, SerializeIntoMatchesSerialize) {
+    Message<CameraFrameData> msg(sample_camera_data_);
+    std::vector<uint8_t> expected;
+    msg.serialize(expected);
+
+    std::vector<uint8_t> out(msg.serialized_size());
+    EXPECT_EQ(msg.serialize_into(out), out.size());
+    EXPECT_EQ(out, expected);
+}
+
+TEST_F(MessageImuTest, SerializeIntoAlignedBuffer) {
+    Message<ImuData> msg(sample_imu_data_);
+    std::vector<uint8_t> expected;
+    msg.serialize(expected);
+
+    AlignedBuffer aligned;
+    msg.serialize(aligned);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(aligned.data()) % kCacheLineSize, 0u);
+    ASSERT_EQ(aligned.size(), expected.size());
+    EXPECT_TRUE(std::equal(aligned.begin(), aligned.end(), expected.begin()));
+
+    auto decoded = Message<ImuData>::deserialize(aligned);
+    ASSERT_TRUE(decoded.has_value());
+    EXPECT_EQ(decoded->payload().sensor_id_, sample_imu_data_.sensor_id_);
+}
+
+TEST_F(MessageImuTest, SerializeIntoLargerBufferLeavesTailUntouched) {
+    Message<ImuData> msg(sample_imu_data_);
+
+    std::vector<uint8_t> out(msg.serialized_size() + 4, 0xEE);
+    ASSERT_EQ(msg.serialize_into(out), msg.serialized_size());
+
+    for (size_t i = msg.serialized_size(); i < out.size(); ++i) {
+        EXPECT_EQ(out[i], 0xEE);
+    }
+
+    auto result = Message<ImuData>::deserialize(out);
+    ASSERT_TRUE(result.has_value());
+    EXPECT_FLOAT_EQ(result->payload().accel_z, sample_imu_data_.accel_z);
+}
+
+TEST_F(MessageCameraTest, SerializeIntoTooSmallWritesNothing) {
+    Message<CameraFrameData> msg(sample_camera_data_);
+
+    std::vector<uint8_t> out(msg.serialized_size() - 1, 0xEE);
+    EXPECT_EQ(msg.serialize_into(out), 0u);
+    EXPECT_TRUE(std::all_of(out.begin(), out.end(), [](uint8_t b) { return b == 0xEE; }));
 }
 
 // ============================================================================
@@ -337,7 +421,7 @@ TEST_F(MessageCameraTest, DeserializeEmptyData) {
 }
 
 TEST_F(MessageCameraTest, DeserializeTooSmall) {
-    std::vector<uint8_t> tiny_buffer(MessageHeader::serialized_size - 1);
+    std::vector<uint8_t> tiny_buffer(MessageHeader::serialized_size() - 1);
 
     auto result = Message<CameraFrameData>::deserialize(tiny_buffer);
 
@@ -345,7 +429,7 @@ TEST_F(MessageCameraTest, DeserializeTooSmall) {
 }
 
 TEST_F(MessageCameraTest, DeserializeHeaderOnly) {
-    std::vector<uint8_t> buffer(MessageHeader::serialized_size);
+    std::vector<uint8_t> buffer(MessageHeader::serialized_size());
 
     auto result = Message<CameraFrameData>::deserialize(buffer);
 
@@ -369,7 +453,7 @@ TEST_F(MessageCameraTest, SerializeDeserializeRoundTrip) {
     EXPECT_EQ(result->header().timestamp_ns, original.header().timestamp_ns);
     EXPECT_EQ(result->header().sequence_number, original.header().sequence_number);
     EXPECT_EQ(result->header().message_type, original.header().message_type);
-    EXPECT_EQ(result->header().reserved, original.header().reserved);
+    EXPECT_EQ(result->header().flags, original.header().flags);
 
     // Verify payload matches
     EXPECT_EQ(result->payload().sensor_id_, original.payload().sensor_id_);
@@ -413,6 +497,67 @@ TEST_F(MessageLidarTest, SerializeDeserializeRoundTripLidar) {
     EXPECT_FLOAT_EQ(result->payload().scan_duration_ms, original.payload().scan_duration_ms);
 }
 
+// ============================================================================
+// In-Place Deserialization Tests - deserialize_into()
+// ============================================================================
+
+TEST_F(MessageCameraTest, DeserializeIntoOverwritesExistingMessage) {
+    Message<CameraFrameData> original(sample_camera_data_);
+    std::vector<uint8_t> buffer;
+    original.serialize(buffer);
+
+    Message<CameraFrameData> target(CameraFrameData{
+        .sensor_id_ = "stale_sensor_id_that_is_longer_than_sso",
+        .timestamp_ns_ = 1,
+        .frame_id = 2,
+        .width = 3,
+        .height = 4,
+        .encoding = "stale_encoding_that_is_longer_than_sso"
+    });
+
+    ASSERT_TRUE(Message<CameraFrameData>::deserialize_into(buffer, target));
+
+    EXPECT_EQ(target.header().timestamp_ns, original.header().timestamp_ns);
+    EXPECT_EQ(target.header().sequence_number, original.header().sequence_number);
+    EXPECT_EQ(target.payload().sensor_id_, original.payload().sensor_id_);
+    EXPECT_EQ(target.payload().timestamp_ns_, original.payload().timestamp_ns_);
+    EXPECT_EQ(target.payload().frame_id, original.payload().frame_id);
+    EXPECT_EQ(target.payload().width, original.payload().width);
+    EXPECT_EQ(target.payload().height, original.payload().height);
+    EXPECT_EQ(target.payload().encoding, original.payload().encoding);
+}
+
+TEST_F(MessageImuTest, DeserializeIntoReusesStringCapacity) {
+    Message<ImuData> original(sample_imu_data_);
+    std::vector<uint8_t> buffer;
+    original.serialize(buffer);
+
+    // Pre-grow the string so the decoded id fits without reallocating
+    Message<ImuData> target;
+    target.payload().sensor_id_.reserve(128);
+    const char* storage = target.payload().sensor_id_.data();
+
+    for (int i = 0; i < 3; ++i) {
+        ASSERT_TRUE(Message<ImuData>::deserialize_into(buffer, target));
+        EXPECT_EQ(target.payload().sensor_id_.data(), storage);
+    }
+    EXPECT_EQ(target.payload().sensor_id_, original.payload().sensor_id_);
+    EXPECT_FLOAT_EQ(target.payload().gyro_z, original.payload().gyro_z);
+}
+
+TEST_F(MessageCameraTest, DeserializeIntoRejectsTruncatedData) {
+    Message<CameraFrameData> original(sample_camera_data_);
+    std::vector<uint8_t> buffer;
+    original.serialize(buffer);
+
+    Message<CameraFrameData> target;
+    const std::span<const uint8_t> full(buffer);
+    EXPECT_FALSE(Message<CameraFrameData>::deserialize_into(full.first(MessageHeader::serialized_size() - 1), target));
+    EXPECT_FALSE(Message<CameraFrameData>::deserialize_into(full.first(MessageHeader::serialized_size()), target));
+    EXPECT_FALSE(Message<CameraFrameData>::deserialize_into(full.first(buffer.size() - 1), target));
+    EXPECT_TRUE(Message<CameraFrameData>::deserialize_into(full, target));
+}
+
 // ============================================================================
 // Edge Case Tests
 // ============================================================================
@@ -440,8 +585,8 @@ TEST_F(MessageCameraTest, EmptyStringsInPayload) {
 }
 
 TEST_F(MessageCameraTest, VeryLongStringsInPayload) {
-    std::string long_id(10000, 'A');
-    std::string long_encoding(5000, 'B');
+    std::pmr::string long_id(10000, 'A');
+    std::pmr::string long_encoding(5000, 'B');
 
     CameraFrameData long_strings{
         .sensor_id_ = long_id,
@@ -546,7 +691,7 @@ TEST_F(MessageCameraTest, CopyAssignment) {
 TEST_F(MessageCameraTest, MoveConstructor) {
     Message<CameraFrameData> original(sample_camera_data_);
     uint64_t original_timestamp = original.header().timestamp_ns;
-    std::string original_id = original.payload().sensor_id_;
+    std::pmr::string original_id = original.payload().sensor_id_;
 
     Message<CameraFrameData> moved(std::move(original));
 
@@ -557,7 +702,7 @@ TEST_F(MessageCameraTest, MoveConstructor) {
 TEST_F(MessageCameraTest, MoveAssignment) {
     Message<CameraFrameData> original(sample_camera_data_);
     uint64_t original_timestamp = original.header().timestamp_ns;
-    std::string original_id = original.payload().sensor_id_;
+    std::pmr::string original_id = original.payload().sensor_id_;
 
     Message<CameraFrameData> moved;
     moved = std::move(original);
@@ -0,0 +1,216 @@
+/**
+ * @file test_message_codec.cpp
+ * @brief Unit tests for the Codec parameter of Message<T, Codec>
+ * @author Jo, SeungHyeon (Jo,SH)
+ * @date 2025
+ *
+ * Focuses on:
+ * - NativeCodec being the default and producing the existing frames
+ * - FlatBufferCodec as a Message codec, matching FlatBufferCodec::encode()
+ * - FlatBufferCodec reusing a sized build only for the message it sized
+ * - FlatBufferCodec decoding in place into an existing message
+ * - HalfImuCodec as a compact codec for single IMU messages
+ * - Sequence numbers shared by all codecs of a payload type
+ */
+
+#include <gtest/gtest.h>
+#include "sensorstreamkit/core/flatbuffers_codec.hpp"
+#include "sensorstreamkit/core/half_imu_codec.hpp"
+#include "sensorstreamkit/core/message.hpp"
+#include <algorithm>
+#include <cstring>
+#include <memory_resource>
+#include <type_traits>
+#include <vector>
+
+using namespace sensorstreamkit::core;
+
+namespace {
+
+static_assert(MessageCodec<NativeCodec, ImuData>);
+static_assert(MessageCodec<HalfImuCodec, ImuData>);
+static_assert(!InterningCodec<HalfImuCodec, ImuData>);
+static_assert(!MessageCodec<HalfImuCodec, CameraFrameData>);
+static_assert(std::is_same_v<Message<ImuData>, Message<ImuData, NativeCodec>>);
+
+using FlatImuMessage = Message<ImuData, FlatBufferCodec>;
+using HalfImuMessage = Message<ImuData, HalfImuCodec>;
+
+}  // namespace
+
+// ============================================================================
+// Test Fixture
+// ============================================================================
+
+class MessageCodecTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        imu_data_.sensor_id_ = "imu_front";
+        imu_data_.timestamp_ns_ = 1'234'567'890ull;
+        imu_data_.accel_x = 0.5f;
+        imu_data_.accel_z = 9.81f;
+        imu_data_.gyro_y = -0.02f;
+    }
+
+    ImuData imu_data_;
+};
+
+// ============================================================================
+// Native Codec Tests
+// ============================================================================
+
+TEST_F(MessageCodecTest, NativeCodecWritesMessageFrame) {
+    const Message<ImuData> message(imu_data_);
+    std::vector<uint8_t> frame;
+    message.serialize(frame);
+
+    std::vector<uint8_t> encoded(NativeCodec::encoded_size(message.header(), message.payload()));
+    ASSERT_EQ(NativeCodec::encode(message.header(), message.payload(), encoded), frame.size());
+    EXPECT_EQ(encoded, frame);
+
+    MessageHeader header;
+    ImuData payload;
+    ASSERT_TRUE(NativeCodec::decode(frame, header, payload));
+    EXPECT_EQ(header.sequence_number, message.header().sequence_number);
+    EXPECT_EQ(payload.sensor_id_, imu_data_.sensor_id_);
+}
+
+// ============================================================================
+// FlatBuffers Codec Tests
+// ============================================================================
+
+TEST_F(MessageCodecTest, FlatBufferCodecMatchesBuilderEncoding) {
+    const FlatImuMessage message(imu_data_);
+    std::vector<uint8_t> frame;
+    message.serialize(frame);
+    ASSERT_EQ(frame.size(), message.serialized_size());
+
+    flatbuffers::FlatBufferBuilder builder;
+    const ConstPayload expected = FlatBufferCodec::encode(message, builder);
+    EXPECT_TRUE(std::equal(frame.begin(), frame.end(), expected.begin(), expected.end()));
+    EXPECT_TRUE(FlatBufferView<ImuData>::from(frame).has_value());
+}
+
+TEST_F(MessageCodecTest, FlatBufferCodecReusesOnlyTheBuildItSized) {
+    const FlatImuMessage first(imu_data_);
+    imu_data_.sensor_id_ = "imu_rear";
+    const FlatImuMessage second(imu_data_);
+
+    flatbuffers::FlatBufferBuilder builder;
+    auto expected = [&](const FlatImuMessage& message) {
+        const ConstPayload bytes = FlatBufferCodec::encode(message, builder);
+        return std::vector<uint8_t>(bytes.begin(), bytes.end());
+    };
+
+    // Sized first, then encoded: the kept build goes out
+    std::vector<uint8_t> frame(first.serialized_size());
+    ASSERT_EQ(first.serialize_into(frame), frame.size());
+    EXPECT_EQ(frame, expected(first));
+
+    // Sizing one message does not hand its build to another
+    std::vector<uint8_t> other(second.serialized_size());
+    ASSERT_EQ(first.serialized_size(), frame.size());
+    ASSERT_EQ(second.serialize_into(other), other.size());
+    EXPECT_EQ(other, expected(second));
+
+    // Without a sizing call just before, encode() builds afresh
+    ASSERT_EQ(first.serialize_into(frame), frame.size());
+    EXPECT_EQ(frame, expected(first));
+}
+
+TEST_F(MessageCodecTest, FlatBufferCodecRoundTrip) {
+    const FlatImuMessage original(imu_data_);
+    std::vector<uint8_t> frame;
+    original.serialize(frame);
+
+    auto decoded = FlatImuMessage::deserialize(frame);
+    ASSERT_TRUE(decoded.has_value());
+    EXPECT_EQ(decoded->header().sequence_number, original.header().sequence_number);
+    EXPECT_EQ(decoded->payload().sensor_id_, imu_data_.sensor_id_);
+    EXPECT_FLOAT_EQ(decoded->payload().accel_z, imu_data_.accel_z);
+
+    // A native frame is not a FlatBuffer, and the other way round
+    std::vector<uint8_t> native;
+    Message<ImuData>(imu_data_).serialize(native);
+    EXPECT_FALSE(FlatImuMessage::deserialize(native).has_value());
+    EXPECT_FALSE(Message<ImuData>::deserialize(frame).has_value());
+}
+
+TEST_F(MessageCodecTest, FlatBufferCodecDecodesInPlace) {
+    using FlatLidarMessage = Message<LidarScanData, FlatBufferCodec>;
+    LidarScanData scan;
+    scan.sensor_id_ = "vehicle_07/lidar_roof_with_a_long_name";
+    for (int i = 0; i < 64; ++i) {
+        scan.points.push_back({.x = static_cast<float>(i), .y = 1.0f, .z = 2.0f, .ring = 3});
+    }
+    std::vector<uint8_t> frame;
+    FlatLidarMessage(scan).serialize(frame);
+
+    std::pmr::monotonic_buffer_resource arena;
+    FlatLidarMessage received(&arena);
+    ASSERT_TRUE(FlatLidarMessage::deserialize_into(frame, received));
+    const char* id = received.payload().sensor_id_.data();
+    const float* column = received.payload().points.x().data();
+
+    // A second decode reuses the strings and columns and keeps the allocator
+    ASSERT_TRUE(FlatLidarMessage::deserialize_into(frame, received));
+    EXPECT_EQ(received.payload().sensor_id_.data(), id);
+    EXPECT_EQ(received.payload().points.x().data(), column);
+    EXPECT_EQ(received.payload().sensor_id_.get_allocator().resource(), &arena);
+    EXPECT_EQ(received.payload().sensor_id_, scan.sensor_id_);
+    EXPECT_EQ(received.payload().points, scan.points);
+}
+
+// ============================================================================
+// Half IMU Codec Tests
+// ============================================================================
+
+TEST_F(MessageCodecTest, HalfImuCodecRoundTrip) {
+    const HalfImuMessage original(imu_data_);
+    std::vector<uint8_t> frame;
+    original.serialize(frame);
+    EXPECT_EQ(frame.size(), MessageHeader::serialized_size() + 1 + imu_data_.sensor_id_.size() + 8 + 12);
+    EXPECT_LT(frame.size(), Message<ImuData>(imu_data_).serialized_size());
+
+    HalfImuMessage decoded;
+    ASSERT_TRUE(HalfImuMessage::deserialize_into(frame, decoded));
+    EXPECT_EQ(decoded.payload().sensor_id_, imu_data_.sensor_id_);
+    EXPECT_EQ(decoded.payload().timestamp_ns_, imu_data_.timestamp_ns_);
+    EXPECT_EQ(decoded.header().timestamp_ns, original.header().timestamp_ns);
+    EXPECT_NEAR(decoded.payload().accel_z, imu_data_.accel_z, 0.01f);
+    EXPECT_NEAR(decoded.payload().gyro_y, imu_data_.gyro_y, 1e-4f);
+
+    EXPECT_FALSE(HalfImuMessage::deserialize(ConstPayload(frame).first(frame.size() - 1)).has_value());
+}
+
+TEST_F(MessageCodecTest, HalfImuCodecCarriesNoFlags) {
+    HalfImuMessage message(imu_data_);
+    message.set_checksum(true);
+    std::vector<uint8_t> frame;
+    message.serialize(frame);
+
+    auto decoded = HalfImuMessage::deserialize(frame);
+    ASSERT_TRUE(decoded.has_value());
+    EXPECT_EQ(decoded->header().flags, 0);
+
+    // A flag promises a section this codec never writes
+    const uint16_t flags = MessageHeader::kFlagCrc32c;
+    std::memcpy(frame.data() + MessageHeader::serialized_size() - sizeof(flags), &flags, sizeof(flags));
+    EXPECT_FALSE(HalfImuMessage::deserialize(frame).has_value());
+}
+
+TEST_F(MessageCodecTest, HalfImuCodecTooSmallWritesNothing) {
+    const HalfImuMessage message(imu_data_);
+    std::vector<uint8_t> out(message.serialized_size() - 1, 0xAB);
+    EXPECT_EQ(message.serialize_into(out), 0u);
+    EXPECT_TRUE(std::all_of(out.begin(), out.end(), [](uint8_t b) { return b == 0xAB; }));
+}
+
+TEST_F(MessageCodecTest, SequenceIsSharedAcrossCodecs) {
+    imu_data_.sensor_id_ = "imu_sequence_shared";
+    const Message<ImuData> first(imu_data_);
+    const FlatImuMessage second(imu_data_);
+    const HalfImuMessage third(imu_data_);
+    EXPECT_EQ(second.header().sequence_number, first.header().sequence_number + 1);
+    EXPECT_EQ(third.header().sequence_number, first.header().sequence_number + 2);
+}
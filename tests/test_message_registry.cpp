@@ -0,0 +1,238 @@
+/**
+ * @file test_message_registry.cpp
+ * @brief Unit tests for message type ids, MessageRegistry and dispatch()
+ * @author Jo, SeungHyeon (Jo,SH)
+ * @date 2025
+ *
+ * Focuses on:
+ * - Message<T> stamping its payload's id into the header
+ * - Typed decoders rejecting frames of another type, accepting untyped ones
+ * - dispatch() routing to Message<T> and MessageView<T> handlers
+ * - Frames dispatch() must refuse (untyped, unknown, unhandled, malformed)
+ * - Registries with user-defined payload types
+ */
+
+#include <gtest/gtest.h>
+#include "sensorstreamkit/core/message.hpp"
+#include "sensorstreamkit/core/message_registry.hpp"
+#include "sensorstreamkit/core/message_view.hpp"
+#include <string>
+#include <vector>
+
+using namespace sensorstreamkit::core;
+
+namespace {
+
+/**
+ * @brief Payload defined outside the library, with its own id
+ */
+struct OdometryData {
+    std::string sensor_id_;
+    uint64_t timestamp_ns_{0};
+    float speed_mps{0.0f};
+
+    static constexpr uint16_t kMessageType = 100;
+
+    static constexpr auto fields() noexcept {
+        return std::tuple{field<&OdometryData::sensor_id_>, field<&OdometryData::timestamp_ns_>,
+                          field<&OdometryData::speed_mps>};
+    }
+
+    [[nodiscard]] uint64_t timestamp_ns() const noexcept { return timestamp_ns_; }
+    [[nodiscard]] std::string_view sensor_id() const noexcept { return sensor_id_; }
+
+    [[nodiscard]] size_t serialized_size() const noexcept { return serialization::serialized_size(*this); }
+    void serialize(std::vector<uint8_t>& buffer) const {
+        const size_t offset = buffer.size();
+        buffer.resize(offset + serialized_size());
+        serialize_into(MutablePayload(buffer).subspan(offset));
+    }
+    size_t serialize_into(MutablePayload out) const noexcept { return serialization::serialize_into(*this, out); }
+    static std::optional<OdometryData> deserialize(ConstPayload data) {
+        return serialization::deserialize<OdometryData>(data);
+    }
+    static bool deserialize_into(ConstPayload data, OdometryData& out) {
+        return serialization::deserialize_into(data, out);
+    }
+};
+
+using VehicleMessages = MessageRegistry<ImuData, OdometryData>;
+
+static_assert(TypedPayload<OdometryData>);
+static_assert(BuiltinMessages::contains<ImuData>);
+static_assert(!BuiltinMessages::contains<OdometryData>);
+static_assert(VehicleMessages::max_id == OdometryData::kMessageType);
+
+template <typename T>
+std::vector<uint8_t> serialize_message(const Message<T>& message) {
+    std::vector<uint8_t> buffer;
+    message.serialize(buffer);
+    return buffer;
+}
+
+}  // namespace
+
+// ============================================================================
+// Test Fixture
+// ============================================================================
+
+class MessageRegistryTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        imu_data_ = ImuData{
+            .sensor_id_ = "imu_main",
+            .timestamp_ns_ = 1234567890,
+            .accel_x = 0.1f,
+            .accel_y = 0.2f,
+            .accel_z = 9.81f,
+            .gyro_x = 0.01f,
+            .gyro_y = 0.02f,
+            .gyro_z = 0.03f
+        };
+
+        camera_data_ = CameraFrameData{
+            .sensor_id_ = "camera_front",
+            .timestamp_ns_ = 1234567890,
+            .frame_id = 42,
+            .width = 1920,
+            .height = 1080,
+            .encoding = "RGB8"
+        };
+
+        imu_frame_ = serialize_message(Message<ImuData>(imu_data_));
+        camera_frame_ = serialize_message(Message<CameraFrameData>(camera_data_));
+    }
+
+    ImuData imu_data_;
+    CameraFrameData camera_data_;
+    std::vector<uint8_t> imu_frame_;
+    std::vector<uint8_t> camera_frame_;
+};
+
+// ============================================================================
+// Type Id Tests
+// ============================================================================
+
+TEST_F(MessageRegistryTest, MessagesCarryTheirPayloadType) {
+    EXPECT_EQ(Message<ImuData>(imu_data_).header().message_type, ImuData::kMessageType);
+    EXPECT_EQ(Message<CameraFrameData>(camera_data_).header().message_type, CameraFrameData::kMessageType);
+
+    SequenceCounter sequence;
+    EXPECT_EQ(Message<LidarScanData>(LidarScanData{}, sequence).header().message_type, LidarScanData::kMessageType);
+
+    auto decoded = Message<ImuData>::deserialize(imu_frame_);
+    ASSERT_TRUE(decoded.has_value());
+    EXPECT_EQ(decoded->header().message_type, ImuData::kMessageType);
+}
+
+TEST_F(MessageRegistryTest, TypedDecodersRejectOtherTypes) {
+    EXPECT_FALSE(Message<ImuData>::deserialize(camera_frame_).has_value());
+    EXPECT_FALSE(Message<CameraFrameData>::deserialize(imu_frame_).has_value());
+    EXPECT_FALSE(MessageView<ImuData>::from(camera_frame_).has_value());
+}
+
+TEST_F(MessageRegistryTest, TypedDecodersAcceptUntypedFrames) {
+    // Frames from senders that predate type ids carry 0
+    const auto untyped = serialize_message(Message<ImuData>(MessageHeader{.sequence_number = 7}, imu_data_));
+
+    auto decoded = Message<ImuData>::deserialize(untyped);
+    ASSERT_TRUE(decoded.has_value());
+    EXPECT_EQ(decoded->header().sequence_number, 7u);
+    EXPECT_TRUE(MessageView<ImuData>::from(untyped).has_value());
+}
+
+// ============================================================================
+// Dispatch Tests
+// ============================================================================
+
+TEST_F(MessageRegistryTest, DispatchRoutesByType) {
+    int imu_count = 0;
+    int camera_count = 0;
+    auto on_imu = [&](const Message<ImuData>& msg) {
+        EXPECT_EQ(msg.payload().sensor_id_, imu_data_.sensor_id_);
+        EXPECT_FLOAT_EQ(msg.payload().accel_z, imu_data_.accel_z);
+        ++imu_count;
+    };
+    auto on_camera = [&](const MessageView<CameraFrameData>& view) {
+        EXPECT_EQ(view.payload().encoding(), camera_data_.encoding);
+        EXPECT_EQ(view.payload().width(), camera_data_.width);
+        ++camera_count;
+    };
+
+    EXPECT_TRUE(dispatch(imu_frame_, on_imu, on_camera));
+    EXPECT_TRUE(dispatch(camera_frame_, on_imu, on_camera));
+    EXPECT_TRUE(dispatch(camera_frame_, on_imu, on_camera));
+    EXPECT_EQ(imu_count, 1);
+    EXPECT_EQ(camera_count, 2);
+}
+
+TEST_F(MessageRegistryTest, FirstMatchingHandlerWins) {
+    std::vector<std::string> calls;
+    auto on_imu = [&](const Message<ImuData>&) { calls.push_back("imu"); };
+    auto on_any = [&](const auto& msg) {
+        calls.push_back("any:" + std::string(msg.payload().sensor_id()));
+    };
+
+    EXPECT_TRUE(dispatch(imu_frame_, on_imu, on_any));
+    EXPECT_TRUE(dispatch(camera_frame_, on_imu, on_any));
+    EXPECT_EQ(calls, (std::vector<std::string>{"imu", "any:camera_front"}));
+}
+
+TEST_F(MessageRegistryTest, DispatchRefusesWhatItCannotRoute) {
+    int calls = 0;
+    auto on_imu = [&](const Message<ImuData>&) { ++calls; };
+
+    // No handler for the type
+    EXPECT_FALSE(dispatch(camera_frame_, on_imu));
+
+    // Untyped
+    const auto untyped = serialize_message(Message<ImuData>(MessageHeader{}, imu_data_));
+    EXPECT_FALSE(dispatch(untyped, on_imu));
+
+    // Id outside the registry
+    auto unknown = imu_frame_;
+    unknown[12] = 0x63;
+    EXPECT_FALSE(dispatch(unknown, on_imu));
+
+    // Right type, but truncated payload or header
+    EXPECT_FALSE(dispatch(ConstPayload(imu_frame_).first(imu_frame_.size() - 1), on_imu));
+    EXPECT_FALSE(dispatch(ConstPayload(imu_frame_).first(10), on_imu));
+    EXPECT_FALSE(dispatch(ConstPayload{}, on_imu));
+
+    EXPECT_EQ(calls, 0);
+}
+
+TEST_F(MessageRegistryTest, DispatchResolvesInternedStrings) {
+    StringRegistry strings;
+    strings.intern(imu_data_.sensor_id_);
+
+    Message<ImuData> original(imu_data_);
+    std::vector<uint8_t> buffer(original.serialized_size(strings));
+    original.serialize_into(buffer, strings);
+
+    std::pmr::string seen;
+    auto on_imu = [&](const Message<ImuData>& msg) { seen = msg.payload().sensor_id_; };
+
+    EXPECT_FALSE(dispatch(buffer, on_imu));
+    EXPECT_TRUE(dispatch(buffer, &strings, on_imu));
+    EXPECT_EQ(seen, imu_data_.sensor_id_);
+}
+
+TEST_F(MessageRegistryTest, CustomRegistry) {
+    const auto odometry_frame = serialize_message(
+        Message<OdometryData>(OdometryData{.sensor_id_ = "wheel_odom", .speed_mps = 12.5f}));
+
+    float speed = 0.0f;
+    int imu_count = 0;
+    auto on_odometry = [&](const Message<OdometryData>& msg) { speed = msg.payload().speed_mps; };
+    auto on_imu = [&](const Message<ImuData>&) { ++imu_count; };
+
+    EXPECT_TRUE(dispatch<VehicleMessages>(odometry_frame, on_odometry, on_imu));
+    EXPECT_TRUE(dispatch<VehicleMessages>(imu_frame_, on_odometry, on_imu));
+    EXPECT_FLOAT_EQ(speed, 12.5f);
+    EXPECT_EQ(imu_count, 1);
+
+    // Not part of VehicleMessages / BuiltinMessages respectively
+    EXPECT_FALSE(dispatch<VehicleMessages>(camera_frame_, [](const auto&) {}));
+    EXPECT_FALSE(dispatch(odometry_frame, on_odometry));
+}
@@ -0,0 +1,260 @@
+/**
+ * @file test_message_view.cpp
+ * @brief Unit tests for zero-copy MessageView<T> / PayloadView<T>
+ * @author Jo, SeungHyeon (Jo,SH)
+ * @date 2025
+ *
+ * Focuses on:
+ * - Field accessors matching Message<T>::deserialize results
+ * - Header flags as Message<T> reports them, without the frame flags
+ * - Fixed-section offsets derived from fields()
+ * - ImuBatch views checking the samples without decoding them
+ * - string_view accessors pointing into the source buffer (no copies)
+ * - Rejection of truncated or overrunning buffers
+ */
+
+#include <gtest/gtest.h>
+#include "sensorstreamkit/core/message_view.hpp"
+#include <cstring>
+#include <vector>
+
+using namespace sensorstreamkit::core;
+
+// ============================================================================
+// Test Fixture
+// ============================================================================
+
+class MessageViewTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        camera_data_ = CameraFrameData{
+            .sensor_id_ = "camera_front_left_long_identifier",
+            .timestamp_ns_ = 1234567890123456789ULL,
+            .frame_id = 42,
+            .width = 1920,
+            .height = 1080,
+            .encoding = "BAYER_RGGB8"
+        };
+
+        lidar_data_ = LidarScanData{
+            .sensor_id_ = "lidar_roof",
+            .timestamp_ns_ = 5555555555555555555ULL,
+            .num_points = 100000,
+            .scan_duration_ms = 100.5f
+        };
+
+        imu_data_ = ImuData{
+            .sensor_id_ = "imu_main",
+            .timestamp_ns_ = 9876543210987654321ULL,
+            .accel_x = 1.5f,
+            .accel_y = -2.3f,
+            .accel_z = 9.8f,
+            .gyro_x = 0.1f,
+            .gyro_y = -0.05f,
+            .gyro_z = 0.02f
+        };
+    }
+
+    template <SensorDataType T>
+    static std::vector<uint8_t> serialize(const T& payload) {
+        std::vector<uint8_t> buffer;
+        Message<T>(payload).serialize(buffer);
+        return buffer;
+    }
+
+    static bool points_into(std::string_view view, const std::vector<uint8_t>& buffer) {
+        auto* begin = reinterpret_cast<const char*>(buffer.data());
+        return view.data() >= begin && view.data() + view.size() <= begin + buffer.size();
+    }
+
+    CameraFrameData camera_data_;
+    LidarScanData lidar_data_;
+    ImuData imu_data_;
+};
+
+// ============================================================================
+// Field Access Tests
+// ============================================================================
+
+TEST_F(MessageViewTest, CameraViewMatchesPayload) {
+    auto buffer = serialize(camera_data_);
+
+    auto view = MessageView<CameraFrameData>::from(buffer);
+    ASSERT_TRUE(view.has_value());
+
+    const auto& payload = view->payload();
+    EXPECT_EQ(payload.sensor_id(), camera_data_.sensor_id_);
+    EXPECT_EQ(payload.timestamp_ns(), camera_data_.timestamp_ns_);
+    EXPECT_EQ(payload.frame_id(), camera_data_.frame_id);
+    EXPECT_EQ(payload.width(), camera_data_.width);
+    EXPECT_EQ(payload.height(), camera_data_.height);
+    EXPECT_EQ(payload.encoding(), camera_data_.encoding);
+}
+
+TEST_F(MessageViewTest, LidarViewMatchesPayload) {
+    auto buffer = serialize(lidar_data_);
+
+    auto view = MessageView<LidarScanData>::from(buffer);
+    ASSERT_TRUE(view.has_value());
+
+    EXPECT_EQ(view->payload().sensor_id(), lidar_data_.sensor_id_);
+    EXPECT_EQ(view->payload().timestamp_ns(), lidar_data_.timestamp_ns_);
+    EXPECT_EQ(view->payload().num_points(), lidar_data_.num_points);
+    EXPECT_FLOAT_EQ(view->payload().scan_duration_ms(), lidar_data_.scan_duration_ms);
+}
+
+TEST_F(MessageViewTest, ImuViewMatchesPayload) {
+    auto buffer = serialize(imu_data_);
+
+    auto view = MessageView<ImuData>::from(buffer);
+    ASSERT_TRUE(view.has_value());
+
+    const auto& payload = view->payload();
+    EXPECT_EQ(payload.sensor_id(), imu_data_.sensor_id_);
+    EXPECT_EQ(payload.timestamp_ns(), imu_data_.timestamp_ns_);
+    EXPECT_FLOAT_EQ(payload.accel_x(), imu_data_.accel_x);
+    EXPECT_FLOAT_EQ(payload.accel_y(), imu_data_.accel_y);
+    EXPECT_FLOAT_EQ(payload.accel_z(), imu_data_.accel_z);
+    EXPECT_FLOAT_EQ(payload.gyro_x(), imu_data_.gyro_x);
+    EXPECT_FLOAT_EQ(payload.gyro_y(), imu_data_.gyro_y);
+    EXPECT_FLOAT_EQ(payload.gyro_z(), imu_data_.gyro_z);
+}
+
+TEST_F(MessageViewTest, ImuBatchViewMatchesPayload) {
+    ImuBatch batch{.sensor_id_ = "imu_main"};
+    for (uint32_t i = 0; i < 10; ++i) {
+        imu_data_.timestamp_ns_ = 1'000'000'000ull + i * 1'000'000ull;
+        imu_data_.gyro_z = 0.01f * static_cast<float>(i);
+        batch.push_back(imu_data_);
+    }
+    auto buffer = serialize(batch);
+
+    auto view = MessageView<ImuBatch>::from(buffer);
+    ASSERT_TRUE(view.has_value());
+
+    const auto& payload = view->payload();
+    EXPECT_EQ(payload.sensor_id(), batch.sensor_id_);
+    EXPECT_EQ(payload.timestamp_ns(), batch.timestamp_ns());
+    EXPECT_EQ(payload.samples().size(), batch.samples.size());
+    EXPECT_FALSE(payload.samples().half_precision());
+    EXPECT_EQ(payload.to_owned().samples, batch.samples);
+
+    for (size_t len = 0; len < buffer.size(); ++len) {
+        EXPECT_FALSE(MessageView<ImuBatch>::from(ConstPayload(buffer.data(), len)).has_value()) << "length " << len;
+    }
+
+    auto empty = MessageView<ImuBatch>::from(serialize(ImuBatch{.sensor_id_ = "imu_main"}));
+    ASSERT_TRUE(empty.has_value());
+    EXPECT_EQ(empty->payload().timestamp_ns(), 0u);
+    EXPECT_TRUE(empty->payload().samples().empty());
+}
+
+TEST_F(MessageViewTest, FixedOffsetsFollowFields) {
+    // Offsets come from fields(), so they move with the descriptor
+    static_assert(detail::fixed_offset<&CameraFrameData::timestamp_ns_> == 0);
+    static_assert(detail::fixed_offset<&CameraFrameData::height> == sizeof(uint64_t) + 2 * sizeof(uint32_t));
+    static_assert(detail::fixed_offset<&LidarScanData::scan_duration_ms> == sizeof(uint64_t) + sizeof(uint32_t));
+    static_assert(detail::fixed_offset<&ImuData::gyro_z> == sizeof(uint64_t) + 5 * sizeof(float));
+    static_assert(PayloadView<CameraFrameData>::fixed_size == sizeof(uint64_t) + 3 * sizeof(uint32_t));
+    static_assert(PayloadView<LidarScanData>::fixed_size == sizeof(uint64_t) + sizeof(uint32_t) + sizeof(float));
+    static_assert(PayloadView<ImuData>::fixed_size == sizeof(uint64_t) + 6 * sizeof(float));
+    SUCCEED();
+}
+
+TEST_F(MessageViewTest, HeaderMatchesMessage) {
+    Message<ImuData> original(imu_data_);
+    std::vector<uint8_t> buffer;
+    original.serialize(buffer);
+
+    auto view = MessageView<ImuData>::from(buffer);
+    ASSERT_TRUE(view.has_value());
+
+    EXPECT_EQ(view->header().timestamp_ns, original.header().timestamp_ns);
+    EXPECT_EQ(view->header().sequence_number, original.header().sequence_number);
+    EXPECT_EQ(view->header().message_type, original.header().message_type);
+}
+
+TEST_F(MessageViewTest, HeaderFlagsMatchMessage) {
+    for (bool checksum : {false, true}) {
+        Message<ImuData> original(imu_data_);
+        original.set_checksum(checksum);
+        ASSERT_TRUE(original.extensions().add(HeaderExtensions::kDeadlineNs, uint64_t{77}));
+        std::vector<uint8_t> buffer;
+        original.serialize(buffer);
+        ASSERT_TRUE(MessageHeader::deserialize(buffer)->flags & MessageHeader::kFlagExtensions);
+
+        auto view = MessageView<ImuData>::from(buffer);
+        auto decoded = Message<ImuData>::deserialize(buffer);
+        ASSERT_TRUE(view.has_value());
+        ASSERT_TRUE(decoded.has_value());
+        EXPECT_EQ(view->header(), decoded->header()) << "checksum " << checksum;
+        EXPECT_EQ(view->header().flags, original.header().flags);
+    }
+}
+
+// ============================================================================
+// Zero-Copy Tests
+// ============================================================================
+
+TEST_F(MessageViewTest, StringViewsPointIntoBuffer) {
+    auto buffer = serialize(camera_data_);
+
+    auto view = MessageView<CameraFrameData>::from(buffer);
+    ASSERT_TRUE(view.has_value());
+
+    EXPECT_TRUE(points_into(view->payload().sensor_id(), buffer));
+    EXPECT_TRUE(points_into(view->payload().encoding(), buffer));
+    EXPECT_EQ(view->bytes().data(), buffer.data());
+}
+
+TEST_F(MessageViewTest, ToOwnedRoundTrip) {
+    auto buffer = serialize(camera_data_);
+
+    auto view = MessageView<CameraFrameData>::from(buffer);
+    ASSERT_TRUE(view.has_value());
+
+    CameraFrameData owned = view->payload().to_owned();
+    EXPECT_EQ(owned.sensor_id_, camera_data_.sensor_id_);
+    EXPECT_EQ(owned.timestamp_ns_, camera_data_.timestamp_ns_);
+    EXPECT_EQ(owned.frame_id, camera_data_.frame_id);
+    EXPECT_EQ(owned.encoding, camera_data_.encoding);
+
+    auto message = view->to_message();
+    ASSERT_TRUE(message.has_value());
+    EXPECT_EQ(message->header().sequence_number, view->header().sequence_number);
+    EXPECT_EQ(message->payload().sensor_id_, camera_data_.sensor_id_);
+}
+
+// ============================================================================
+// Validation Tests
+// ============================================================================
+
+TEST_F(MessageViewTest, RejectsEmptyBuffer) {
+    std::vector<uint8_t> empty;
+    EXPECT_FALSE(MessageView<ImuData>::from(empty).has_value());
+}
+
+TEST_F(MessageViewTest, RejectsHeaderOnly) {
+    std::vector<uint8_t> buffer(MessageHeader::serialized_size());
+    EXPECT_FALSE(MessageView<ImuData>::from(buffer).has_value());
+}
+
+TEST_F(MessageViewTest, RejectsEveryTruncation) {
+    auto buffer = serialize(camera_data_);
+
+    // Any strict prefix of a valid message must be rejected
+    for (size_t len = 0; len < buffer.size(); ++len) {
+        ConstPayload prefix(buffer.data(), len);
+        EXPECT_FALSE(MessageView<CameraFrameData>::from(prefix).has_value()) << "length " << len;
+    }
+}
+
+TEST_F(MessageViewTest, RejectsOverrunningStringLength) {
+    auto buffer = serialize(imu_data_);
+
+    // Corrupt sensor_id length so it points past the end of the buffer
+    uint32_t bogus_len = 0xFFFFFFF0u;
+    std::memcpy(buffer.data() + MessageHeader::serialized_size(), &bogus_len, sizeof(bogus_len));
+
+    EXPECT_FALSE(MessageView<ImuData>::from(buffer).has_value());
+}
@@ -0,0 +1,321 @@
+/**
+ * @file test_point_cloud.cpp
+ * @brief Unit tests for PointCloud, its quantization kernels and lidar frames
+ * @author Jo, SeungHyeon (Jo,SH)
+ * @date 2025
+ *
+ * Focuses on:
+ * - Quantization kernels matching a scalar reference, including tails, saturation and NaN
+ * - Lossless float32 and bounded-error int16 round-trips
+ * - Wire size of quantized clouds, and metadata-only frames keeping the pre-cloud layout
+ * - PointCloudView decoding single columns in place
+ * - Rejection of truncated and corrupt clouds
+ */
+
+#include <gtest/gtest.h>
+#include "sensorstreamkit/core/message.hpp"
+#include "sensorstreamkit/core/message_view.hpp"
+#include "sensorstreamkit/core/point_cloud.hpp"
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+using namespace sensorstreamkit::core;
+
+namespace {
+
+int16_t reference_step(float value, float resolution) {
+    if (std::isnan(value)) return quantization::kInvalidStep;
+    const float steps = std::fmin(std::fmax(value * (1.0f / resolution), -32767.0f), 32767.0f);
+    return static_cast<int16_t>(std::lrint(steps));
+}
+
+}  // namespace
+
+// ============================================================================
+// Test Fixture
+// ============================================================================
+
+class PointCloudTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        // Two rings of a small spinning scan
+        for (uint16_t ring = 0; ring < 2; ++ring) {
+            for (uint32_t i = 0; i < 37; ++i) {
+                const float angle = static_cast<float>(i) * 0.17f;
+                cloud_.push_back(LidarPoint{
+                    .x = 12.5f * std::cos(angle),
+                    .y = 12.5f * std::sin(angle),
+                    .z = -1.7f + 0.3f * ring,
+                    .intensity = static_cast<uint16_t>(i * 100),
+                    .ring = ring,
+                    .time_offset_ns = i * 2700
+                });
+            }
+        }
+
+        lidar_data_ = LidarScanData{
+            .sensor_id_ = "lidar_roof",
+            .timestamp_ns_ = 1234567890,
+            .num_points = static_cast<uint32_t>(cloud_.size()),
+            .scan_duration_ms = 100.0f,
+            .points = cloud_
+        };
+    }
+
+    PointCloud cloud_;
+    LidarScanData lidar_data_;
+};
+
+// ============================================================================
+// Kernel Tests
+// ============================================================================
+
+TEST_F(PointCloudTest, EncodeMatchesScalarReference) {
+    // Odd lengths exercise the vector loop and the scalar tail
+    for (size_t count : {0u, 1u, 7u, 8u, 9u, 31u, 100u}) {
+        std::vector<float> values(count);
+        for (size_t i = 0; i < count; ++i) {
+            values[i] = (static_cast<float>(i) - 50.0f) * 0.0137f;
+        }
+        std::vector<uint8_t> encoded(count * sizeof(int16_t) + 1);
+        // Unaligned destination
+        quantization::encode(encoded.data() + 1, values.data(), count, 0.001f);
+
+        for (size_t i = 0; i < count; ++i) {
+            int16_t step;
+            std::memcpy(&step, encoded.data() + 1 + i * sizeof(step), sizeof(step));
+            EXPECT_EQ(step, reference_step(values[i], 0.001f)) << "count " << count << " index " << i;
+        }
+    }
+}
+
+TEST_F(PointCloudTest, EncodeSaturates) {
+    const std::vector<float> values{1e9f, -1e9f, 327.67f, -327.68f, 400.0f, -400.0f, 0.004f, 0.006f, 1e30f};
+    std::vector<int16_t> steps(values.size());
+    quantization::encode(reinterpret_cast<uint8_t*>(steps.data()), values.data(), values.size(), 0.01f);
+
+    // -32768 is left for NaN, so negative values saturate one step short of it
+    EXPECT_EQ(steps, (std::vector<int16_t>{32767, -32767, 32767, -32767, 32767, -32767, 0, 1, 32767}));
+}
+
+TEST_F(PointCloudTest, NanRoundTripsAsInvalidStep) {
+    constexpr float nan = std::numeric_limits<float>::quiet_NaN();
+    constexpr float inf = std::numeric_limits<float>::infinity();
+    // 19 values: NaN and infinities land in both vector halves and the scalar tail
+    std::vector<float> values(19, 1.25f);
+    for (size_t i : {0u, 5u, 9u, 18u}) values[i] = nan;
+    values[3] = inf;
+    values[12] = -inf;
+
+    std::vector<int16_t> steps(values.size());
+    quantization::encode(reinterpret_cast<uint8_t*>(steps.data()), values.data(), values.size(), 0.01f);
+    for (size_t i = 0; i < values.size(); ++i) {
+        EXPECT_EQ(steps[i], reference_step(values[i], 0.01f)) << "index " << i;
+    }
+    EXPECT_EQ(steps[3], 32767);
+    EXPECT_EQ(steps[12], -32767);
+
+    std::vector<float> decoded(steps.size());
+    quantization::decode(decoded.data(), reinterpret_cast<const uint8_t*>(steps.data()), steps.size(), 0.01f);
+    for (size_t i = 0; i < values.size(); ++i) {
+        EXPECT_EQ(std::isnan(decoded[i]), std::isnan(values[i])) << "index " << i;
+    }
+    EXPECT_FLOAT_EQ(decoded[1], 1.25f);
+    EXPECT_FLOAT_EQ(decoded[12], -327.67f);
+}
+
+TEST_F(PointCloudTest, DecodeInvertsEncode) {
+    std::vector<int16_t> steps(19);
+    for (size_t i = 0; i < steps.size(); ++i) {
+        steps[i] = static_cast<int16_t>(static_cast<int>(i) * 3449 - 32767);
+    }
+    std::vector<float> decoded(steps.size());
+    quantization::decode(decoded.data(), reinterpret_cast<const uint8_t*>(steps.data()), steps.size(), 0.005f);
+
+    for (size_t i = 0; i < steps.size(); ++i) {
+        EXPECT_FLOAT_EQ(decoded[i], static_cast<float>(steps[i]) * 0.005f);
+    }
+}
+
+// ============================================================================
+// Round-Trip Tests
+// ============================================================================
+
+TEST_F(PointCloudTest, FloatCloudRoundTripsExactly) {
+    Message<LidarScanData> original(lidar_data_);
+    std::vector<uint8_t> buffer;
+    original.serialize(buffer);
+
+    auto result = Message<LidarScanData>::deserialize(buffer);
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(result->payload().points, cloud_);
+    EXPECT_EQ(result->payload().points.point(40), cloud_.point(40));
+}
+
+TEST_F(PointCloudTest, QuantizedCloudIsSmallerAndWithinHalfAStep) {
+    constexpr float resolution = 0.005f;
+    const size_t float_size = FieldCodec<PointCloud>::size(cloud_);
+    lidar_data_.points.set_resolution(resolution);
+    const size_t quantized_size = FieldCodec<PointCloud>::size(lidar_data_.points);
+
+    // 6 instead of 12 bytes of coordinates per point
+    EXPECT_EQ(float_size - quantized_size, cloud_.size() * 3 * sizeof(int16_t));
+
+    Message<LidarScanData> original(lidar_data_);
+    original.set_checksum(true);
+    std::vector<uint8_t> buffer;
+    original.serialize(buffer);
+
+    auto result = Message<LidarScanData>::deserialize(buffer);
+    ASSERT_TRUE(result.has_value());
+    const PointCloud& points = result->payload().points;
+    ASSERT_EQ(points.size(), cloud_.size());
+    EXPECT_FLOAT_EQ(points.resolution(), resolution);
+    for (size_t i = 0; i < points.size(); ++i) {
+        EXPECT_NEAR(points.x()[i], cloud_.x()[i], resolution / 2 + 1e-6f);
+        EXPECT_NEAR(points.y()[i], cloud_.y()[i], resolution / 2 + 1e-6f);
+        EXPECT_NEAR(points.z()[i], cloud_.z()[i], resolution / 2 + 1e-6f);
+        EXPECT_EQ(points.intensity()[i], cloud_.intensity()[i]);
+        EXPECT_EQ(points.ring()[i], cloud_.ring()[i]);
+        EXPECT_EQ(points.time_offset_ns()[i], cloud_.time_offset_ns()[i]);
+    }
+}
+
+TEST_F(PointCloudTest, EmptyCloudKeepsTheMetadataLayout) {
+    EXPECT_EQ(FieldCodec<PointCloud>::size(PointCloud{}), 0u);
+
+    lidar_data_.points = PointCloud{};
+    std::vector<uint8_t> buffer;
+    Message<LidarScanData>(lidar_data_).serialize(buffer);
+
+    // header | sensor id | timestamp, num_points, scan_duration_ms: no flag, no cloud bytes
+    EXPECT_EQ(buffer.size(), MessageHeader::serialized_size() + sizeof(uint32_t) + lidar_data_.sensor_id_.size() +
+                                 PayloadView<LidarScanData>::fixed_size);
+    EXPECT_EQ(MessageHeader::deserialize(buffer)->flags, 0);
+
+    auto result = Message<LidarScanData>::deserialize(buffer);
+    ASSERT_TRUE(result.has_value());
+    EXPECT_TRUE(result->payload().points.empty());
+    EXPECT_EQ(result->payload().num_points, lidar_data_.num_points);
+    ASSERT_TRUE(MessageView<LidarScanData>::from(buffer).has_value());
+    EXPECT_TRUE(MessageView<LidarScanData>::from(buffer)->payload().points().empty());
+}
+
+TEST_F(PointCloudTest, CloudTravelsOnlyUnderItsFlag) {
+    std::vector<uint8_t> buffer;
+    Message<LidarScanData>(lidar_data_).serialize(buffer);
+    ASSERT_TRUE(MessageHeader::deserialize(buffer)->flags & MessageHeader::kFlagPointCloud);
+
+    // header() reports what the caller set, not the frame flags
+    auto result = Message<LidarScanData>::deserialize(buffer);
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(result->header().flags, 0);
+    auto view = MessageView<LidarScanData>::from(buffer);
+    ASSERT_TRUE(view.has_value());
+    EXPECT_EQ(view->header().flags, 0);
+
+    // Cloud bytes without the flag
+    constexpr size_t flags_offset = MessageHeader::serialized_size() - sizeof(uint16_t);
+    auto unflagged = buffer;
+    std::memset(unflagged.data() + flags_offset, 0, sizeof(uint16_t));
+    EXPECT_FALSE(Message<LidarScanData>::deserialize(unflagged).has_value());
+    EXPECT_FALSE(MessageView<LidarScanData>::from(unflagged).has_value());
+
+    // The flag without cloud bytes
+    lidar_data_.points = PointCloud{};
+    std::vector<uint8_t> flagged;
+    Message<LidarScanData>(lidar_data_).serialize(flagged);
+    const uint16_t flag = MessageHeader::kFlagPointCloud;
+    std::memcpy(flagged.data() + flags_offset, &flag, sizeof(flag));
+    EXPECT_FALSE(Message<LidarScanData>::deserialize(flagged).has_value());
+    EXPECT_FALSE(MessageView<LidarScanData>::from(flagged).has_value());
+}
+
+TEST_F(PointCloudTest, RejectsResolutionsWithoutAFiniteInverse) {
+    PointCloud cloud;
+    for (float metres : {std::numeric_limits<float>::denorm_min(), 1e-39f, -0.01f,
+                         std::numeric_limits<float>::infinity(), std::numeric_limits<float>::quiet_NaN()}) {
+        cloud.set_resolution(0.01f);
+        cloud.set_resolution(metres);
+        EXPECT_EQ(cloud.resolution(), 0.0f) << metres;
+        EXPECT_FALSE(cloud.quantized()) << metres;
+    }
+
+    // The smallest normal step still has a finite inverse
+    cloud.set_resolution(std::numeric_limits<float>::min());
+    EXPECT_TRUE(cloud.quantized());
+    EXPECT_TRUE(std::isfinite(1.0f / cloud.resolution()));
+}
+
+// ============================================================================
+// View Tests
+// ============================================================================
+
+TEST_F(PointCloudTest, ColumnsAreCacheLineAligned) {
+    auto aligned = [](const void* ptr) { return reinterpret_cast<uintptr_t>(ptr) % kCacheLineSize == 0; };
+    EXPECT_TRUE(aligned(cloud_.x().data()));
+    EXPECT_TRUE(aligned(cloud_.z().data()));
+    EXPECT_TRUE(aligned(cloud_.intensity().data()));
+    EXPECT_TRUE(aligned(cloud_.time_offset_ns().data()));
+
+    // Still aligned after a decode, which is what SIMD post-processing sees
+    std::vector<uint8_t> buffer;
+    Message<LidarScanData>(lidar_data_).serialize(buffer);
+    auto decoded = Message<LidarScanData>::deserialize(buffer);
+    ASSERT_TRUE(decoded.has_value());
+    EXPECT_TRUE(aligned(decoded->payload().points.y().data()));
+    EXPECT_TRUE(aligned(decoded->payload().points.ring().data()));
+}
+
+TEST_F(PointCloudTest, ViewDecodesSingleColumns) {
+    lidar_data_.points.set_resolution(0.01f);
+    std::vector<uint8_t> buffer;
+    Message<LidarScanData>(lidar_data_).serialize(buffer);
+
+    auto view = MessageView<LidarScanData>::from(buffer);
+    ASSERT_TRUE(view.has_value());
+    const PointCloudView& points = view->payload().points();
+    ASSERT_EQ(points.size(), cloud_.size());
+    EXPECT_TRUE(points.quantized());
+
+    std::vector<float> z(points.size());
+    points.decode(PointCloud::Axis::Z, z);
+    for (size_t i = 0; i < z.size(); ++i) {
+        EXPECT_NEAR(z[i], cloud_.z()[i], 0.005f + 1e-6f);
+    }
+
+    const LidarScanData owned = view->payload().to_owned();
+    EXPECT_EQ(owned.points.size(), cloud_.size());
+    EXPECT_EQ(owned.points.ring()[40], cloud_.ring()[40]);
+}
+
+TEST_F(PointCloudTest, RejectsTruncatedAndCorruptClouds) {
+    std::vector<uint8_t> buffer;
+    Message<LidarScanData>(lidar_data_).serialize(buffer);
+
+    EXPECT_FALSE(Message<LidarScanData>::deserialize(ConstPayload(buffer).first(buffer.size() - 1)).has_value());
+    EXPECT_FALSE(MessageView<LidarScanData>::from(ConstPayload(buffer).first(buffer.size() - 1)).has_value());
+
+    // Count claiming far more points than the frame holds
+    const size_t count_offset = MessageHeader::serialized_size() + sizeof(uint32_t) + lidar_data_.sensor_id_.size() +
+                                PayloadView<LidarScanData>::fixed_size;
+    const uint32_t huge = 0xFFFFFFF0u;
+    auto corrupt = buffer;
+    std::memcpy(corrupt.data() + count_offset, &huge, sizeof(huge));
+    EXPECT_FALSE(Message<LidarScanData>::deserialize(corrupt).has_value());
+
+    // Negative resolution
+    const float negative = -0.01f;
+    corrupt = buffer;
+    std::memcpy(corrupt.data() + count_offset + sizeof(uint32_t), &negative, sizeof(negative));
+    EXPECT_FALSE(Message<LidarScanData>::deserialize(corrupt).has_value());
+
+    // Subnormal resolution, whose reciprocal is inf
+    const float subnormal = std::numeric_limits<float>::denorm_min();
+    corrupt = buffer;
+    std::memcpy(corrupt.data() + count_offset + sizeof(uint32_t), &subnormal, sizeof(subnormal));
+    EXPECT_FALSE(Message<LidarScanData>::deserialize(corrupt).has_value());
+    EXPECT_FALSE(MessageView<LidarScanData>::from(corrupt).has_value());
+}
@@ -0,0 +1,139 @@
+/**
+ * @file test_send_buffer_pool.cpp
+ * @brief Unit tests for SendBufferPool
+ * @author Jo, SeungHyeon (Jo,SH)
+ * @date 2025
+ *
+ * Focuses on:
+ * - Which sizes are pooled, and the blocks' size and alignment
+ * - Blocks coming back when ZeroMQ releases the message
+ * - The cached-bytes limit
+ * - Messages released on another thread, or after the pool is gone
+ */
+
+#include <gtest/gtest.h>
+#include "sensorstreamkit/core/aligned_allocator.hpp"
+#include "sensorstreamkit/transport/send_buffer_pool.hpp"
+#include <cstring>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using namespace sensorstreamkit::transport;
+
+// ============================================================================
+// Test Fixture
+// ============================================================================
+
+class SendBufferPoolTest : public ::testing::Test {
+protected:
+    static constexpr size_t kFrameBytes = 100 * 1024;
+
+    SendBufferPool pool_;
+};
+
+// ============================================================================
+// Acquire Tests
+// ============================================================================
+
+TEST_F(SendBufferPoolTest, PoolsOnlyLargeFrames) {
+    zmq::message_t msg;
+    EXPECT_FALSE(pool_.rebuild(msg, SendBufferPool::kMinBlockBytes - 1));
+    EXPECT_FALSE(pool_.rebuild(msg, SendBufferPool::kMaxBlockBytes + 1));
+    EXPECT_EQ(msg.size(), 0u);
+    EXPECT_EQ(pool_.blocks_allocated(), 0u);
+
+    ASSERT_TRUE(pool_.rebuild(msg, SendBufferPool::kMinBlockBytes));
+    EXPECT_EQ(msg.size(), SendBufferPool::kMinBlockBytes);
+    EXPECT_EQ(pool_.blocks_allocated(), 1u);
+}
+
+TEST_F(SendBufferPoolTest, BlocksAreSizedAndAligned) {
+    zmq::message_t msg;
+    ASSERT_TRUE(pool_.rebuild(msg, kFrameBytes));
+    EXPECT_EQ(msg.size(), kFrameBytes);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(msg.data()) % sensorstreamkit::core::kCacheLineSize, 0u);
+
+    // The whole frame is writable
+    std::memset(msg.data(), 0x5A, msg.size());
+    EXPECT_EQ(static_cast<const uint8_t*>(msg.data())[kFrameBytes - 1], 0x5A);
+}
+
+TEST_F(SendBufferPoolTest, ReleasedBlocksAreReused) {
+    const void* first = nullptr;
+    {
+        zmq::message_t msg;
+        ASSERT_TRUE(pool_.rebuild(msg, kFrameBytes));
+        first = msg.data();
+        EXPECT_EQ(pool_.cached_bytes(), 0u);
+    }
+    EXPECT_EQ(pool_.cached_bytes(), 128u * 1024);
+
+    // Any size in the same power-of-two class gets the same block back
+    for (size_t size : {kFrameBytes, size_t{65 * 1024}, size_t{128 * 1024}}) {
+        zmq::message_t msg;
+        ASSERT_TRUE(pool_.rebuild(msg, size));
+        EXPECT_EQ(msg.data(), first);
+    }
+    EXPECT_EQ(pool_.blocks_allocated(), 1u);
+}
+
+TEST_F(SendBufferPoolTest, MessagesInFlightGetSeparateBlocks) {
+    std::vector<zmq::message_t> in_flight(4);
+    for (auto& msg : in_flight) {
+        ASSERT_TRUE(pool_.rebuild(msg, kFrameBytes));
+    }
+    EXPECT_EQ(pool_.blocks_allocated(), 4u);
+    EXPECT_NE(in_flight[0].data(), in_flight[1].data());
+
+    in_flight.clear();
+    zmq::message_t msg;
+    ASSERT_TRUE(pool_.rebuild(msg, kFrameBytes));
+    EXPECT_EQ(pool_.blocks_allocated(), 4u);
+}
+
+TEST_F(SendBufferPoolTest, CachedBytesAreLimited) {
+    SendBufferPool pool(0);
+    for (int i = 0; i < 3; ++i) {
+        zmq::message_t msg;
+        ASSERT_TRUE(pool.rebuild(msg, kFrameBytes));
+    }
+    EXPECT_EQ(pool.blocks_allocated(), 3u);
+    EXPECT_EQ(pool.cached_bytes(), 0u);
+}
+
+// ============================================================================
+// Lifetime Tests
+// ============================================================================
+
+TEST_F(SendBufferPoolTest, ReleaseOnAnotherThread) {
+    zmq::message_t msg;
+    ASSERT_TRUE(pool_.rebuild(msg, kFrameBytes));
+    std::thread io_thread([moved = std::move(msg)]() mutable { moved = zmq::message_t(); });
+    io_thread.join();
+
+    EXPECT_EQ(pool_.cached_bytes(), 128u * 1024);
+    ASSERT_TRUE(pool_.rebuild(msg, kFrameBytes));
+    EXPECT_EQ(pool_.blocks_allocated(), 1u);
+}
+
+TEST_F(SendBufferPoolTest, MessageOutlivesPool) {
+    zmq::message_t msg;
+    {
+        SendBufferPool pool;
+        ASSERT_TRUE(pool.rebuild(msg, kFrameBytes));
+        std::memset(msg.data(), 1, msg.size());
+    }
+    // The block is still valid and goes back to the orphaned storage
+    EXPECT_EQ(static_cast<const uint8_t*>(msg.data())[0], 1);
+    msg = zmq::message_t();
+}
+
+TEST_F(SendBufferPoolTest, MovedFromPoolDoesNotServe) {
+    SendBufferPool moved = std::move(pool_);
+    zmq::message_t msg;
+    EXPECT_FALSE(pool_.rebuild(msg, kFrameBytes));
+    EXPECT_TRUE(moved.rebuild(msg, kFrameBytes));
+    EXPECT_EQ(pool_.blocks_allocated(), 0u);
+    EXPECT_EQ(moved.blocks_allocated(), 1u);
+}
@@ -9,6 +9,7 @@
  * - Thread-safety verification
  * - Move semantics and noexcept guarantees
  * - Integration with Message<T>
+ * - Per-stream counters (SequenceStreams)
  */
 
 #include <gtest/gtest.h>
@@ -18,6 +19,7 @@
 #include <algorithm>
 #include <set>
 #include <chrono>
+#include <string>
 
 using namespace sensorstreamkit::core;
 
@@ -199,7 +201,7 @@ TEST_F(SequenceCounterTest, NoexceptGuarantees) {
 // ============================================================================
 
 TEST_F(SequenceCounterTest, MessageTemplateUsesStaticCounter) {
-    // Each Message<T> template instantiation has its own static SequenceCounter
+    // Each Message<T> template instantiation has its own static SequenceStreams
 
     ImuData imu_data{.sensor_id_ = "imu", .timestamp_ns_ = 1};
     CameraFrameData cam_data{
@@ -221,6 +223,120 @@ TEST_F(SequenceCounterTest, MessageTemplateUsesStaticCounter) {
     EXPECT_LT(cam_msg1.header().sequence_number, cam_msg2.header().sequence_number);
 }
 
+TEST_F(SequenceCounterTest, MessageSequenceIsContiguousPerSensor) {
+    ImuData imu_a{.sensor_id_ = "imu_contiguous_a", .timestamp_ns_ = 1};
+    ImuData imu_b{.sensor_id_ = "imu_contiguous_b", .timestamp_ns_ = 1};
+
+    // Interleaving two sensors must not leave gaps in either stream
+    for (uint32_t i = 0; i < 5; ++i) {
+        EXPECT_EQ(Message<ImuData>(imu_a).header().sequence_number, i);
+        EXPECT_EQ(Message<ImuData>(imu_b).header().sequence_number, i);
+    }
+}
+
+TEST_F(SequenceCounterTest, MessageWithExplicitStream) {
+    SequenceCounter topic_stream;
+    ImuData imu_a{.sensor_id_ = "imu_a", .timestamp_ns_ = 1};
+    ImuData imu_b{.sensor_id_ = "imu_b", .timestamp_ns_ = 1};
+
+    EXPECT_EQ(Message<ImuData>(imu_a, topic_stream).header().sequence_number, 0u);
+    EXPECT_EQ(Message<ImuData>(imu_b, topic_stream).header().sequence_number, 1u);
+    EXPECT_EQ(Message<ImuData>(imu_a, topic_stream).header().sequence_number, 2u);
+}
+
+// ============================================================================
+// SequenceStreams Tests
+// ============================================================================
+
+TEST_F(SequenceCounterTest, StreamsCountIndependently) {
+    SequenceStreams streams;
+
+    EXPECT_EQ(streams.next("camera_front"), 0u);
+    EXPECT_EQ(streams.next("camera_front"), 1u);
+    EXPECT_EQ(streams.next("camera_rear"), 0u);
+    EXPECT_EQ(streams.next("camera_front"), 2u);
+    EXPECT_EQ(&streams.stream("camera_rear"), &streams.stream("camera_rear"));
+}
+
+TEST_F(SequenceCounterTest, StreamsObjectsDoNotShareCounters) {
+    SequenceStreams first;
+    SequenceStreams second;
+
+    EXPECT_EQ(first.next("imu"), 0u);
+    EXPECT_EQ(first.next("imu"), 1u);
+    EXPECT_EQ(second.next("imu"), 0u);
+}
+
+TEST_F(SequenceCounterTest, StreamsSurviveThreadCacheEviction) {
+    SequenceStreams streams;
+    std::vector<std::string> keys;
+    for (int i = 0; i < 32; ++i) {
+        keys.push_back("lidar_" + std::to_string(i));
+    }
+
+    // More keys than the per-thread cache holds
+    for (uint32_t round = 0; round < 3; ++round) {
+        for (const auto& key : keys) {
+            EXPECT_EQ(streams.next(key), round) << key;
+        }
+    }
+}
+
+TEST_F(SequenceCounterTest, StreamsAreContiguousPerThreadStream) {
+    constexpr int num_threads = 8;
+    constexpr uint32_t per_thread = 1000;
+    SequenceStreams streams;
+    std::vector<std::vector<uint32_t>> results(num_threads);
+    std::vector<std::thread> threads;
+
+    for (int t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&, t]() {
+            const std::string key = "camera_" + std::to_string(t);
+            for (uint32_t i = 0; i < per_thread; ++i) {
+                results[t].push_back(streams.next(key));
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (const auto& sequence : results) {
+        ASSERT_EQ(sequence.size(), per_thread);
+        for (uint32_t i = 0; i < per_thread; ++i) {
+            EXPECT_EQ(sequence[i], i);
+        }
+    }
+}
+
+TEST_F(SequenceCounterTest, SharedStreamAcrossThreadsHasNoGapsOrDuplicates) {
+    constexpr int num_threads = 8;
+    constexpr uint32_t per_thread = 1000;
+    SequenceStreams streams;
+    std::vector<std::vector<uint32_t>> results(num_threads);
+    std::vector<std::thread> threads;
+
+    for (int t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&, t]() {
+            for (uint32_t i = 0; i < per_thread; ++i) {
+                results[t].push_back(streams.next("imu_shared"));
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    std::vector<uint32_t> all;
+    for (const auto& sequence : results) {
+        all.insert(all.end(), sequence.begin(), sequence.end());
+    }
+    std::sort(all.begin(), all.end());
+    for (uint32_t i = 0; i < all.size(); ++i) {
+        ASSERT_EQ(all[i], i);
+    }
+}
+
 // ============================================================================
 // Main
 // ============================================================================
@@ -0,0 +1,185 @@
+/**
+ * @file test_serialization.cpp
+ * @brief Unit tests for descriptor-generated serializers
+ * @author Jo, SeungHyeon (Jo,SH)
+ * @date 2025
+ *
+ * Focuses on:
+ * - Compile-time layout facts derived from fields()
+ * - Wire format matching the documented byte layout
+ * - Types whose fixed fields are not contiguous in memory
+ * - Rejection of truncated buffers and in-place deserialization
+ */
+
+#include <gtest/gtest.h>
+#include "sensorstreamkit/core/message.hpp"
+#include <cstring>
+#include <vector>
+
+using namespace sensorstreamkit::core;
+
+namespace {
+
+/**
+ * @brief Declarative test type: padding between status and range_mm
+ *        forces the per-field copy path for the second fixed run
+ */
+struct PaddedSample {
+    uint64_t timestamp_ns{0};
+    std::string label;
+    uint8_t status{0};
+    uint32_t range_mm{0};
+    uint16_t quality{0};
+
+    static constexpr auto fields() noexcept {
+        return std::tuple{field<&PaddedSample::timestamp_ns>, field<&PaddedSample::label>,
+                          field<&PaddedSample::status>, field<&PaddedSample::range_mm>,
+                          field<&PaddedSample::quality>};
+    }
+};
+
+template <typename U>
+void append_raw(std::vector<uint8_t>& buffer, const U& value) {
+    const auto* bytes = reinterpret_cast<const uint8_t*>(&value);
+    buffer.insert(buffer.end(), bytes, bytes + sizeof(U));
+}
+
+void append_string(std::vector<uint8_t>& buffer, std::string_view str) {
+    append_raw(buffer, static_cast<uint32_t>(str.size()));
+    buffer.insert(buffer.end(), str.begin(), str.end());
+}
+
+}  // namespace
+
+// ============================================================================
+// Test Fixture
+// ============================================================================
+
+class SerializationTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        imu_data_ = ImuData{
+            .sensor_id_ = "imu_main",
+            .timestamp_ns_ = 9876543210987654321ULL,
+            .accel_x = 1.5f,
+            .accel_y = -2.3f,
+            .accel_z = 9.8f,
+            .gyro_x = 0.1f,
+            .gyro_y = -0.05f,
+            .gyro_z = 0.02f
+        };
+
+        camera_data_ = CameraFrameData{
+            .sensor_id_ = "camera_front",
+            .timestamp_ns_ = 1234567890123456789ULL,
+            .frame_id = 42,
+            .width = 1920,
+            .height = 1080,
+            .encoding = "RGB8"
+        };
+    }
+
+    ImuData imu_data_;
+    CameraFrameData camera_data_;
+};
+
+// ============================================================================
+// Layout Tests
+// ============================================================================
+
+static_assert(FieldLayout<MessageHeader>::fixed_bytes == MessageHeader::serialized_size());
+static_assert(FieldLayout<ImuData>::fixed_bytes == sizeof(uint64_t) + 6 * sizeof(float));
+static_assert(FieldLayout<CameraFrameData>::run_end(1) == 5);
+static_assert(FieldLayout<LidarScanData>::run_bytes(1, 4) == 16);
+static_assert(!FieldLayout<PaddedSample>::is_fixed[1]);
+
+TEST_F(SerializationTest, SizeCountsStringBytes) {
+    EXPECT_EQ(serialization::serialized_size(imu_data_),
+              sizeof(uint32_t) + imu_data_.sensor_id_.size() + FieldLayout<ImuData>::fixed_bytes);
+
+    imu_data_.sensor_id_.clear();
+    EXPECT_EQ(serialization::serialized_size(imu_data_), sizeof(uint32_t) + FieldLayout<ImuData>::fixed_bytes);
+}
+
+// ============================================================================
+// Wire Format Tests
+// ============================================================================
+
+TEST_F(SerializationTest, ImuMatchesDocumentedLayout) {
+    std::vector<uint8_t> expected;
+    append_string(expected, imu_data_.sensor_id_);
+    append_raw(expected, imu_data_.timestamp_ns_);
+    for (float v : {imu_data_.accel_x, imu_data_.accel_y, imu_data_.accel_z,
+                    imu_data_.gyro_x, imu_data_.gyro_y, imu_data_.gyro_z}) {
+        append_raw(expected, v);
+    }
+
+    std::vector<uint8_t> actual(imu_data_.serialized_size());
+    ASSERT_EQ(imu_data_.serialize_into(actual), expected.size());
+    EXPECT_EQ(actual, expected);
+}
+
+TEST_F(SerializationTest, CameraMatchesDocumentedLayout) {
+    std::vector<uint8_t> expected;
+    append_string(expected, camera_data_.sensor_id_);
+    append_raw(expected, camera_data_.timestamp_ns_);
+    append_raw(expected, camera_data_.frame_id);
+    append_raw(expected, camera_data_.width);
+    append_raw(expected, camera_data_.height);
+    append_string(expected, camera_data_.encoding);
+
+    std::vector<uint8_t> actual;
+    camera_data_.serialize(actual);
+    EXPECT_EQ(actual, expected);
+}
+
+TEST_F(SerializationTest, NonContiguousFieldsRoundTrip) {
+    PaddedSample sample{.timestamp_ns = 77, .label = "near", .status = 3, .range_mm = 123456, .quality = 9};
+
+    std::vector<uint8_t> buffer(serialization::serialized_size(sample));
+    ASSERT_EQ(serialization::serialize_into(sample, buffer), buffer.size());
+
+    // Packed on the wire: no padding bytes between status and range_mm
+    EXPECT_EQ(buffer.size(), sizeof(uint64_t) + sizeof(uint32_t) + 4 + 1 + 4 + 2);
+
+    auto restored = serialization::deserialize<PaddedSample>(buffer);
+    ASSERT_TRUE(restored.has_value());
+    EXPECT_EQ(restored->timestamp_ns, 77u);
+    EXPECT_EQ(restored->label, "near");
+    EXPECT_EQ(restored->status, 3);
+    EXPECT_EQ(restored->range_mm, 123456u);
+    EXPECT_EQ(restored->quality, 9);
+}
+
+// ============================================================================
+// Validation Tests
+// ============================================================================
+
+TEST_F(SerializationTest, SerializeIntoRejectsSmallBuffer) {
+    std::vector<uint8_t> buffer(imu_data_.serialized_size() - 1);
+    EXPECT_EQ(serialization::serialize_into(imu_data_, buffer), 0u);
+}
+
+TEST_F(SerializationTest, RejectsEveryTruncation) {
+    std::vector<uint8_t> buffer;
+    camera_data_.serialize(buffer);
+
+    for (size_t len = 0; len < buffer.size(); ++len) {
+        CameraFrameData target;
+        EXPECT_FALSE(serialization::deserialize_into(ConstPayload(buffer.data(), len), target))
+            << "length " << len;
+    }
+}
+
+TEST_F(SerializationTest, DeserializeIntoOverwritesExisting) {
+    std::vector<uint8_t> buffer;
+    imu_data_.serialize(buffer);
+
+    ImuData target{.sensor_id_ = "stale_identifier", .timestamp_ns_ = 1, .accel_x = 42.0f};
+    ASSERT_TRUE(serialization::deserialize_into(buffer, target));
+
+    EXPECT_EQ(target.sensor_id_, imu_data_.sensor_id_);
+    EXPECT_EQ(target.timestamp_ns_, imu_data_.timestamp_ns_);
+    EXPECT_FLOAT_EQ(target.accel_x, imu_data_.accel_x);
+    EXPECT_FLOAT_EQ(target.gyro_z, imu_data_.gyro_z);
+}
@@ -0,0 +1,228 @@
+/**
+ * @file test_string_registry.cpp
+ * @brief Unit tests for StringRegistry and interned wire strings
+ * @author Jo, SeungHyeon (Jo,SH)
+ * @date 2025
+ *
+ * Focuses on:
+ * - Id assignment, lookup, clear() and the announcement round-trip
+ * - Rejection of conflicting or malformed announcements
+ * - Interned sensor ids/encodings in Message<T> and MessageView<T>
+ * - Readers without the registry rejecting interned data
+ */
+
+#include <gtest/gtest.h>
+#include "sensorstreamkit/core/message.hpp"
+#include "sensorstreamkit/core/message_view.hpp"
+#include "sensorstreamkit/core/string_registry.hpp"
+#include <vector>
+
+using namespace sensorstreamkit::core;
+
+// ============================================================================
+// Test Fixture
+// ============================================================================
+
+class StringRegistryTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        imu_data_ = ImuData{
+            .sensor_id_ = "vehicle_07/imu_front_left_chassis",
+            .timestamp_ns_ = 1234567890,
+            .accel_x = 0.1f,
+            .accel_y = 0.2f,
+            .accel_z = 9.81f,
+            .gyro_x = 0.01f,
+            .gyro_y = 0.02f,
+            .gyro_z = 0.03f
+        };
+
+        camera_data_ = CameraFrameData{
+            .sensor_id_ = "vehicle_07/camera_front_wide_angle",
+            .timestamp_ns_ = 1234567890,
+            .frame_id = 42,
+            .width = 1920,
+            .height = 1080,
+            .encoding = "BAYER_RGGB8"
+        };
+
+        ASSERT_TRUE(registry_.intern(imu_data_.sensor_id_));
+        ASSERT_TRUE(registry_.intern(camera_data_.sensor_id_));
+        ASSERT_TRUE(registry_.intern(camera_data_.encoding));
+    }
+
+    StringRegistry registry_;
+    ImuData imu_data_;
+    CameraFrameData camera_data_;
+};
+
+// ============================================================================
+// Registry Tests
+// ============================================================================
+
+TEST_F(StringRegistryTest, AssignsDenseIdsInInternOrder) {
+    EXPECT_EQ(registry_.size(), 3u);
+    EXPECT_EQ(registry_.id_of(imu_data_.sensor_id_), 0u);
+    EXPECT_EQ(registry_.id_of(camera_data_.sensor_id_), 1u);
+    EXPECT_EQ(registry_.id_of(camera_data_.encoding), 2u);
+    EXPECT_EQ(registry_.lookup(2), "BAYER_RGGB8");
+
+    // Re-interning returns the existing id
+    EXPECT_EQ(registry_.intern(camera_data_.encoding), 2u);
+    EXPECT_EQ(registry_.size(), 3u);
+}
+
+TEST_F(StringRegistryTest, UnknownStringsAndIds) {
+    EXPECT_FALSE(registry_.id_of("lidar_roof").has_value());
+    EXPECT_FALSE(registry_.lookup(3).has_value());
+}
+
+TEST_F(StringRegistryTest, LookupViewsStayValidAsRegistryGrows) {
+    const auto first = registry_.lookup(0);
+    ASSERT_TRUE(first.has_value());
+    const char* storage = first->data();
+
+    for (int i = 0; i < 1000; ++i) {
+        registry_.intern("sensor_" + std::to_string(i));
+    }
+    EXPECT_EQ(registry_.lookup(0)->data(), storage);
+}
+
+TEST_F(StringRegistryTest, ClearStartsIdsOver) {
+    registry_.clear();
+    EXPECT_TRUE(registry_.empty());
+    EXPECT_FALSE(registry_.id_of(imu_data_.sensor_id_).has_value());
+    EXPECT_FALSE(registry_.lookup(0).has_value());
+
+    EXPECT_EQ(registry_.intern("lidar_roof"), 0u);
+    EXPECT_EQ(registry_.lookup(0), "lidar_roof");
+}
+
+TEST_F(StringRegistryTest, AnnouncementRoundTrip) {
+    std::vector<uint8_t> announcement;
+    registry_.serialize(announcement);
+
+    StringRegistry received;
+    ASSERT_TRUE(received.merge(announcement));
+    ASSERT_EQ(received.size(), registry_.size());
+    for (uint32_t id = 0; id < registry_.size(); ++id) {
+        EXPECT_EQ(received.lookup(id), registry_.lookup(id));
+    }
+
+    // Re-announcing the same or a grown registry is accepted
+    EXPECT_TRUE(received.merge(announcement));
+    registry_.intern("lidar_roof");
+    announcement.clear();
+    registry_.serialize(announcement);
+    EXPECT_TRUE(received.merge(announcement));
+    EXPECT_EQ(received.id_of("lidar_roof"), 3u);
+}
+
+TEST_F(StringRegistryTest, MergeRejectsConflictingIds) {
+    StringRegistry other;
+    other.intern("imu_rear");
+    std::vector<uint8_t> announcement;
+    other.serialize(announcement);
+
+    EXPECT_FALSE(registry_.merge(announcement));
+    EXPECT_EQ(registry_.size(), 3u);
+    EXPECT_EQ(registry_.lookup(0), imu_data_.sensor_id_);
+}
+
+TEST_F(StringRegistryTest, MergeRejectsMalformedAnnouncement) {
+    std::vector<uint8_t> announcement;
+    registry_.serialize(announcement);
+
+    StringRegistry received;
+    const std::span<const uint8_t> full(announcement);
+    EXPECT_FALSE(received.merge(full.first(2)));
+    EXPECT_FALSE(received.merge(full.first(announcement.size() - 1)));
+    EXPECT_TRUE(received.empty());
+}
+
+// ============================================================================
+// Interned Serialization Tests
+// ============================================================================
+
+TEST_F(StringRegistryTest, InternedImuRoundTrip) {
+    Message<ImuData> original(imu_data_);
+    std::vector<uint8_t> buffer(original.serialized_size(registry_));
+    ASSERT_EQ(original.serialize_into(buffer, registry_), buffer.size());
+
+    // The 4-byte prefix alone replaces the length-prefixed string
+    EXPECT_EQ(buffer.size(), original.serialized_size() - imu_data_.sensor_id_.size());
+
+    auto result = Message<ImuData>::deserialize(buffer, registry_);
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(result->header().sequence_number, original.header().sequence_number);
+    EXPECT_EQ(result->payload().sensor_id_, imu_data_.sensor_id_);
+    EXPECT_FLOAT_EQ(result->payload().accel_z, imu_data_.accel_z);
+    EXPECT_FLOAT_EQ(result->payload().gyro_z, imu_data_.gyro_z);
+}
+
+TEST_F(StringRegistryTest, InternedCameraInternsBothStrings) {
+    Message<CameraFrameData> original(camera_data_);
+    std::vector<uint8_t> buffer(original.serialized_size(registry_));
+    ASSERT_EQ(original.serialize_into(buffer, registry_), buffer.size());
+
+    EXPECT_EQ(buffer.size(), original.serialized_size() - camera_data_.sensor_id_.size() -
+                                 camera_data_.encoding.size());
+
+    Message<CameraFrameData> target;
+    ASSERT_TRUE(Message<CameraFrameData>::deserialize_into(buffer, target, registry_));
+    EXPECT_EQ(target.payload().sensor_id_, camera_data_.sensor_id_);
+    EXPECT_EQ(target.payload().encoding, camera_data_.encoding);
+    EXPECT_EQ(target.payload().width, camera_data_.width);
+}
+
+TEST_F(StringRegistryTest, StringsNotInRegistryAreSentInline) {
+    imu_data_.sensor_id_ = "imu_not_registered";
+    Message<ImuData> original(imu_data_);
+
+    std::vector<uint8_t> plain;
+    original.serialize(plain);
+    std::vector<uint8_t> buffer(original.serialized_size(registry_));
+    original.serialize_into(buffer, registry_);
+    EXPECT_EQ(buffer, plain);
+}
+
+TEST_F(StringRegistryTest, ReaderWithoutRegistryRejectsInternedData) {
+    Message<ImuData> original(imu_data_);
+    std::vector<uint8_t> buffer(original.serialized_size(registry_));
+    original.serialize_into(buffer, registry_);
+
+    EXPECT_FALSE(Message<ImuData>::deserialize(buffer).has_value());
+    EXPECT_FALSE(MessageView<ImuData>::from(buffer).has_value());
+
+    StringRegistry empty;
+    EXPECT_FALSE(Message<ImuData>::deserialize(buffer, empty).has_value());
+}
+
+TEST_F(StringRegistryTest, SerializeIntoTooSmallWritesNothing) {
+    Message<ImuData> original(imu_data_);
+    std::vector<uint8_t> buffer(original.serialized_size(registry_) - 1, 0xAB);
+
+    EXPECT_EQ(original.serialize_into(buffer, registry_), 0u);
+    for (uint8_t byte : buffer) {
+        EXPECT_EQ(byte, 0xAB);
+    }
+}
+
+TEST_F(StringRegistryTest, MessageViewResolvesInternedStrings) {
+    Message<CameraFrameData> original(camera_data_);
+    std::vector<uint8_t> buffer(original.serialized_size(registry_));
+    original.serialize_into(buffer, registry_);
+
+    auto view = MessageView<CameraFrameData>::from(buffer, &registry_);
+    ASSERT_TRUE(view.has_value());
+    EXPECT_EQ(view->payload().sensor_id(), camera_data_.sensor_id_);
+    EXPECT_EQ(view->payload().encoding(), camera_data_.encoding);
+    EXPECT_EQ(view->payload().height(), camera_data_.height);
+
+    // Interned strings point into the registry, not the buffer
+    EXPECT_EQ(view->payload().sensor_id().data(), registry_.lookup(1)->data());
+
+    auto owned = view->to_message();
+    ASSERT_TRUE(owned.has_value());
+    EXPECT_EQ(owned->payload().encoding, camera_data_.encoding);
+}
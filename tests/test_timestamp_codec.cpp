@@ -0,0 +1,127 @@
+/**
+ * @file test_timestamp_codec.cpp
+ * @brief Unit tests for the line-plus-residual timestamp codec
+ * @author Jo, SeungHyeon (Jo,SH)
+ * @date 2025
+ *
+ * Focuses on:
+ * - Residual width chosen for regular, jittery and irregular runs
+ * - Exact round-trip, including unordered and wrapping timestamps
+ * - Rejection of truncated input and invalid widths
+ */
+
+#include <gtest/gtest.h>
+#include "sensorstreamkit/core/timestamp_codec.hpp"
+#include <limits>
+#include <random>
+#include <vector>
+
+using namespace sensorstreamkit::core;
+
+// ============================================================================
+// Test Fixture
+// ============================================================================
+
+class TimestampCodecTest : public ::testing::Test {
+protected:
+    // 1 kHz from t = 1 s, each sample off by up to +/- jitter_ns
+    static std::vector<uint64_t> periodic(size_t count, int64_t jitter_ns) {
+        std::mt19937_64 rng(42);
+        std::uniform_int_distribution<int64_t> jitter(-jitter_ns, jitter_ns);
+        std::vector<uint64_t> timestamps(count);
+        for (size_t i = 0; i < count; ++i) {
+            timestamps[i] = 1'000'000'000ull + i * 1'000'000ull + static_cast<uint64_t>(jitter(rng));
+        }
+        return timestamps;
+    }
+
+    static timestamp_codec::Plan round_trip(const std::vector<uint64_t>& timestamps) {
+        const auto plan = timestamp_codec::plan(timestamps);
+        std::vector<uint8_t> buffer(timestamp_codec::encoded_size(plan, timestamps.size()));
+        const uint8_t* end = timestamp_codec::encode(buffer.data(), plan, timestamps);
+        EXPECT_EQ(end, buffer.data() + buffer.size());
+
+        std::vector<uint64_t> decoded(timestamps.size());
+        size_t offset = 0;
+        EXPECT_TRUE(timestamp_codec::decode(buffer, offset, decoded));
+        EXPECT_EQ(offset, buffer.size());
+        EXPECT_EQ(decoded, timestamps);
+        return plan;
+    }
+};
+
+// ============================================================================
+// Width Selection Tests
+// ============================================================================
+
+TEST_F(TimestampCodecTest, RegularRunNeedsNoResiduals) {
+    const auto plan = round_trip(periodic(1000, 0));
+    EXPECT_EQ(plan.width, 0u);
+    EXPECT_EQ(plan.base, 1'000'000'000ull);
+    EXPECT_EQ(plan.period_q16 >> 16, 1'000'000ull);
+}
+
+TEST_F(TimestampCodecTest, WidthFollowsJitter) {
+    EXPECT_EQ(round_trip(periodic(1000, 50)).width, 1u);
+    EXPECT_EQ(round_trip(periodic(1000, 8'000)).width, 2u);
+    EXPECT_EQ(round_trip(periodic(1000, 500'000)).width, 4u);
+}
+
+TEST_F(TimestampCodecTest, NonIntegerPeriodDoesNotDrift) {
+    // 3 samples every 1000 ns: period 333.33 ns
+    std::vector<uint64_t> timestamps(30'000);
+    for (size_t i = 0; i < timestamps.size(); ++i) {
+        timestamps[i] = 5'000 + i * 1000 / 3;
+    }
+    EXPECT_LE(round_trip(timestamps).width, 1u);
+}
+
+// ============================================================================
+// Exactness Tests
+// ============================================================================
+
+TEST_F(TimestampCodecTest, EmptyAndSingleTimestamp) {
+    EXPECT_EQ(round_trip({}).width, 0u);
+    const auto plan = round_trip({123'456'789ull});
+    EXPECT_EQ(plan.width, 0u);
+    EXPECT_EQ(plan.period_q16, 0u);
+}
+
+TEST_F(TimestampCodecTest, IrregularRunsRoundTripExactly) {
+    constexpr uint64_t kMax = std::numeric_limits<uint64_t>::max();
+    EXPECT_EQ(round_trip({50, 10, 40, 20, 30}).width, 1u);
+    EXPECT_EQ(round_trip({0, kMax, 0, kMax}).width, 1u);
+    EXPECT_EQ(round_trip({0, kMax / 2, 7, kMax / 3, 9}).width, 8u);
+    // Span too long for the fixed-point grid falls back to residuals from base
+    EXPECT_EQ(round_trip({1, 1ull << 50, 1ull << 52}).period_q16, 0u);
+}
+
+// ============================================================================
+// Validation Tests
+// ============================================================================
+
+TEST_F(TimestampCodecTest, RejectsTruncatedInput) {
+    const auto timestamps = periodic(100, 20'000);
+    const auto plan = timestamp_codec::plan(timestamps);
+    std::vector<uint8_t> buffer(timestamp_codec::encoded_size(plan, timestamps.size()));
+    timestamp_codec::encode(buffer.data(), plan, timestamps);
+
+    std::vector<uint64_t> decoded(timestamps.size());
+    for (size_t cut : {size_t{1}, size_t{2}, buffer.size() - timestamp_codec::Plan::kHeaderBytes + 1}) {
+        size_t offset = 0;
+        EXPECT_FALSE(timestamp_codec::decode(ConstPayload(buffer).first(buffer.size() - cut), offset, decoded));
+        EXPECT_EQ(offset, 0u);
+    }
+}
+
+TEST_F(TimestampCodecTest, RejectsInvalidWidth) {
+    const auto timestamps = periodic(10, 100);
+    const auto plan = timestamp_codec::plan(timestamps);
+    std::vector<uint8_t> buffer(timestamp_codec::encoded_size(plan, timestamps.size()) + 64);
+    timestamp_codec::encode(buffer.data(), plan, timestamps);
+
+    std::vector<uint64_t> decoded(timestamps.size());
+    buffer[timestamp_codec::Plan::kHeaderBytes - 1] = 3;
+    size_t offset = 0;
+    EXPECT_FALSE(timestamp_codec::decode(buffer, offset, decoded));
+}
@@ -0,0 +1,172 @@
+/**
+ * @file test_tsc_clock.cpp
+ * @brief Unit tests for TscClock and Timestamp clock source selection
+ * @author Jo, SeungHyeon (Jo,SH)
+ * @date 2025
+ *
+ * Focuses on:
+ * - Fallback to steady_clock when the TSC is unusable or uncalibrated
+ * - Agreement with steady_clock (same epoch) before and after re-anchoring
+ * - Monotonic readings on one thread and across threads, through re-anchoring
+ *
+ * Tests that need the TSC are skipped on CPUs without an invariant TSC.
+ */
+
+#include <gtest/gtest.h>
+#include "sensorstreamkit/core/message.hpp"
+#include "sensorstreamkit/core/tsc_clock.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+using namespace sensorstreamkit::core;
+using namespace std::chrono_literals;
+
+namespace {
+
+// Generous bound: the calibration window is short and CI machines are noisy
+constexpr int64_t kToleranceNs = 500'000;
+
+int64_t offset_from_steady(uint64_t ns) {
+    return static_cast<int64_t>(ns) - static_cast<int64_t>(detail::steady_clock_ns());
+}
+
+}  // namespace
+
+// ============================================================================
+// Test Fixture
+// ============================================================================
+
+class TscClockTest : public ::testing::Test {
+protected:
+    void TearDown() override {
+        Timestamp::set_clock_source(ClockSource::SteadyClock);
+    }
+};
+
+// ============================================================================
+// Fallback Tests
+// ============================================================================
+
+TEST_F(TscClockTest, DefaultSourceIsSteadyClock) {
+    EXPECT_EQ(Timestamp::clock_source(), ClockSource::SteadyClock);
+}
+
+TEST_F(TscClockTest, UncalibratedClockFallsBackToSteadyClock) {
+    if (TscClock::is_calibrated()) {
+        GTEST_SKIP() << "Already calibrated by an earlier test";
+    }
+    EXPECT_LT(std::abs(offset_from_steady(TscClock::now_ns())), kToleranceNs);
+}
+
+TEST_F(TscClockTest, SelectingTscReportsTheSourceInEffect) {
+    const ClockSource selected = Timestamp::set_clock_source(ClockSource::Tsc);
+
+    if (TscClock::available()) {
+        EXPECT_EQ(selected, ClockSource::Tsc);
+        EXPECT_TRUE(TscClock::is_calibrated());
+    } else {
+        EXPECT_EQ(selected, ClockSource::SteadyClock);
+        EXPECT_FALSE(TscClock::calibrate());
+    }
+    EXPECT_EQ(Timestamp::clock_source(), selected);
+}
+
+// ============================================================================
+// Calibrated Clock Tests
+// ============================================================================
+
+TEST_F(TscClockTest, TracksSteadyClock) {
+    if (!TscClock::calibrate()) {
+        GTEST_SKIP() << "No invariant TSC";
+    }
+
+    EXPECT_LT(std::abs(offset_from_steady(TscClock::now_ns())), kToleranceNs);
+    std::this_thread::sleep_for(50ms);
+    EXPECT_LT(std::abs(offset_from_steady(TscClock::now_ns())), kToleranceNs);
+}
+
+TEST_F(TscClockTest, TimestampNowUsesSelectedSource) {
+    if (Timestamp::set_clock_source(ClockSource::Tsc) != ClockSource::Tsc) {
+        GTEST_SKIP() << "No invariant TSC";
+    }
+
+    const Timestamp tsc_time = Timestamp::now();
+    Timestamp::set_clock_source(ClockSource::SteadyClock);
+    const Timestamp steady_time = Timestamp::now();
+
+    // Same epoch, so the two readings are directly comparable
+    const int64_t diff = static_cast<int64_t>(steady_time.nanoseconds()) -
+                         static_cast<int64_t>(tsc_time.nanoseconds());
+    EXPECT_LT(std::abs(diff), kToleranceNs);
+}
+
+TEST_F(TscClockTest, ReadingsAreMonotonicOnOneThread) {
+    if (!TscClock::calibrate()) {
+        GTEST_SKIP() << "No invariant TSC";
+    }
+
+    uint64_t previous = TscClock::now_ns();
+    for (int i = 0; i < 100'000; ++i) {
+        const uint64_t current = TscClock::now_ns();
+        ASSERT_GE(current, previous) << "at iteration " << i;
+        previous = current;
+    }
+}
+
+TEST_F(TscClockTest, ReadingsAreMonotonicAcrossThreads) {
+    if (!TscClock::calibrate()) {
+        GTEST_SKIP() << "No invariant TSC";
+    }
+
+    // Each reader checks that it never sees less than a value another
+    // thread has already returned, while calibrate() keeps re-anchoring
+    std::atomic<uint64_t> latest{TscClock::now_ns()};
+    std::atomic<bool> stop{false};
+    std::atomic<uint64_t> backwards{0};
+    std::vector<std::thread> readers;
+    for (int t = 0; t < 4; ++t) {
+        readers.emplace_back([&] {
+            while (!stop.load(std::memory_order_relaxed)) {
+                const uint64_t seen = latest.load(std::memory_order_acquire);
+                const uint64_t current = TscClock::now_ns();
+                if (current < seen) backwards.fetch_add(1, std::memory_order_relaxed);
+
+                uint64_t expected = seen;
+                while (expected < current &&
+                       !latest.compare_exchange_weak(expected, current, std::memory_order_acq_rel)) {
+                }
+            }
+        });
+    }
+
+    for (int i = 0; i < 5; ++i) {
+        ASSERT_TRUE(TscClock::calibrate());
+    }
+    stop.store(true, std::memory_order_relaxed);
+    for (auto& reader : readers) {
+        reader.join();
+    }
+    EXPECT_EQ(backwards.load(), 0u);
+}
+
+TEST_F(TscClockTest, StaysContinuousAcrossRecalibration) {
+    if (!TscClock::calibrate()) {
+        GTEST_SKIP() << "No invariant TSC";
+    }
+
+    // Run past the re-anchor point and check for steps and drift on the way
+    const auto deadline = std::chrono::steady_clock::now() + TscClock::kRecalibrationInterval + 300ms;
+    uint64_t previous = TscClock::now_ns();
+    while (std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(1ms);
+        const uint64_t current = TscClock::now_ns();
+        ASSERT_GE(current, previous);
+        ASSERT_LT(current - previous, static_cast<uint64_t>(50'000'000)) << "clock stepped";
+        previous = current;
+    }
+    EXPECT_LT(std::abs(offset_from_steady(TscClock::now_ns())), kToleranceNs);
+}
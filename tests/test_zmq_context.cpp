@@ -0,0 +1,115 @@
+/**
+ * @file test_zmq_context.cpp
+ * @brief Unit tests for ZmqContext
+ * @author Jo, SeungHyeon (Jo,SH)
+ * @date 2025
+ *
+ * Focuses on:
+ * - I/O thread settings applied to the context
+ * - The process-wide shared context and configure_shared()
+ * - Publishers, subscribers and brokers sharing one context
+ */
+
+#include <gtest/gtest.h>
+#include "sensorstreamkit/transport/zmq_context.hpp"
+#include "sensorstreamkit/transport/zmq_transport.hpp"
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using namespace sensorstreamkit::transport;
+using namespace std::chrono_literals;
+
+// ============================================================================
+// Test Fixture
+// ============================================================================
+
+class ZmqContextTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        static int id = 0;
+        endpoint_ = "inproc://zmq_context_test_" + std::to_string(id++);
+    }
+
+    std::string endpoint_;
+};
+
+// ============================================================================
+// Context Tests
+// ============================================================================
+
+TEST_F(ZmqContextTest, AppliesIoThreadCount) {
+    ZmqContext context(ContextConfig{.io_threads = 3, .io_thread_cpus = {0}});
+    EXPECT_EQ(context.io_threads(), 3);
+    EXPECT_EQ(context.config().io_thread_cpus, std::vector<int>{0});
+}
+
+TEST_F(ZmqContextTest, SharedContextIsConfiguredOnce) {
+    ASSERT_TRUE(ZmqContext::configure_shared(ContextConfig{.io_threads = 2}));
+
+    auto shared = ZmqContext::shared();
+    ASSERT_NE(shared, nullptr);
+    EXPECT_EQ(shared->io_threads(), 2);
+    EXPECT_EQ(ZmqContext::shared(), shared);
+
+    // Too late: sockets may already run on it
+    EXPECT_FALSE(ZmqContext::configure_shared(ContextConfig{.io_threads = 4}));
+    EXPECT_EQ(ZmqContext::shared()->io_threads(), 2);
+}
+
+// ============================================================================
+// Sharing Tests
+// ============================================================================
+
+TEST_F(ZmqContextTest, PublisherAndSubscriberShareContext) {
+    auto context = std::make_shared<ZmqContext>(ContextConfig{.io_threads = 2});
+
+    // inproc:// only connects sockets of the same context
+    ZmqPublisher publisher(PublisherConfig{.endpoint = endpoint_, .context = context, .io_affinity = 0b01});
+    ASSERT_TRUE(publisher.bind());
+    ZmqSubscriber subscriber(SubscriberConfig{.endpoint = endpoint_, .context = context, .io_affinity = 0b10});
+    ASSERT_TRUE(subscriber.connect());
+    ASSERT_TRUE(subscriber.subscribe("imu"));
+    std::this_thread::sleep_for(50ms);
+
+    std::vector<uint8_t> sent = {0xDE, 0xAD, 0xBE, 0xEF};
+    ASSERT_TRUE(publisher.publish_raw("imu", sent));
+    auto received = subscriber.receive_raw();
+    ASSERT_TRUE(received.has_value());
+    EXPECT_EQ(*received, sent);
+}
+
+TEST_F(ZmqContextTest, ContextOutlivesItsOwnerWhileSocketsRemain) {
+    std::weak_ptr<ZmqContext> weak;
+    {
+        auto context = std::make_shared<ZmqContext>();
+        weak = context;
+        ZmqPublisher publisher(PublisherConfig{.endpoint = endpoint_, .context = context});
+        context.reset();
+        EXPECT_FALSE(weak.expired());
+        ASSERT_TRUE(publisher.bind());
+        EXPECT_TRUE(publisher.publish_raw("imu", std::vector<uint8_t>{1, 2, 3}));
+    }
+    EXPECT_TRUE(weak.expired());
+}
+
+TEST_F(ZmqContextTest, MovedPublisherKeepsContext) {
+    auto context = std::make_shared<ZmqContext>();
+    ZmqPublisher publisher(PublisherConfig{.endpoint = endpoint_, .context = context});
+    const long references = context.use_count();
+    ZmqPublisher moved(std::move(publisher));
+    EXPECT_EQ(context.use_count(), references);
+    ASSERT_TRUE(moved.bind());
+    EXPECT_TRUE(moved.publish_raw("imu", std::vector<uint8_t>{1, 2, 3}));
+}
+
+TEST_F(ZmqContextTest, BrokerInSharedContext) {
+    auto context = std::make_shared<ZmqContext>();
+    ZmqTransport broker(context);
+    EXPECT_EQ(context.use_count(), 2);
+
+    std::thread broker_thread([&] { broker.run_broker(endpoint_ + "_in", endpoint_ + "_out"); });
+    std::this_thread::sleep_for(50ms);
+    broker.shutdown();
+    broker_thread.join();
+}
@@ -11,6 +11,7 @@
  */
 
 #include <gtest/gtest.h>
+#include <algorithm>
 #include <thread>
 #include <chrono>
 #include <vector>
@@ -150,6 +151,28 @@ TEST_F(ZmqPublisherTest, PublishRawAfterBindSucceeds) {
     EXPECT_EQ(publisher.messages_sent(), 1);
 }
 
+TEST_F(ZmqPublisherTest, PublishRawAfterStopRequestedFails) {
+    ZmqPublisher publisher(config_);
+    ASSERT_TRUE(publisher.bind());
+
+    // Cancellation wins even though the socket could take the message at once
+    std::stop_source stop;
+    stop.request_stop();
+    std::vector<uint8_t> data = {1, 2, 3, 4};
+    EXPECT_FALSE(publisher.publish_raw("test_topic", data, stop.get_token()));
+    EXPECT_EQ(publisher.messages_sent(), 0);
+}
+
+TEST_F(ZmqPublisherTest, PublishRawWithZeroTimeoutSendsWhenWritable) {
+    config_.send_timeout_ms = 0;
+    ZmqPublisher publisher(config_);
+    ASSERT_TRUE(publisher.bind());
+
+    std::vector<uint8_t> data = {1, 2, 3, 4};
+    EXPECT_TRUE(publisher.publish_raw("test_topic", data));
+    EXPECT_EQ(publisher.messages_sent(), 1);
+}
+
 TEST_F(ZmqPublisherTest, PublishMultipleMessagesIncrementsCounter) {
     ZmqPublisher publisher(config_);
     ASSERT_TRUE(publisher.bind());
@@ -161,6 +184,37 @@ TEST_F(ZmqPublisherTest, PublishMultipleMessagesIncrementsCounter) {
     EXPECT_EQ(publisher.messages_sent(), 10);
 }
 
+TEST_F(ZmqPublisherTest, PublishBatchCountsOnce) {
+    ZmqPublisher publisher(config_);
+    ASSERT_TRUE(publisher.bind());
+
+    std::vector<uint8_t> data = {1, 2, 3, 4};
+    const std::vector<OutgoingMessage> batch = {{"a", data}, {"b", data}, {"c", {}}};
+    EXPECT_EQ(publisher.publish_batch(batch), 3u);
+    EXPECT_EQ(publisher.publish_batch(std::span<const OutgoingMessage>{}), 0u);
+    EXPECT_EQ(publisher.messages_sent(), 3);
+}
+
+TEST_F(ZmqPublisherTest, PublishBatchWithoutBindSendsNothing) {
+    ZmqPublisher publisher(config_);
+
+    std::vector<uint8_t> data = {1, 2, 3, 4};
+    const std::vector<OutgoingMessage> batch = {{"a", data}, {"b", data}};
+    EXPECT_EQ(publisher.publish_batch(batch), 0u);
+    EXPECT_EQ(publisher.messages_sent(), 0);
+}
+
+TEST_F(ZmqPublisherTest, PublishBatchAfterStopRequestedSendsNothing) {
+    ZmqPublisher publisher(config_);
+    ASSERT_TRUE(publisher.bind());
+
+    std::stop_source stop;
+    stop.request_stop();
+    std::vector<Message<ImuData>> messages(4);
+    EXPECT_EQ(publisher.publish_batch("imu", messages, stop.get_token()), 0u);
+    EXPECT_EQ(publisher.messages_sent(), 0);
+}
+
 TEST_F(ZmqPublisherTest, PublishTypedCameraMessage) {
     ZmqPublisher publisher(config_);
     ASSERT_TRUE(publisher.bind());
@@ -212,6 +266,16 @@ TEST_F(ZmqPublisherTest, MoveConstructorResetsSource) {
     EXPECT_EQ(publisher2.messages_sent(), 1);
 }
 
+TEST_F(ZmqPublisherTest, MovedFromPublisherRejectsLargeFrames) {
+    ZmqPublisher publisher1(config_);
+    ZmqPublisher publisher2(std::move(publisher1));
+
+    // The moved-from pool serves nothing; the frame must still be full size
+    std::vector<uint8_t> data(64 * 1024, 0x5A);
+    EXPECT_FALSE(publisher1.publish_raw("topic", data));
+    EXPECT_EQ(publisher1.messages_sent(), 0);
+}
+
 TEST_F(ZmqPublisherTest, MoveAssignmentOperator) {
     ZmqPublisher publisher1(config_);
     ASSERT_TRUE(publisher1.bind());
@@ -510,6 +574,79 @@ TEST_F(ZmqIntegrationTest, PublishSubscribeRawRoundtrip) {
     EXPECT_EQ(subscriber.messages_received(), 1);
 }
 
+TEST_F(ZmqIntegrationTest, PublishSubscribeAlignedBuffer) {
+    ZmqPublisher publisher(pub_config_);
+    ASSERT_TRUE(publisher.bind());
+
+    ZmqSubscriber subscriber(sub_config_);
+    ASSERT_TRUE(subscriber.connect());
+    ASSERT_TRUE(subscriber.subscribe("imu"));
+
+    std::this_thread::sleep_for(100ms);
+
+    ImuData sent_imu{.sensor_id_ = "imu_main", .timestamp_ns_ = 1234567890123, .accel_z = 9.81f};
+    AlignedBuffer sent_data;
+    Message<ImuData>(sent_imu).serialize(sent_data);
+    ASSERT_TRUE(publisher.publish_raw("imu", sent_data));
+
+    // Capacity is reused, and the copy starts on a cache line
+    AlignedBuffer received_data(3);
+    ASSERT_TRUE(subscriber.receive_raw(received_data));
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(received_data.data()) % kCacheLineSize, 0u);
+    EXPECT_EQ(received_data, sent_data);
+
+    auto received = Message<ImuData>::deserialize(received_data);
+    ASSERT_TRUE(received.has_value());
+    EXPECT_EQ(received->payload().sensor_id_, sent_imu.sensor_id_);
+}
+
+TEST_F(ZmqIntegrationTest, PublishSubscribeFlatBufferCodecMessage) {
+    ZmqPublisher publisher(pub_config_);
+    ASSERT_TRUE(publisher.bind());
+
+    ZmqSubscriber subscriber(sub_config_);
+    ASSERT_TRUE(subscriber.connect());
+    ASSERT_TRUE(subscriber.subscribe("imu"));
+
+    std::this_thread::sleep_for(100ms);
+
+    ImuData sent_imu{.sensor_id_ = "imu_main", .timestamp_ns_ = 1234567890123, .accel_z = 9.81f};
+    const Message<ImuData, FlatBufferCodec> sent_message(sent_imu);
+    ASSERT_TRUE(publisher.publish("imu", sent_message));
+
+    auto received = subscriber.receive<ImuData, FlatBufferCodec>();
+    ASSERT_TRUE(received.has_value());
+    EXPECT_EQ(received->header().sequence_number, sent_message.header().sequence_number);
+    EXPECT_EQ(received->payload().sensor_id_, sent_imu.sensor_id_);
+    EXPECT_FLOAT_EQ(received->payload().accel_z, sent_imu.accel_z);
+}
+
+TEST_F(ZmqIntegrationTest, PublishSubscribePooledFrames) {
+    ZmqPublisher publisher(pub_config_);
+    ASSERT_TRUE(publisher.bind());
+
+    ZmqSubscriber subscriber(sub_config_);
+    ASSERT_TRUE(subscriber.connect());
+    ASSERT_TRUE(subscriber.subscribe("bulk"));
+
+    std::this_thread::sleep_for(100ms);
+
+    // Large enough for the send buffer pool; small frames bypass it
+    std::vector<uint8_t> sent_data(64 * 1024);
+    std::iota(sent_data.begin(), sent_data.end(), uint8_t{0});
+    for (int i = 0; i < 3; ++i) {
+        ASSERT_TRUE(publisher.publish_raw("bulk", sent_data));
+        auto received = subscriber.receive_raw();
+        ASSERT_TRUE(received.has_value());
+        EXPECT_EQ(*received, sent_data);
+    }
+    ASSERT_TRUE(publisher.publish_raw("bulk", std::vector<uint8_t>(16, 0xAB)));
+    ASSERT_TRUE(subscriber.receive_raw().has_value());
+
+    EXPECT_GE(publisher.send_buffers().blocks_allocated(), 1u);
+    EXPECT_LE(publisher.send_buffers().blocks_allocated(), 3u);
+}
+
 TEST_F(ZmqIntegrationTest, PublishSubscribeTypedMessage) {
     ZmqPublisher publisher(pub_config_);
     ASSERT_TRUE(publisher.bind());
@@ -546,6 +683,522 @@ TEST_F(ZmqIntegrationTest, PublishSubscribeTypedMessage) {
     EXPECT_EQ(received_frame.height, sent_frame.height);
 }
 
+TEST_F(ZmqIntegrationTest, PublishSubscribeMessageView) {
+    ZmqPublisher publisher(pub_config_);
+    ASSERT_TRUE(publisher.bind());
+
+    ZmqSubscriber subscriber(sub_config_);
+    ASSERT_TRUE(subscriber.connect());
+    ASSERT_TRUE(subscriber.subscribe("imu"));
+
+    std::this_thread::sleep_for(100ms);
+
+    ImuData sent_imu{
+        .sensor_id_ = "imu_main",
+        .timestamp_ns_ = 1234567890123,
+        .accel_x = 0.5f,
+        .accel_y = -0.5f,
+        .accel_z = 9.81f,
+        .gyro_x = 0.01f,
+        .gyro_y = 0.02f,
+        .gyro_z = 0.03f
+    };
+    Message<ImuData> sent_message(sent_imu);
+    ASSERT_TRUE(publisher.publish("imu", sent_message));
+
+    // View points into the received frame, no payload copy
+    zmq::message_t frame;
+    auto view = subscriber.receive_view<ImuData>(frame);
+    ASSERT_TRUE(view.has_value());
+
+    EXPECT_EQ(view->header().sequence_number, sent_message.header().sequence_number);
+    EXPECT_EQ(view->payload().sensor_id(), sent_imu.sensor_id());
+    EXPECT_EQ(view->payload().timestamp_ns(), sent_imu.timestamp_ns());
+    EXPECT_FLOAT_EQ(view->payload().accel_z(), sent_imu.accel_z);
+    EXPECT_FLOAT_EQ(view->payload().gyro_z(), sent_imu.gyro_z);
+    EXPECT_EQ(view->bytes().data(), static_cast<const uint8_t*>(frame.data()));
+    EXPECT_EQ(subscriber.messages_received(), 1u);
+}
+
+TEST_F(ZmqIntegrationTest, PublishSubscribeReceiveInto) {
+    ZmqPublisher publisher(pub_config_);
+    ASSERT_TRUE(publisher.bind());
+
+    ZmqSubscriber subscriber(sub_config_);
+    ASSERT_TRUE(subscriber.connect());
+    ASSERT_TRUE(subscriber.subscribe("imu"));
+
+    std::this_thread::sleep_for(100ms);
+
+    ImuData sent_imu{
+        .sensor_id_ = "imu_main",
+        .timestamp_ns_ = 1234567890123,
+        .accel_x = 0.5f,
+        .accel_y = -0.5f,
+        .accel_z = 9.81f,
+        .gyro_x = 0.01f,
+        .gyro_y = 0.02f,
+        .gyro_z = 0.03f
+    };
+
+    // One long-lived message is overwritten by each receive
+    Message<ImuData> received;
+    for (uint64_t i = 0; i < 3; ++i) {
+        sent_imu.timestamp_ns_ += i;
+        Message<ImuData> sent_message(sent_imu);
+        ASSERT_TRUE(publisher.publish("imu", sent_message));
+
+        ASSERT_TRUE(subscriber.receive_into(received));
+        EXPECT_EQ(received.header().sequence_number, sent_message.header().sequence_number);
+        EXPECT_EQ(received.payload().sensor_id_, sent_imu.sensor_id_);
+        EXPECT_EQ(received.payload().timestamp_ns_, sent_imu.timestamp_ns_);
+        EXPECT_FLOAT_EQ(received.payload().accel_z, sent_imu.accel_z);
+    }
+    EXPECT_EQ(subscriber.messages_received(), 3u);
+}
+
+TEST_F(ZmqIntegrationTest, PublishSubscribeReceiveBatch) {
+    sub_config_.receive_timeout_ms = 100;
+    ZmqPublisher publisher(pub_config_);
+    ASSERT_TRUE(publisher.bind());
+
+    ZmqSubscriber subscriber(sub_config_);
+    ASSERT_TRUE(subscriber.connect());
+    ASSERT_TRUE(subscriber.subscribe("imu"));
+
+    std::this_thread::sleep_for(100ms);
+
+    ImuData sent_imu{.sensor_id_ = "vehicle_07/imu_front_left", .timestamp_ns_ = 1000, .accel_z = 9.81f};
+    for (uint64_t i = 0; i < 5; ++i) {
+        sent_imu.timestamp_ns_ = 1000 + i;
+        ASSERT_TRUE(publisher.publish("imu", Message<ImuData>(sent_imu)));
+    }
+    std::this_thread::sleep_for(50ms);
+
+    MessageBatch<ImuData> batch;
+    // Queued messages are taken without waiting, up to the limit
+    ASSERT_EQ(subscriber.receive_batch(batch, 3), 3u);
+    EXPECT_EQ(batch[0].payload().timestamp_ns_, 1000u);
+    EXPECT_EQ(batch[2].payload().sensor_id_, sent_imu.sensor_id_);
+    EXPECT_EQ(batch[2].payload().sensor_id_.get_allocator().resource(), batch.resource());
+
+    ASSERT_EQ(subscriber.receive_batch(batch, 3), 2u);
+    EXPECT_EQ(batch[1].payload().timestamp_ns_, 1004u);
+
+    // Nothing queued: the first receive times out and the batch is empty
+    EXPECT_EQ(subscriber.receive_batch(batch, 3), 0u);
+    EXPECT_TRUE(batch.empty());
+    EXPECT_EQ(subscriber.messages_received(), 5u);
+}
+
+TEST_F(ZmqIntegrationTest, ReceiveBatchReadsPastStringAnnouncements) {
+    sub_config_.receive_timeout_ms = 100;
+    pub_config_.string_announce_interval = 0;  // Taken as 1: an announcement ahead of every message
+    ZmqPublisher publisher(pub_config_);
+    ASSERT_TRUE(publisher.bind());
+
+    auto strings = std::make_shared<StringRegistry>();
+    ASSERT_TRUE(strings->intern("imu_main"));
+    publisher.set_string_registry(strings);
+
+    ZmqSubscriber subscriber(sub_config_);
+    ASSERT_TRUE(subscriber.connect());
+    ASSERT_TRUE(subscriber.subscribe("imu"));
+    ASSERT_TRUE(subscriber.enable_string_interning());
+
+    std::this_thread::sleep_for(100ms);
+
+    for (uint64_t i = 0; i < 3; ++i) {
+        ASSERT_TRUE(publisher.publish("imu", Message<ImuData>(ImuData{.sensor_id_ = "imu_main", .timestamp_ns_ = i})));
+    }
+    std::this_thread::sleep_for(50ms);
+
+    // Absorbing an announcement does not end the batch
+    MessageBatch<ImuData> batch;
+    ASSERT_EQ(subscriber.receive_batch(batch, 8), 3u);
+    EXPECT_EQ(batch[2].payload().timestamp_ns_, 2u);
+    EXPECT_EQ(batch[2].payload().sensor_id_, "imu_main");
+}
+
+TEST_F(ZmqIntegrationTest, PublishSubscribeRawBatch) {
+    ZmqPublisher publisher(pub_config_);
+    ASSERT_TRUE(publisher.bind());
+
+    ZmqSubscriber subscriber(sub_config_);
+    ASSERT_TRUE(subscriber.connect());
+    ASSERT_TRUE(subscriber.subscribe("camera"));
+
+    std::this_thread::sleep_for(100ms);
+
+    // Topics may differ within a batch; each pair still goes through filtering,
+    // including runs of one topic that share a topic part
+    std::vector<uint8_t> first = {0xCA, 0x01};
+    std::vector<uint8_t> lidar = {0xA1, 0xDA};
+    std::vector<uint8_t> second = {0xCA, 0x02, 0x03};
+    std::vector<uint8_t> third = {0xCA, 0x04};
+    const std::vector<OutgoingMessage> batch = {{"camera", first},     {"lidar", lidar}, {"lidar", lidar},
+                                                {"camera_rgb", second}, {"camera_rgb", third}, {"lidar", lidar}};
+    ASSERT_EQ(publisher.publish_batch(batch), 6u);
+    EXPECT_EQ(publisher.messages_sent(), 6u);
+
+    for (const auto& expected : {first, second, third}) {
+        auto result = subscriber.receive_raw();
+        ASSERT_TRUE(result.has_value());
+        EXPECT_EQ(result.value(), expected);
+    }
+}
+
+TEST_F(ZmqIntegrationTest, PublishSubscribeTypedBatch) {
+    sub_config_.receive_timeout_ms = 100;
+    ZmqPublisher publisher(pub_config_);
+    ASSERT_TRUE(publisher.bind());
+
+    ZmqSubscriber subscriber(sub_config_);
+    ASSERT_TRUE(subscriber.connect());
+    ASSERT_TRUE(subscriber.subscribe("imu"));
+
+    std::this_thread::sleep_for(100ms);
+
+    std::vector<Message<ImuData>> messages;
+    for (uint64_t i = 0; i < 5; ++i) {
+        messages.emplace_back(ImuData{.sensor_id_ = "imu_main", .timestamp_ns_ = 1000 + i, .accel_z = 9.81f});
+    }
+    ASSERT_EQ(publisher.publish_batch("imu", messages), 5u);
+    EXPECT_EQ(publisher.messages_sent(), 5u);
+    std::this_thread::sleep_for(50ms);
+
+    MessageBatch<ImuData> batch;
+    ASSERT_EQ(subscriber.receive_batch(batch, 8), 5u);
+    for (size_t i = 0; i < batch.size(); ++i) {
+        EXPECT_EQ(batch[i].header().sequence_number, messages[i].header().sequence_number);
+        EXPECT_EQ(batch[i].payload().timestamp_ns_, 1000u + i);
+    }
+}
+
+TEST_F(ZmqIntegrationTest, PublishSubscribeInternedStrings) {
+    ZmqPublisher publisher(pub_config_);
+    ASSERT_TRUE(publisher.bind());
+
+    auto strings = std::make_shared<StringRegistry>();
+    ASSERT_TRUE(strings->intern("imu_main"));
+    publisher.set_string_registry(strings);
+
+    ZmqSubscriber subscriber(sub_config_);
+    ASSERT_TRUE(subscriber.connect());
+    ASSERT_TRUE(subscriber.subscribe("imu"));
+    ASSERT_TRUE(subscriber.enable_string_interning());
+
+    std::this_thread::sleep_for(100ms);
+
+    ImuData sent_imu{
+        .sensor_id_ = "imu_main",
+        .timestamp_ns_ = 1234567890123,
+        .accel_x = 0.5f,
+        .accel_y = -0.5f,
+        .accel_z = 9.81f,
+        .gyro_x = 0.01f,
+        .gyro_y = 0.02f,
+        .gyro_z = 0.03f
+    };
+    Message<ImuData> sent_message(sent_imu);
+    ASSERT_TRUE(publisher.publish("imu", sent_message));
+
+    // The announcement sent ahead of the message is absorbed by receive()
+    auto received = subscriber.receive<ImuData>();
+    ASSERT_TRUE(received.has_value());
+    EXPECT_EQ(received->payload().sensor_id_, sent_imu.sensor_id_);
+    EXPECT_FLOAT_EQ(received->payload().accel_z, sent_imu.accel_z);
+    EXPECT_EQ(subscriber.strings().id_of("imu_main"), 0u);
+    EXPECT_EQ(subscriber.messages_received(), 1u);
+    EXPECT_EQ(publisher.messages_sent(), 1u);
+}
+
+TEST_F(ZmqIntegrationTest, ConflictingStringRegistryFailsClosed) {
+    sub_config_.receive_timeout_ms = 500;
+    ZmqPublisher publisher(pub_config_);
+    ASSERT_TRUE(publisher.bind());
+
+    ZmqSubscriber subscriber(sub_config_);
+    ASSERT_TRUE(subscriber.connect());
+    ASSERT_TRUE(subscriber.subscribe("imu"));
+    ASSERT_TRUE(subscriber.enable_string_interning());
+
+    std::this_thread::sleep_for(100ms);
+
+    auto main_strings = std::make_shared<StringRegistry>();
+    ASSERT_TRUE(main_strings->intern("imu_main"));
+    publisher.set_string_registry(main_strings);
+    ASSERT_TRUE(publisher.publish("imu", Message<ImuData>(ImuData{.sensor_id_ = "imu_main"})));
+    auto first = subscriber.receive<ImuData>();
+    ASSERT_TRUE(first.has_value());
+    EXPECT_FALSE(subscriber.strings_rejected());
+
+    // Another registry on the same subscriber: id 0 now means "imu_aux" and
+    // must not be read back as "imu_main"
+    auto aux_strings = std::make_shared<StringRegistry>();
+    ASSERT_TRUE(aux_strings->intern("imu_aux"));
+    publisher.set_string_registry(aux_strings);
+    ASSERT_TRUE(publisher.publish("imu", Message<ImuData>(ImuData{.sensor_id_ = "imu_aux"})));
+    EXPECT_FALSE(subscriber.receive<ImuData>().has_value());
+    EXPECT_TRUE(subscriber.strings_rejected());
+    EXPECT_TRUE(subscriber.strings().empty());
+    EXPECT_EQ(subscriber.announcements_rejected(), 1u);
+    EXPECT_EQ(subscriber.decode_failures(), 1u);
+
+    // Later announcements stay ignored but are counted; inline strings still decode
+    publisher.set_string_registry(main_strings);
+    ASSERT_TRUE(publisher.publish("imu", Message<ImuData>(ImuData{.sensor_id_ = "imu_main"})));
+    EXPECT_FALSE(subscriber.receive<ImuData>().has_value());
+    EXPECT_TRUE(subscriber.strings().empty());
+    EXPECT_EQ(subscriber.announcements_rejected(), 2u);
+    EXPECT_EQ(subscriber.decode_failures(), 2u);
+
+    publisher.set_string_registry(nullptr);
+    ASSERT_TRUE(publisher.publish("imu", Message<ImuData>(ImuData{.sensor_id_ = "imu_aux"})));
+    auto inline_message = subscriber.receive<ImuData>();
+    ASSERT_TRUE(inline_message.has_value());
+    EXPECT_EQ(inline_message->payload().sensor_id_, "imu_aux");
+    EXPECT_EQ(subscriber.decode_failures(), 2u);
+}
+
+TEST_F(ZmqIntegrationTest, ResetStringsAcceptsARestartedPublisher) {
+    sub_config_.receive_timeout_ms = 500;
+    ZmqPublisher publisher(pub_config_);
+    ASSERT_TRUE(publisher.bind());
+
+    ZmqSubscriber subscriber(sub_config_);
+    ASSERT_TRUE(subscriber.connect());
+    ASSERT_TRUE(subscriber.subscribe("imu"));
+    ASSERT_TRUE(subscriber.enable_string_interning());
+
+    std::this_thread::sleep_for(100ms);
+
+    auto before = std::make_shared<StringRegistry>();
+    ASSERT_TRUE(before->intern("imu_main"));
+    ASSERT_TRUE(before->intern("imu_aux"));
+    publisher.set_string_registry(before);
+    ASSERT_TRUE(publisher.publish("imu", Message<ImuData>(ImuData{.sensor_id_ = "imu_main"})));
+    ASSERT_TRUE(subscriber.receive<ImuData>().has_value());
+
+    // Restarted publisher interning in the other order
+    auto after = std::make_shared<StringRegistry>();
+    ASSERT_TRUE(after->intern("imu_aux"));
+    ASSERT_TRUE(after->intern("imu_main"));
+    publisher.set_string_registry(after);
+    ASSERT_TRUE(publisher.publish("imu", Message<ImuData>(ImuData{.sensor_id_ = "imu_main"})));
+    EXPECT_FALSE(subscriber.receive<ImuData>().has_value());
+    ASSERT_TRUE(subscriber.strings_rejected());
+
+    subscriber.reset_strings();
+    EXPECT_FALSE(subscriber.strings_rejected());
+    EXPECT_TRUE(subscriber.strings().empty());
+
+    ASSERT_TRUE(publisher.announce_strings());
+    ASSERT_TRUE(publisher.publish("imu", Message<ImuData>(ImuData{.sensor_id_ = "imu_main"})));
+    auto received = subscriber.receive<ImuData>();
+    ASSERT_TRUE(received.has_value());
+    EXPECT_EQ(received->payload().sensor_id_, "imu_main");
+    EXPECT_EQ(subscriber.strings().id_of("imu_aux"), 0u);
+}
+
+TEST_F(ZmqIntegrationTest, StringAnnouncementsAreNotCounted) {
+    pub_config_.string_announce_interval = 0;  // Taken as 1: announce before every publish
+    ZmqPublisher publisher(pub_config_);
+    ASSERT_TRUE(publisher.bind());
+
+    auto strings = std::make_shared<StringRegistry>();
+    ASSERT_TRUE(strings->intern("imu_main"));
+    publisher.set_string_registry(strings);
+
+    // Plain socket: ZmqSubscriber absorbs announcements, this one sees them
+    zmq::context_t context(1);
+    zmq::socket_t listener(context, zmq::socket_type::sub);
+    listener.set(zmq::sockopt::rcvtimeo, 1000);
+    listener.connect(sub_config_.endpoint);
+    listener.set(zmq::sockopt::subscribe, kStringRegistryTopic);
+
+    std::this_thread::sleep_for(100ms);
+
+    Message<ImuData> message(ImuData{.sensor_id_ = "imu_main"});
+    for (int i = 0; i < 3; ++i) {
+        ASSERT_TRUE(publisher.publish("imu", message));
+    }
+    EXPECT_TRUE(publisher.announce_strings());
+    EXPECT_EQ(publisher.messages_sent(), 3u);
+
+    for (int i = 0; i < 4; ++i) {
+        zmq::message_t topic;
+        zmq::message_t data;
+        ASSERT_TRUE(listener.recv(topic)) << "announcement " << i;
+        ASSERT_TRUE(listener.recv(data));
+        EXPECT_EQ(topic.to_string_view(), kStringRegistryTopic);
+    }
+}
+
+TEST_F(ZmqIntegrationTest, FailedStringAnnouncementIsRetried) {
+    ZmqPublisher publisher(pub_config_);
+    auto strings = std::make_shared<StringRegistry>();
+    ASSERT_TRUE(strings->intern("imu_main"));
+    publisher.set_string_registry(strings);
+
+    // Not bound yet: neither the announcement nor the message goes out
+    Message<ImuData> message(ImuData{.sensor_id_ = "imu_main", .accel_z = 9.81f});
+    EXPECT_FALSE(publisher.publish("imu", message));
+
+    ASSERT_TRUE(publisher.bind());
+    ZmqSubscriber subscriber(sub_config_);
+    ASSERT_TRUE(subscriber.connect());
+    ASSERT_TRUE(subscriber.subscribe("imu"));
+    ASSERT_TRUE(subscriber.enable_string_interning());
+
+    std::this_thread::sleep_for(100ms);
+
+    // Still due, so the announcement precedes this publish
+    ASSERT_TRUE(publisher.publish("imu", message));
+    auto received = subscriber.receive<ImuData>();
+    ASSERT_TRUE(received.has_value());
+    EXPECT_EQ(received->payload().sensor_id_, "imu_main");
+    EXPECT_EQ(publisher.messages_sent(), 1u);
+}
+
+TEST_F(ZmqIntegrationTest, StringAnnouncementIntervalCountsSentPublishes) {
+    pub_config_.string_announce_interval = 2;
+    ZmqPublisher publisher(pub_config_);
+    auto strings = std::make_shared<StringRegistry>();
+    ASSERT_TRUE(strings->intern("imu_main"));
+    publisher.set_string_registry(strings);
+
+    // Not bound yet: these publishes fail and must not use up the interval
+    Message<ImuData> message(ImuData{.sensor_id_ = "imu_main"});
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_FALSE(publisher.publish("imu", message));
+    }
+
+    ASSERT_TRUE(publisher.bind());
+    zmq::context_t context(1);
+    zmq::socket_t listener(context, zmq::socket_type::sub);
+    listener.set(zmq::sockopt::rcvtimeo, 1000);
+    listener.connect(sub_config_.endpoint);
+    listener.set(zmq::sockopt::subscribe, "");
+
+    std::this_thread::sleep_for(100ms);
+
+    for (int i = 0; i < 3; ++i) {
+        ASSERT_TRUE(publisher.publish("imu", message));
+    }
+
+    const std::vector<std::string_view> expected = {kStringRegistryTopic, "imu", "imu", kStringRegistryTopic, "imu"};
+    for (size_t i = 0; i < expected.size(); ++i) {
+        zmq::message_t topic;
+        zmq::message_t data;
+        ASSERT_TRUE(listener.recv(topic)) << "part " << i;
+        ASSERT_TRUE(listener.recv(data));
+        EXPECT_EQ(topic.to_string_view(), expected[i]) << "part " << i;
+    }
+}
+
+TEST_F(ZmqIntegrationTest, PublishSubscribeDispatchByType) {
+    ZmqPublisher publisher(pub_config_);
+    ASSERT_TRUE(publisher.bind());
+
+    ZmqSubscriber subscriber(sub_config_);
+    ASSERT_TRUE(subscriber.connect());
+    ASSERT_TRUE(subscriber.subscribe("sensors/"));
+
+    std::this_thread::sleep_for(100ms);
+
+    ASSERT_TRUE(publisher.publish("sensors/imu", Message<ImuData>(ImuData{.sensor_id_ = "imu_main", .accel_z = 9.81f})));
+    ASSERT_TRUE(publisher.publish("sensors/camera", Message<CameraFrameData>(CameraFrameData{
+        .sensor_id_ = "camera_front", .width = 640, .height = 480, .encoding = "RGB8"})));
+
+    // One socket, two payload types, no per-topic type knowledge
+    int imu_count = 0;
+    int camera_count = 0;
+    auto on_imu = [&](const Message<ImuData>& msg) {
+        EXPECT_FLOAT_EQ(msg.payload().accel_z, 9.81f);
+        ++imu_count;
+    };
+    auto on_camera = [&](const MessageView<CameraFrameData>& view) {
+        EXPECT_EQ(view.payload().width(), 640u);
+        ++camera_count;
+    };
+
+    EXPECT_TRUE(subscriber.receive_dispatch({}, on_imu, on_camera));
+    EXPECT_TRUE(subscriber.receive_dispatch({}, on_imu, on_camera));
+    EXPECT_EQ(imu_count, 1);
+    EXPECT_EQ(camera_count, 1);
+}
+
+TEST_F(ZmqIntegrationTest, PublishSubscribeCameraPixels) {
+    ZmqPublisher publisher(pub_config_);
+    ASSERT_TRUE(publisher.bind());
+
+    ZmqSubscriber subscriber(sub_config_);
+    ASSERT_TRUE(subscriber.connect());
+    ASSERT_TRUE(subscriber.subscribe("camera"));
+
+    std::this_thread::sleep_for(100ms);
+
+    std::vector<uint8_t> pixels(640 * 480 * 3);
+    for (size_t i = 0; i < pixels.size(); ++i) {
+        pixels[i] = static_cast<uint8_t>(i * 7);
+    }
+    Message<CameraFrameData> sent_message(CameraFrameData{
+        .sensor_id_ = "camera_front", .frame_id = 3, .width = 640, .height = 480, .encoding = "RGB8",
+        .pixels = ImageBuffer(pixels)});
+    ASSERT_TRUE(publisher.publish("camera", sent_message));
+
+    auto received = subscriber.receive<CameraFrameData>();
+    ASSERT_TRUE(received.has_value());
+    EXPECT_EQ(received->payload().frame_id, 3u);
+    EXPECT_EQ(received->payload().encoding, "RGB8");
+
+    const ImageBuffer& received_pixels = received->payload().pixels;
+    ASSERT_EQ(received_pixels.size(), pixels.size());
+    EXPECT_TRUE(std::equal(pixels.begin(), pixels.end(), received_pixels.data()));
+
+    // ZeroMQ drops its handle to the sent pixels once they are on the wire
+    const auto deadline = std::chrono::steady_clock::now() + 1s;
+    while (sent_message.payload().pixels.use_count() > 1 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(1ms);
+    }
+    EXPECT_EQ(sent_message.payload().pixels.use_count(), 1);
+}
+
+TEST_F(ZmqIntegrationTest, PublishSubscribeFlatBuffer) {
+    ZmqPublisher publisher(pub_config_);
+    ASSERT_TRUE(publisher.bind());
+
+    ZmqSubscriber subscriber(sub_config_);
+    ASSERT_TRUE(subscriber.connect());
+    ASSERT_TRUE(subscriber.subscribe("camera"));
+
+    std::this_thread::sleep_for(100ms);
+
+    CameraFrameData sent_frame{
+        .sensor_id_ = "camera_front",
+        .timestamp_ns_ = 1234567890123,
+        .frame_id = 7,
+        .width = 1280,
+        .height = 720,
+        .encoding = "RGB8"
+    };
+    Message<CameraFrameData> sent_message(sent_frame);
+    ASSERT_TRUE(publisher.publish_flatbuffer("camera", sent_message));
+
+    // Fields are read in place from the received frame
+    zmq::message_t frame;
+    auto view = subscriber.receive_flatbuffer<CameraFrameData>(frame);
+    ASSERT_TRUE(view.has_value());
+
+    EXPECT_EQ(view->header().sequence_number, sent_message.header().sequence_number);
+    EXPECT_EQ(view->sensor_id(), sent_frame.sensor_id());
+    EXPECT_EQ(view->payload().width(), sent_frame.width);
+    EXPECT_EQ(view->payload().height(), sent_frame.height);
+    EXPECT_EQ(view->bytes().data(), static_cast<const uint8_t*>(frame.data()));
+    EXPECT_EQ(subscriber.messages_received(), 1u);
+}
+
 TEST_F(ZmqIntegrationTest, TopicFiltering) {
     ZmqPublisher publisher(pub_config_);
     ASSERT_TRUE(publisher.bind());